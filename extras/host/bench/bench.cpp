@@ -0,0 +1,1366 @@
+// extras/host/bench/bench.cpp
+// Kütüphanenin sıcak yollarının masaüstü ölçümleri. Her ölçüm gerçek kütüphane kodunu Arduino taklidi
+// üzerinden çalıştırır; süreler cihazdan hızlıdır, ancak ayırma sayıları ve göreli farklar karşılaştırılabilir.
+//
+//   esp32helper_bench [--quick] [--filter <ad>]
+//
+// --quick: az yinelemeyle yalnızca doğrulama (ctest bunu çalıştırır). Herhangi bir doğrulama
+// başarısız olursa program 1 ile çıkar.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <ESP32Helper.h>
+#include <FirmwarePipeline.h>
+#include <FirmwareWriter.h>
+#include <LittleFS.h>
+#include <SpscQueue.h>
+#include <Preferences.h>
+#include <Update.h>
+#include <WiFi.h>
+#include <mbedtls/sha256.h>
+#include <zlib.h>
+#include "HostShim.h"
+
+extern HelperWebServer server;
+extern HelperSocketServer webSocket;
+
+static bool quick = false;
+static const char* filter = nullptr;
+static int failures = 0;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "HATA %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+static bool selected(const char* name) { return !filter || strstr(name, filter) != nullptr; }
+
+// Bir ölçümün süresi ve bu sürede yapılan yığın ayırmaları
+class Measure {
+public:
+    Measure() : _heap(hostHeapStats()), _start(std::chrono::steady_clock::now()) {}
+
+    void report(const char* name, uint64_t iterations, uint64_t bytes = 0) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+        HostHeapStats heap = hostHeapStats();
+        double allocs = (double)(heap.allocations - _heap.allocations) / (iterations ? iterations : 1);
+        printf("%-34s %9llu %11.1f %13.0f", name, (unsigned long long)iterations, seconds * 1e9 / iterations, iterations / seconds);
+        if (bytes > 0) { printf(" %9.2f", bytes / seconds / (1024.0 * 1024.0)); } else { printf(" %9s", "-"); }
+        printf(" %9.2f\n", allocs);
+    }
+
+private:
+    HostHeapStats _heap;
+    std::chrono::steady_clock::time_point _start;
+};
+
+static uint64_t iterations(uint64_t full) { return quick ? (full / 100 > 0 ? full / 100 : 1) : full; }
+
+// --- Kurulum ---
+
+static uint32_t buttonEvents = 0;
+static uint32_t messageEvents = 0;
+
+// Kayıtlı bir ağ ile begin() çağrılır; shim WiFi hemen bağlanır ve bir panel istemcisi açılır
+static ESP32Helper* createHelper(size_t buttons, ButtonType type, void (*setup)(ESP32Helper*) = nullptr) {
+    server.hostReset();
+    webSocket.hostReset();
+    WiFi.hostReset();
+    Preferences::hostReset();
+    Preferences prefs;
+    prefs.begin("esp32helper");
+    prefs.putString("ssid", "bench");
+    prefs.putString("password", "12345678");
+    prefs.end();
+
+    ESP32Helper* helper = new ESP32Helper("bench", "1.0.0", [](String message) { messageEvents += message.length() > 0; });
+    // Kontrol adları kopyalanmaz; cihazdaki string literal'ler gibi kalıcı olmalıdır
+    static char names[HELPER_MAX_CONTROLS][12];
+    for (size_t i = 0; i < buttons; i++) {
+        snprintf(names[i], sizeof(names[i]), "Buton %u", (unsigned)i);
+        helper->addButton(names[i], type, [](bool state) { buttonEvents += state ? 1 : 0; });
+    }
+    if (setup) { setup(helper); }
+    helper->begin();
+    helper->loop();
+    webSocket.hostConnect(0);
+    helper->loop();
+    return helper;
+}
+
+static void destroyHelper(ESP32Helper* helper) {
+    WebSerial.flush();
+    WebSerial.setStore(nullptr);
+    server.hostReset();
+    webSocket.hostReset();
+    WiFi.hostReset();
+    delete helper;
+}
+
+// --- Ölçümler ---
+
+static void benchStateJson() {
+    const size_t counts[] = {4, 32};
+    for (size_t count : counts) {
+        char name[48];
+        snprintf(name, sizeof(name), "state_json/%u buton", (unsigned)count);
+        if (!selected(name)) { continue; }
+        ESP32Helper* helper = createHelper(count, BTN_SWITCH);
+        uint64_t n = iterations(20000);
+        uint64_t bytes = 0;
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/api/state");
+            bytes += response.body.size();
+            if (i == 0) { CHECK(response.code == 200 && response.body.compare(0, 5, "{\"v\":") == 0); }
+        }
+        m.report(name, n, bytes);
+        destroyHelper(helper);
+    }
+}
+
+static void benchPanel() {
+    if (!selected("panel/")) { return; }
+    ESP32Helper* helper = createHelper(4, BTN_SWITCH);
+    uint64_t n = iterations(50000);
+    uint64_t bytes = 0;
+    {
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/panel");
+            bytes += response.body.size();
+            if (i == 0) { CHECK(response.code == 200 && response.header("Content-Encoding") == "gzip"); }
+        }
+        m.report("panel/200 gzip", n, bytes);
+    }
+    {
+        String etag = server.hostRequest(HTTP_GET, "/panel").header("ETag");
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/panel", {{"If-None-Match", etag.c_str()}});
+            if (i == 0) { CHECK(response.code == 304 && response.body.empty()); }
+        }
+        m.report("panel/304 etag", n);
+    }
+    destroyHelper(helper);
+}
+
+// Kurulum DNS'ine gerçek UDP sorgusu; cevap uzunluğunu ya da cevap yoksa 0 döner
+static size_t dnsQuery(ESP32Helper* helper, int fd, uint16_t port, const char* name, uint16_t type, uint8_t* reply, size_t capacity) {
+    uint8_t query[256] = {0x12, 0x34, 0x01, 0x00, 0x00, 0x01, 0, 0, 0, 0, 0, 0};
+    size_t length = 12;
+    for (const char* label = name; *label;) {
+        const char* dot = strchr(label, '.');
+        size_t size = dot ? (size_t)(dot - label) : strlen(label);
+        query[length++] = (uint8_t)size;
+        memcpy(query + length, label, size);
+        length += size;
+        label += size + (dot ? 1 : 0);
+    }
+    query[length++] = 0;
+    query[length++] = type >> 8; query[length++] = type & 0xff;
+    query[length++] = 0; query[length++] = 1;
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_port = htons(port);
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sendto(fd, query, length, 0, (struct sockaddr*)&to, sizeof(to));
+    helper->loop();
+    struct pollfd waiter = {fd, POLLIN, 0};
+    if (poll(&waiter, 1, 100) <= 0) { return 0; }
+    ssize_t received = recv(fd, reply, capacity, 0);
+    return received > 0 ? (size_t)received : 0;
+}
+
+// Kayıtsız açılış (AP modu): kurulum sayfası, önbellekli tarama, kurulum DNS'i ve yeniden başlatmadan bağlanma
+static void benchProvision() {
+    if (!selected("setup/") && !selected("scan/") && !selected("dns/")) { return; }
+    server.hostReset();
+    webSocket.hostReset();
+    WiFi.hostReset();
+    Preferences::hostReset();
+    // Aynı ağın iki erişim noktası ve gizli bir ağ; listede ev bir kez (-48 ile) ve en üstte olmalı
+    WiFi.hostSetScanResults({{"ofis", -70, false, 6}, {"ev", -60, false, 1}, {"", -40, true, 11}, {"ev", -48, false, 11}, {"kafe", -80, true, 3}});
+    WiFi.hostSetAutoConnect(false);
+    ESP32Helper* helper = new ESP32Helper("bench", "1.0.0");
+    helper->begin();
+    helper->loop();
+    CHECK(WiFi.softAPIP() == IPAddress(192, 168, 4, 1) && WiFi.hostScans() == 1);
+
+    uint64_t n = iterations(50000);
+    if (selected("setup/")) {
+        uint64_t bytes = 0;
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/");
+            bytes += response.body.size();
+            if (i == 0) { CHECK(response.code == 200 && response.header("Content-Encoding") == "gzip" && response.body.size() < 2048); }
+        }
+        m.report("setup/200 gzip", n, bytes);
+        // Telefonun bağlantı kontrolü kurulum sayfasına yönlenir; cihazın kendi adresine gelen bilinmeyen yol 404'tür
+        HostResponse probe = server.hostRequest(HTTP_GET, "/generate_204", {{"Host", "connectivitycheck.gstatic.com"}});
+        CHECK(probe.code == 302 && probe.header("Location") == "http://192.168.4.1/setup");
+        CHECK(server.hostRequest(HTTP_GET, "/yok", {{"Host", "192.168.4.1"}}).code == 404);
+        CHECK(server.hostRequest(HTTP_GET, "/yok", {{"Host", "bench.local"}}).code == 404);
+    }
+    if (selected("scan/")) {
+        uint64_t bytes = 0;
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/api/scan");
+            bytes += response.body.size();
+            if (i == 0) {
+                CHECK(response.body.find("\"networks\":[{\"ssid\":\"ev\",\"rssi\":-48,\"open\":false},{\"ssid\":\"ofis\"") != std::string::npos);
+                CHECK(response.body.find("\"ssid\":\"\"") == std::string::npos && response.body.find("-60") == std::string::npos);
+            }
+        }
+        m.report("scan/onbellek", n, bytes);
+        CHECK(WiFi.hostScans() == 1); // Önbellek taze iken yeni tarama başlatılmaz
+    }
+    if (selected("dns/")) {
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        uint16_t port = helper->captiveDns().port();
+        uint8_t reply[512];
+        uint64_t queries = iterations(20000);
+        Measure m;
+        for (uint64_t i = 0; i < queries; i++) {
+            size_t length = dnsQuery(helper, fd, port, "connectivitycheck.gstatic.com", 1, reply, sizeof(reply));
+            if (i == 0) {
+                // Tek cevap kaydı; son dört bayt AP adresi
+                CHECK(length == 47 + 16 && reply[0] == 0x12 && (reply[2] & 0x80) && reply[7] == 1);
+                CHECK(memcmp(reply + length - 4, "\xc0\xa8\x04\x01", 4) == 0);
+            }
+        }
+        m.report("dns/A sorgusu", queries);
+        size_t length = dnsQuery(helper, fd, port, "captive.apple.com", 28, reply, sizeof(reply));
+        CHECK(length > 12 && reply[7] == 0 && (reply[3] & 0x0f) == 0); // AAAA: cevapsız NOERROR
+        close(fd);
+    }
+
+    // Kayıt yeniden başlatmadan bağlantı başlatır; AP sayfa sonucu okuyana kadar açık kalır
+    HostResponse saved = server.hostRequest(HTTP_POST, "/savewifi", {}, {{"ssid", "ev"}, {"password", "12345678"}});
+    CHECK(saved.code == 200);
+    CHECK(server.hostRequest(HTTP_GET, "/api/wifi").body.find("\"state\":\"connecting\"") != std::string::npos);
+    WiFi.hostConnect();
+    helper->loop();
+    HostResponse status = server.hostRequest(HTTP_GET, "/api/wifi");
+    CHECK(status.body.find("\"state\":\"online\",\"ip\":\"127.0.0.1\"") != std::string::npos);
+    CHECK(status.body.find("\"ap\":true") != std::string::npos && helper->captiveDns().isRunning());
+    unsigned long start = millis();
+    while (WiFi.softAPIP() != IPAddress() && millis() - start < HELPER_AP_LINGER_MS + 1000) { helper->loop(); delay(1); }
+    CHECK(WiFi.softAPIP() == IPAddress() && !helper->captiveDns().isRunning());
+    CHECK(server.hostRequest(HTTP_GET, "/").code == 302); // AP kapandı: kök adres yine panele gider
+    destroyHelper(helper);
+
+    // Çevrimiçi cihaza panelden hatalı ağ: yeniden başlatma olmadığından AP geri açılmalı ve eski ağ geri yüklenmeli
+    helper = createHelper(0, BTN_BUTTON);
+    WiFi.hostSetAutoConnect(false);
+    CHECK(server.hostRequest(HTTP_POST, "/savewifi", {}, {{"ssid", "yazim-hatasi"}, {"password", "yanlis123"}}).code == 200);
+    start = millis();
+    while (WiFi.softAPIP() == IPAddress() && millis() - start < 5000) {
+        WiFi.hostDisconnect(); // Her deneme kimlik doğrulama hatasıyla düşer
+        helper->loop();
+        delay(1);
+    }
+    CHECK(WiFi.softAPIP() == IPAddress(192, 168, 4, 1) && helper->config().getString("ssid") == "bench");
+    delay(WIFI_BACKOFF_MIN_MS + 10); // Eski ağa deneme bekleme süresinden sonra başlar
+    helper->loop();
+    WiFi.hostConnect();
+    helper->loop();
+    CHECK(server.hostRequest(HTTP_GET, "/api/wifi").body.find("\"ssid\":\"bench\",\"state\":\"online\"") != std::string::npos);
+    CHECK(WiFi.softAPIP() == IPAddress()); // Eski ağa dönülünce AP beklemeden kapanır
+    destroyHelper(helper);
+}
+
+static void benchMetrics() {
+    if (!selected("metrics/") && !selected("loop/")) { return; }
+    ESP32Helper* helper = createHelper(4, BTN_SWITCH);
+    uint64_t n = iterations(200000);
+    if (selected("loop/")) {
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) { helper->loop(); }
+        m.report("loop/bos", n);
+    }
+    if (selected("metrics/")) {
+        server.hostRequest(HTTP_GET, "/api/state");
+        uint64_t scrapes = iterations(5000);
+        uint64_t bytes = 0;
+        Measure m;
+        for (uint64_t i = 0; i < scrapes; i++) {
+            HostResponse response = server.hostRequest(HTTP_GET, "/metrics");
+            bytes += response.body.size();
+            if (i == 0) {
+                CHECK(response.code == 200);
+                CHECK(response.body.find("esp32helper_loop_duration_seconds_bucket{le=\"+Inf\"}") != std::string::npos);
+                CHECK(response.body.find("esp32helper_http_request_duration_seconds_count{route=\"/api/state\"} 1\n") != std::string::npos);
+                // Açılışta ayarlar RAM'den okunduğu için kaçınılan NVS işlemleri sıfır olamaz
+                CHECK(response.body.find("esp32helper_config_nvs_ops_avoided_total ") != std::string::npos &&
+                      response.body.find("esp32helper_config_nvs_ops_avoided_total 0\n") == std::string::npos);
+            }
+        }
+        m.report("metrics/scrape", scrapes, bytes);
+    }
+    destroyHelper(helper);
+}
+
+static void benchWebPrintf() {
+    if (!selected("webprintf/")) { return; }
+    ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+    static const char line[] = "sensor=%u deger=%u durum=tamam\n";
+    {
+        uint64_t n = iterations(500000);
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        uint64_t framesBefore = webSocket.hostFramesSent();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) { helper->webPrintf(line, (unsigned)i, (unsigned)(i * 7)); }
+        WebSerial.flush();
+        uint64_t bytes = WebSerial.bytesLogged() - loggedBefore;
+        m.report("webprintf/1 gorev", n, bytes);
+        printf("    %llu satir -> %llu WebSocket cercevesi\n", (unsigned long long)n, (unsigned long long)(webSocket.hostFramesSent() - framesBefore));
+        CHECK(bytes > n * 30);
+    }
+    {
+        const int threads = 4;
+        uint64_t n = iterations(500000) / threads * threads;
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        uint32_t droppedBefore = WebSerial.bytesDropped();
+        Measure m;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([helper, n, threads, t]() {
+                for (uint64_t i = 0; i < n / threads; i++) { helper->webPrintf("[%d] satir %u\n", t, (unsigned)i); }
+            });
+        }
+        for (auto& worker : workers) { worker.join(); }
+        WebSerial.flush();
+        m.report("webprintf/4 gorev", n, WebSerial.bytesLogged() - loggedBefore);
+        CHECK(WebSerial.bytesDropped() == droppedBefore);
+    }
+    {
+        // 1 numaralı istemci okumayı bırakır; soketi dolunca ona yazılmamalı, 0 numaralı istemci etkilenmemeli
+        webSocket.hostConnect(1);
+        webSocket.hostPauseReading(1, true);
+        WebSerial.flush();
+        uint64_t n = iterations(500000);
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        uint64_t fastBefore = webSocket.hostBytesSent(0);
+        uint64_t blockedBefore = webSocket.hostBlockedWrites();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            helper->webPrintf(line, (unsigned)i, (unsigned)(i * 7));
+            if (i % 64 == 0) { helper->loop(); }
+        }
+        WebSerial.flush();
+        uint64_t bytes = WebSerial.bytesLogged() - loggedBefore;
+        m.report("webprintf/yavas istemci", n, bytes);
+        WebSerialClientStats slow = WebSerial.clientStats(1);
+        printf("    yavas istemci: %u takilma, %u bayt atildi, en fazla %u bayt kuyruk\n",
+               (unsigned)slow.stalls, (unsigned)slow.bytesDropped, (unsigned)slow.peakDepth);
+        CHECK(webSocket.hostBytesSent(0) - fastBefore == bytes);
+        CHECK(webSocket.hostBlockedWrites() == blockedBefore);
+        CHECK(slow.stalls > 0 && slow.bytesDropped > 0 && slow.peakDepth <= WEBSERIAL_CLIENT_QUEUE_SIZE);
+
+        // Okumaya dönen istemci kuyruğunda bekleyenleri alır
+        webSocket.hostPauseReading(1, false);
+        WebSerial.flush();
+        CHECK(WebSerial.clientStats(1).depth == 0);
+
+        webSocket.hostPauseReading(1, true);
+        WebSerial.setClientPolicy(1, WEBSERIAL_DISCONNECT);
+        for (int i = 0; i < 400; i++) { helper->webPrintf(line, (unsigned)i, 0u); }
+        WebSerial.flush();
+        helper->loop();
+        CHECK(!webSocket.clientIsConnected(1) && WebSerial.evictions() > 0);
+        CHECK(webSocket.hostBlockedWrites() == blockedBefore);
+    }
+    destroyHelper(helper);
+}
+
+static void benchDispatch() {
+    const size_t counts[] = {1, 16, 64, 255};
+    for (int binary = 0; binary < 2; binary++) {
+        for (size_t count : counts) {
+            char name[48];
+            snprintf(name, sizeof(name), "ws_dispatch/%s %u buton", binary ? "ikili" : "metin", (unsigned)count);
+            if (!selected(name)) { continue; }
+            ESP32Helper* helper = createHelper(count, BTN_BUTTON);
+            std::vector<std::string> commands;
+            for (size_t i = 0; i < count; i++) {
+                if (binary) { commands.push_back(std::string{(char)CMD_BUTTON, (char)i, 1}); }
+                else { commands.push_back("BTN_CLICK:btn_" + std::to_string(i) + ":1"); }
+            }
+            uint64_t n = iterations(1000000);
+            uint32_t before = buttonEvents;
+            Measure m;
+            for (uint64_t i = 0; i < n; i++) {
+                const std::string& command = commands[i % count];
+                webSocket.hostReceive(0, binary ? WStype_BIN : WStype_TEXT, (const uint8_t*)command.data(), command.size());
+                // Olay kuyruğu taşmadan uygulama tarafı boşaltır
+                if ((i & 7) == 7) { helper->loop(); }
+            }
+            helper->loop();
+            m.report(name, n);
+            CHECK(buttonEvents - before == n);
+            CHECK(helper->droppedEvents() == 0);
+            if (!binary) {
+                // 2^64 size_t'de 0'a taşar; sınırı geçen dizin 0. butona tıklamamalı
+                const char overflow[] = "BTN_CLICK:18446744073709551616:1";
+                before = buttonEvents;
+                webSocket.hostReceive(0, WStype_TEXT, (const uint8_t*)overflow, sizeof(overflow) - 1);
+                helper->loop();
+                CHECK(buttonEvents == before);
+            }
+            destroyHelper(helper);
+        }
+    }
+}
+
+// Seviyeli log: uzun satır yığına düşmez, kapalı seviyeler biçimlendirilmez, hedef eşikleri ayrıdır
+static void benchLog() {
+    if (!selected("log/")) { return; }
+    ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+    WebSerial.flush();
+    uint64_t n = iterations(500000);
+    {
+        // 128 baytlık eski yığın tamponunu aşan satır
+        static const char longLine[] = "sensor=%u deger=%u durum=tamam aciklama=bu satir eski 128 baytlik yigin tamponuna sigmadigi icin "
+                                       "her cagrida malloc ve ikinci bir vsnprintf gerektiriyordu\n";
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        HostHeapStats heap = hostHeapStats();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            helper->webPrintf(longLine, (unsigned)i, (unsigned)(i * 7));
+            if (i % 64 == 0) { helper->loop(); }
+        }
+        WebSerial.flush();
+        m.report("log/uzun satir", n, WebSerial.bytesLogged() - loggedBefore);
+        CHECK(hostHeapStats().allocations == heap.allocations);
+    }
+    {
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) { HELPER_LOGV("ayrinti %u\n", (unsigned)i); }
+        m.report("log/derlemede kapali (LOGV)", n);
+        CHECK(WebSerial.bytesLogged() == loggedBefore);
+    }
+    {
+        for (int sink = 0; sink < LOG_SINK_COUNT; sink++) { WebSerial.setLevel((LogSink)sink, HELPER_LOG_WARN); }
+        uint32_t loggedBefore = WebSerial.bytesLogged();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) { HELPER_LOGI("bilgi %u\n", (unsigned)i); }
+        m.report("log/calisirken kapali (LOGI)", n);
+        CHECK(WebSerial.bytesLogged() == loggedBefore);
+    }
+
+    std::string captured[WEBSOCKETS_SERVER_CLIENT_MAX];
+    webSocket.hostOnSend([&captured](int num, bool binary, const uint8_t* payload, size_t length) {
+        if (num >= 0 && !binary) { captured[num].append((const char*)payload, length); }
+    });
+
+    // Panele yalnızca uyarılar gider; geçmiş bilgi satırlarını da tutar ve yeni panel onları alır
+    WebSerial.setLevel(LOG_SINK_WEBSOCKET, HELPER_LOG_WARN);
+    WebSerial.setLevel(LOG_SINK_HISTORY, HELPER_LOG_INFO);
+    captured[0].clear();
+    HELPER_LOGI("gecmise giden bilgi\n");
+    HELPER_LOGW("herkese giden uyari\n");
+    WebSerial.flush();
+    CHECK(captured[0].find("bilgi") == std::string::npos);
+    CHECK(captured[0].find("] W herkese giden uyari\n") != std::string::npos && captured[0][0] == '[');
+    captured[1].clear();
+    webSocket.hostConnect(1);
+    WebSerial.flush();
+    CHECK(captured[1].find("] I gecmise giden bilgi\n") != std::string::npos);
+    size_t first = captured[1].find("herkese giden uyari");
+    CHECK(first != std::string::npos && captured[1].find("herkese giden uyari", first + 1) == std::string::npos);
+    // Karşılama satırı geçmişten sonra gelir
+    static const char welcome[] = "ESP32'ye Hosgeldiniz!";
+    CHECK(captured[1].size() > sizeof(welcome) && captured[1].compare(captured[1].size() - (sizeof(welcome) - 1), std::string::npos, welcome) == 0);
+
+    // Sığmayan satır kırpılır ve satır sonu korunur
+    for (int sink = 0; sink < LOG_SINK_COUNT; sink++) { WebSerial.setLevel((LogSink)sink, HELPER_LOG_INFO); }
+    captured[0].clear();
+    std::string wide(WEBSERIAL_LINE_SIZE * 2, 'x');
+    helper->webPrintf("%s\n", wide.c_str());
+    WebSerial.flush();
+    CHECK(captured[0].size() == WEBSERIAL_LINE_SIZE - 1 && captured[0].compare(captured[0].size() - 4, 4, "...\n") == 0);
+
+    webSocket.hostOnSend(nullptr);
+    destroyHelper(helper);
+}
+
+// Yazılan başına tahmini fiziksel yazma; rate > 0 ise bu hızda (B/sn) aynı desenle yazılınca bölümün
+// aşınma dengelemesiyle dayanacağı süre
+static void reportWear(const char* name, const LogStoreStats& before, const LogStoreStats& after, double rate) {
+    double written = after.bytesWritten - before.bytesWritten;
+    double erases = after.blockErases - before.blockErases;
+    printf("%-34s yazma carpani %.2f, %u senkron, MB basina %.0f silme", name, (after.flashBytes - before.flashBytes) / written,
+           (unsigned)(after.syncs - before.syncs), erases / written * 1024 * 1024);
+    if (rate > 0) {
+        double erasesPerYear = erases / written * rate * 365 * 24 * 3600;
+        printf(", %.0f B/sn'de ~%.1f yil", rate, (double)(LittleFS.totalBytes() / LOG_STORE_BLOCK_SIZE) * LOG_STORE_ERASE_CYCLES / erasesPerYear);
+    }
+    printf("\n");
+}
+
+// Flash log deposu: toplu yazmanın aşınmaya etkisi, dönen segmentler, Range ile indirme ve
+// yeniden başlatmadan sonra aynı segmentlerden devam
+static void benchLogStore() {
+    if (!selected("logstore/")) { return; }
+    LittleFS.hostReset();
+    ESP32Helper* helper = createHelper(0, BTN_BUTTON, [](ESP32Helper* h) { h->enableLogStore(); });
+    LogStore& store = helper->logStore();
+    CHECK(store.isRunning());
+    // Kısa modda da tüm segmentler dolup en eskisi silinsin
+    uint64_t n = quick ? 4000 : 200000;
+    {
+        LogStoreStats before = store.stats();
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            helper->webPrintf("sensor=%u deger=%u durum=tamam\n", (unsigned)i, (unsigned)(i * 7));
+            if (i % 16 == 0) { helper->loop(); }
+        }
+        store.flush();
+        const LogStoreStats& after = store.stats();
+        m.report("logstore/surekli akis", n, after.bytesWritten - before.bytesWritten);
+        reportWear("logstore/surekli akis", before, after, 0);
+        CHECK(after.bytesDropped == 0 && after.writeErrors == 0);
+        CHECK(after.bytesWritten == after.bytesLogged && store.pending() == 0);
+        // Senkron yalnızca segment değişiminde; yazma çarpanı 1'e yakın
+        CHECK(after.syncs - before.syncs <= after.rotations - before.rotations + 1);
+        CHECK(after.flashBytes - before.flashBytes < (after.bytesWritten - before.bytesWritten) * 11 / 10);
+        CHECK(after.rotations > 0 && store.last() - store.first() + 1 == LOG_STORE_SEGMENTS);
+        CHECK(!store.openSegment(store.first() - 1) && !LittleFS.exists(LOG_STORE_DIR "/1.log"));
+    }
+    {
+        // 100 B/sn'lik akışta LOG_STORE_FLUSH_MS (30 sn) dolunca senkron: ~3000 baytta bir
+        uint64_t lines = n / 4;
+        LogStoreStats before = store.stats();
+        uint32_t since = 0;
+        for (uint64_t i = 0; i < lines; i++) {
+            helper->webPrintf("sensor=%u deger=%u durum=tamam\n", (unsigned)i, (unsigned)(i * 7));
+            if (store.stats().bytesLogged - since >= 3000) { since = store.stats().bytesLogged; store.flush(); }
+        }
+        store.flush();
+        reportWear("logstore/30 sn'de bir senkron", before, store.stats(), 100);
+    }
+    {
+        // Karşılaştırma: her satırdan sonra senkron (toplu yazma olmadan; her satır acil olsaydı)
+        uint64_t lines = n / 10;
+        LogStoreStats before = store.stats();
+        Measure m;
+        for (uint64_t i = 0; i < lines; i++) {
+            helper->webPrintf("sensor=%u deger=%u durum=tamam\n", (unsigned)i, (unsigned)(i * 7));
+            store.flush();
+        }
+        const LogStoreStats& after = store.stats();
+        m.report("logstore/satir basina senkron", lines, after.bytesWritten - before.bytesWritten);
+        reportWear("logstore/satir basina senkron", before, after, 100);
+        CHECK(after.syncs - before.syncs == lines);
+    }
+
+    // Range ile indirme; tam segment ilk (en eski) segmenttir
+    HostResponse list = server.hostRequest(HTTP_GET, "/logs");
+    CHECK(list.code == 200 && list.body.find("\"segments\":[{\"id\":") != std::string::npos);
+    char path[32];
+    snprintf(path, sizeof(path), "/logs?id=%u", (unsigned)store.first());
+    HostResponse full = server.hostRequest(HTTP_GET, path);
+    size_t size = full.body.size();
+    CHECK(full.code == 200 && size >= LOG_STORE_SEGMENT_SIZE && full.header("Accept-Ranges") == "bytes");
+    HostResponse part = server.hostRequest(HTTP_GET, path, {{"Range", "bytes=10-19"}});
+    char expected[48];
+    snprintf(expected, sizeof(expected), "bytes 10-19/%u", (unsigned)size);
+    CHECK(part.code == 206 && part.body == full.body.substr(10, 10) && part.header("Content-Range") == expected);
+    HostResponse suffix = server.hostRequest(HTTP_GET, path, {{"Range", "bytes=-5"}});
+    CHECK(suffix.code == 206 && suffix.body == full.body.substr(size - 5));
+    char from[32];
+    snprintf(from, sizeof(from), "bytes=%u-", (unsigned)(size - 3));
+    HostResponse tail = server.hostRequest(HTTP_GET, path, {{"Range", from}});
+    CHECK(tail.code == 206 && tail.body == full.body.substr(size - 3));
+    snprintf(from, sizeof(from), "bytes=%u-", (unsigned)size);
+    CHECK(server.hostRequest(HTTP_GET, path, {{"Range", from}}).code == 416);
+    CHECK(server.hostRequest(HTTP_GET, path, {{"Range", "bytes=0-1,5-6"}}).code == 200);
+    CHECK(server.hostRequest(HTTP_GET, "/logs?id=999999").code == 404);
+    CHECK(server.hostRequest(HTTP_GET, "/metrics").body.find("esp32helper_logstore_write_amplification ") != std::string::npos);
+
+    // Hata satırı toplu yazmayı beklemez; /restart yazılmamış satırları flash'a verir
+    struct Restarted {};
+    ESP.hostOnRestart([]() { throw Restarted(); });
+    HELPER_LOGE("kritik hata\n");
+    helper->loop();
+    CHECK(store.pending() == 0);
+    helper->webPrintf("yeniden baslatmadan once son satir\n");
+    CHECK(store.pending() > 0);
+    server.hostRequest(HTTP_GET, "/restart");
+    bool restarted = false;
+    for (int i = 0; i < 50 && !restarted; i++) {
+        try { helper->loop(); } catch (const Restarted&) { restarted = true; }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ESP.hostOnRestart(nullptr);
+    CHECK(restarted && store.pending() == 0);
+    uint32_t first = store.first(), last = store.last();
+    destroyHelper(helper);
+
+    helper = createHelper(0, BTN_BUTTON, [](ESP32Helper* h) { h->enableLogStore(); });
+    LogStore& reopened = helper->logStore();
+    reopened.flush();
+    CHECK(reopened.first() == first && reopened.last() == last);
+    snprintf(path, sizeof(path), "/logs?id=%u", (unsigned)reopened.last());
+    std::string segment = server.hostRequest(HTTP_GET, path).body;
+    size_t before = segment.find("yeniden baslatmadan once son satir\n");
+    CHECK(segment.find("] E kritik hata\n") != std::string::npos);
+    CHECK(before != std::string::npos && segment.find("--- acilis ---\n", before) != std::string::npos);
+    destroyHelper(helper);
+    LittleFS.hostReset();
+}
+
+// begin() sonrasında buton/anahtar yolu yığına dokunmamalı: komut çözme, bit dizisi, delta ve geri çağrı
+static void benchControls() {
+    if (!selected("controls/")) { return; }
+    ESP32Helper* helper = createHelper(HELPER_MAX_CONTROLS, BTN_SWITCH);
+    CHECK(helper->addButton("Fazla", BTN_BUTTON, [](bool) {}) == -1);
+    // Shim'in alım tamponu ilk uzun komutta büyür; ölçümden önce en uzun komut bir kez gönderilir
+    const char warmup[] = "BTN_CLICK:btn_254:0";
+    webSocket.hostReceive(0, WStype_TEXT, (const uint8_t*)warmup, sizeof(warmup) - 1);
+    helper->loop();
+    WebSerial.flush();
+    uint64_t n = iterations(1000000);
+    uint32_t before = buttonEvents;
+    HostHeapStats heap = hostHeapStats();
+    Measure m;
+    for (uint64_t i = 0; i < n; i++) {
+        uint8_t id = (uint8_t)(i % HELPER_MAX_CONTROLS);
+        bool on = (i / HELPER_MAX_CONTROLS) % 2 == 0;
+        if (i & 1) {
+            const uint8_t command[3] = {CMD_BUTTON, id, (uint8_t)on};
+            webSocket.hostReceive(0, WStype_BIN, command, sizeof(command));
+        } else {
+            char command[24];
+            int len = snprintf(command, sizeof(command), "BTN_CLICK:btn_%u:%d", (unsigned)id, on ? 1 : 0);
+            webSocket.hostReceive(0, WStype_TEXT, (const uint8_t*)command, len);
+        }
+        if ((i & 7) == 7) { helper->loop(); }
+    }
+    helper->loop();
+    m.report("controls/anahtar degisimi", n);
+    CHECK(hostHeapStats().allocations == heap.allocations);
+    CHECK(helper->droppedEvents() == 0);
+    CHECK(buttonEvents - before > 0);
+    CHECK(!helper->buttonState(-1) && !helper->buttonState(HELPER_MAX_CONTROLS));
+
+    // Bit dizisindeki durum /api/state'e yansır
+    const uint8_t on[3] = {CMD_BUTTON, 37, 1};
+    const uint8_t off[3] = {CMD_BUTTON, 38, 0};
+    webSocket.hostReceive(0, WStype_BIN, on, sizeof(on));
+    webSocket.hostReceive(0, WStype_BIN, off, sizeof(off));
+    helper->loop();
+    CHECK(helper->buttonState(37) && !helper->buttonState(38));
+    HostResponse response = server.hostRequest(HTTP_GET, "/api/state");
+    CHECK(response.body.find("{\"name\":\"Buton 37\",\"type\":1,\"state\":true}") != std::string::npos);
+    CHECK(response.body.find("{\"name\":\"Buton 38\",\"type\":1,\"state\":false}") != std::string::npos);
+
+    // Okumayan panelin kutusu taşınca bekleyen değişiklikler atılır, yerine tek bir yeniden yükleme isteği gider
+    int resyncs = 0;
+    webSocket.hostOnSend([&resyncs](int num, bool binary, const uint8_t* payload, size_t length) {
+        if (num == 1 && binary && length == 1 && payload[0] == FRAME_STATE_RESYNC) { resyncs++; }
+    });
+    webSocket.hostConnect(1);
+    helper->loop();
+    webSocket.hostPauseReading(1, true);
+    uint64_t blocked = webSocket.hostBlockedWrites();
+    for (int i = 0; i < 200; i++) {
+        const uint8_t toggle[3] = {CMD_BUTTON, 5, (uint8_t)(i & 1)};
+        webSocket.hostReceive(0, WStype_BIN, toggle, sizeof(toggle));
+        helper->loop();
+    }
+    CHECK(webSocket.hostBlockedWrites() == blocked && resyncs == 0);
+    webSocket.hostPauseReading(1, false);
+    helper->loop();
+    CHECK(resyncs == 1);
+    webSocket.hostOnSend(nullptr);
+    destroyHelper(helper);
+}
+
+// Panelin yaptığı gibi FRAME_TELEMETRY çerçevelerini çözer; anahtar çerçeve görülene kadar farklar yok sayılır
+struct TelemetryDecoder {
+    int32_t values[TELEMETRY_MAX_SERIES] = {0};
+    bool keyed = false;
+    uint32_t frames = 0, keyframes = 0, lastCount = 0;
+
+    void decode(const uint8_t* p, size_t length) {
+        if (length < 6 || p[0] != FRAME_TELEMETRY) { return; }
+        bool key = p[1] & Telemetry::FLAG_KEYFRAME;
+        frames++; keyframes += key; lastCount = 0;
+        if (key) { keyed = true; }
+        if (!keyed) { return; }
+        for (size_t i = 6; i < length;) {
+            uint8_t id = p[i++];
+            uint32_t raw = 0;
+            for (int shift = 0; i < length; shift += 7) {
+                raw |= (uint32_t)(p[i] & 0x7f) << shift;
+                if (!(p[i++] & 0x80)) { break; }
+            }
+            int32_t value = (int32_t)((raw >> 1) ^ (0u - (raw & 1)));
+            values[id] = key ? value : (int32_t)((uint32_t)values[id] + (uint32_t)value);
+            lastCount++;
+        }
+    }
+};
+
+static const size_t telemetryChannels = 32;
+
+static void addTelemetrySeries(ESP32Helper* helper) {
+    static char names[telemetryChannels][12];
+    for (size_t i = 0; i < telemetryChannels; i++) {
+        snprintf(names[i], sizeof(names[i]), "Kanal %u", (unsigned)i);
+        helper->addSeries(names[i], "V", 2);
+    }
+}
+
+// Her yinelemede 32 kanalın birer örneği: webPrintf ile metin satırı ya da publish() ile ikili seri
+static void benchTelemetry() {
+    if (!selected("telemetry/")) { return; }
+    uint64_t n = iterations(200000);
+    {
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        Measure m;
+        for (uint64_t i = 0; i < n; i++) {
+            for (size_t ch = 0; ch < telemetryChannels; ch++) { helper->webPrintf("k%u=%.2f\n", (unsigned)ch, (double)(i + ch) * 0.01); }
+            helper->loop();
+        }
+        m.report("telemetry/webPrintf 32 kanal", n);
+        destroyHelper(helper);
+    }
+
+    ESP32Helper* helper = createHelper(0, BTN_BUTTON, addTelemetrySeries);
+    TelemetryDecoder decoder;
+    TelemetryDecoder slow;
+    webSocket.hostOnSend([&decoder, &slow](int num, bool binary, const uint8_t* payload, size_t length) {
+        if (binary && num == 0) { decoder.decode(payload, length); }
+        if (binary && num == 1) { slow.decode(payload, length); }
+    });
+    helper->setTelemetryRate(100);
+    WebSerial.flush();
+    HostHeapStats heap = hostHeapStats();
+    Measure m;
+    for (uint64_t i = 0; i < n; i++) {
+        for (size_t ch = 0; ch < telemetryChannels; ch++) { helper->publish(ch, (float)(i + ch) * 0.01f); }
+        helper->loop();
+    }
+    m.report("telemetry/publish 32 kanal", n);
+    CHECK(hostHeapStats().allocations == heap.allocations);
+    CHECK(helper->droppedSamples() == 0);
+
+    // Periyottaki örnekler ortalanır; yalnızca yeni örneği olan seriler farkla gönderilir
+    delay(11);
+    helper->loop();
+    for (size_t ch = 0; ch < telemetryChannels; ch++) { helper->publish(ch, 1.25f + ch); helper->publish(ch, 1.75f + ch); }
+    delay(11);
+    helper->loop();
+    bool averaged = true;
+    for (size_t ch = 0; ch < telemetryChannels; ch++) { averaged &= decoder.values[ch] == (int32_t)(150 + ch * 100); }
+    CHECK(decoder.keyed && averaged);
+    helper->publish(3, -2.5f);
+    delay(11);
+    helper->loop();
+    CHECK(decoder.lastCount == 1 && decoder.values[3] == -250 && decoder.values[4] == 550);
+
+    // Yeni panel bağlanınca sonraki çerçeve tüm serilerin mutlak değerleriyle gelir
+    uint32_t keyframes = decoder.keyframes;
+    webSocket.hostConnect(1);
+    helper->publish(0, 0.0f);
+    delay(11);
+    helper->loop();
+    CHECK(decoder.keyframes == keyframes + 1 && decoder.lastCount == telemetryChannels && decoder.values[0] == 0);
+
+    // Okumayan panelin soketi dolar: ona yazılmaz, bekleyen farkın yerini yenisi alınca anahtar çerçeve beklenir.
+    // Okumaya dönünce değerleri hızlı panelinkiyle aynıdır.
+    webSocket.hostPauseReading(1, true);
+    uint64_t blocked = webSocket.hostBlockedWrites();
+    for (int i = 0; i < 40; i++) {
+        for (size_t ch = 0; ch < telemetryChannels; ch++) { helper->publish(ch, (float)(i * 3 + ch) * 0.5f); }
+        delay(11);
+        helper->loop();
+    }
+    CHECK(webSocket.hostBlockedWrites() == blocked);
+    webSocket.hostPauseReading(1, false);
+    for (int i = 0; i < 3; i++) {
+        for (size_t ch = 0; ch < telemetryChannels; ch++) { helper->publish(ch, 7.0f + ch); }
+        delay(11);
+        helper->loop();
+    }
+    bool same = slow.keyed;
+    for (size_t ch = 0; ch < telemetryChannels; ch++) { same &= slow.values[ch] == decoder.values[ch] && decoder.values[ch] == (int32_t)(700 + ch * 100); }
+    CHECK(same);
+    HostResponse metrics = server.hostRequest(HTTP_GET, "/metrics");
+    CHECK(metrics.body.find("esp32helper_ws_panel_frames_dropped_total 0\n") == std::string::npos);
+    HostResponse response = server.hostRequest(HTTP_GET, "/api/state");
+    CHECK(response.body.find("\"telemetry\":{\"hz\":100,\"series\":[{\"name\":\"Kanal 0\",\"unit\":\"V\",\"dec\":2}") != std::string::npos);
+    webSocket.hostOnSend(nullptr);
+    destroyHelper(helper);
+}
+
+static std::vector<uint8_t> makeImage(size_t size, uint32_t seed) {
+    std::vector<uint8_t> image(size);
+    uint32_t x = seed;
+    for (size_t i = 0; i < size; i++) { x = x * 1664525u + 1013904223u; image[i] = (uint8_t)(x >> 24); }
+    image[0] = ESP_IMAGE_HEADER_MAGIC;
+    return image;
+}
+
+static std::string sha256Hex(const uint8_t* data, size_t size) {
+    uint8_t digest[32];
+    mbedtls_sha256(data, size, digest, 0);
+    char hex[65];
+    for (int i = 0; i < 32; i++) { snprintf(hex + i * 2, 3, "%02x", digest[i]); }
+    return hex;
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) { out.push_back((uint8_t)(value >> (8 * i))); }
+}
+
+static std::vector<uint8_t> gzipData(const std::vector<uint8_t>& data) {
+    z_stream stream = {};
+    deflateInit2(&stream, 6, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    std::vector<uint8_t> out(deflateBound(&stream, data.size()) + 32);
+    stream.next_in = const_cast<uint8_t*>(data.data());
+    stream.avail_in = data.size();
+    stream.next_out = out.data();
+    stream.avail_out = out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+static bool writeChunks(FirmwareWriter& writer, const std::vector<uint8_t>& data, size_t chunkSize) {
+    bool ok = true;
+    for (size_t offset = 0; ok && offset < data.size(); offset += chunkSize) {
+        ok = writer.write(data.data() + offset, data.size() - offset < chunkSize ? data.size() - offset : chunkSize);
+    }
+    return ok;
+}
+
+// tools/ota_server.py'nin süreç içi karşılığı; URL OTA gerçek HTTPClient ve soket üzerinden çalışır.
+// HEAD/GET'e x-firmware-version, ETag, x-firmware-sha256 ve Content-Length ile cevap verir: If-None-Match
+// eşleşirse 304, Range ile birlikte eşleşen (ya da hiç) If-Range gelirse 206, aksi halde tam imaj (200).
+// dropAfter > 0 ise ilk GET o kadar bayt gönderildikten sonra kesilir.
+struct OtaRequest {
+    std::string method, range, ifRange, ifNoneMatch;
+    int code;
+};
+
+class OtaServer {
+public:
+    ~OtaServer() { stop(); }
+
+    bool start() {
+        _fd = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in local = {};
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t size = sizeof(local);
+        if (_fd < 0 || bind(_fd, (struct sockaddr*)&local, sizeof(local)) != 0 || listen(_fd, 4) != 0 ||
+            getsockname(_fd, (struct sockaddr*)&local, &size) != 0) { return false; }
+        _port = ntohs(local.sin_port);
+        _running = true;
+        _thread = std::thread([this]() { run(); });
+        return true;
+    }
+    void stop() {
+        _running = false;
+        if (_thread.joinable()) { _thread.join(); }
+        if (_fd >= 0) { close(_fd); _fd = -1; }
+    }
+    std::string url() const { return "http://127.0.0.1:" + std::to_string(_port) + "/fw.bin"; }
+
+    // Sunulan dosya; indirme sürerken değiştirilebilir
+    void publish(const std::vector<uint8_t>& body, const std::string& etag, const std::string& sha256, const char* version = "2.0.0") {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _body = body; _etag = etag; _sha256 = sha256; _version = version;
+    }
+    void dropAfter(size_t bytes) { std::lock_guard<std::mutex> lock(_mutex); _dropAfter = bytes; }
+    std::vector<OtaRequest> requests() { std::lock_guard<std::mutex> lock(_mutex); return _requests; }
+    size_t drops() { std::lock_guard<std::mutex> lock(_mutex); return _drops; }
+
+private:
+    void run() {
+        while (_running) {
+            struct pollfd p = {_fd, POLLIN, 0};
+            if (poll(&p, 1, 20) <= 0) { continue; }
+            int client = accept(_fd, nullptr, nullptr);
+            if (client < 0) { continue; }
+            serve(client);
+            close(client);
+        }
+    }
+
+    static std::string header(const std::string& request, const char* name) {
+        std::string key = std::string("\r\n") + name + ":";
+        auto it = std::search(request.begin(), request.end(), key.begin(), key.end(),
+                              [](char a, char b) { return tolower(a) == tolower(b); });
+        if (it == request.end()) { return std::string(); }
+        size_t start = request.find_first_not_of(' ', (it - request.begin()) + key.size());
+        return request.substr(start, request.find("\r\n", start) - start);
+    }
+
+    static bool sendAll(int fd, const void* data, size_t length) {
+        const char* p = (const char*)data;
+        while (length > 0) {
+            ssize_t n = send(fd, p, length, MSG_NOSIGNAL);
+            if (n <= 0) { return false; }
+            p += n; length -= (size_t)n;
+        }
+        return true;
+    }
+
+    void serve(int fd) {
+        std::string request;
+        char buffer[512];
+        while (request.find("\r\n\r\n") == std::string::npos) {
+            struct pollfd p = {fd, POLLIN, 0};
+            if (poll(&p, 1, 1000) <= 0) { return; }
+            ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) { return; }
+            request.append(buffer, (size_t)n);
+        }
+        OtaRequest r = {request.substr(0, request.find(' ')), header(request, "Range"), header(request, "If-Range"),
+                        header(request, "If-None-Match"), 200};
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::vector<uint8_t> body = _body;
+        size_t start = 0;
+        if (!r.ifNoneMatch.empty() && r.ifNoneMatch == _etag) {
+            r.code = 304;
+        } else if (r.range.compare(0, 6, "bytes=") == 0 && (r.ifRange.empty() || r.ifRange == _etag)) {
+            start = strtoul(r.range.c_str() + 6, nullptr, 10);
+            r.code = start < body.size() ? 206 : 416;
+        }
+        std::string head = "HTTP/1.1 " + std::to_string(r.code) + (r.code == 304 ? " Not Modified" : r.code == 416 ? " Range Not Satisfiable" : " OK") + "\r\n";
+        head += "ETag: " + _etag + "\r\n";
+        if (r.code == 200 || r.code == 206) {
+            head += "Content-Length: " + std::to_string(body.size() - start) + "\r\n";
+            head += "x-firmware-version: " + _version + "\r\nx-firmware-sha256: " + _sha256 + "\r\n";
+        } else {
+            head += "Content-Length: 0\r\n";
+            body.clear();
+        }
+        head += "Connection: close\r\n\r\n";
+        size_t length = r.method == "GET" && body.size() > start ? body.size() - start : 0;
+        if (r.method == "GET" && _dropAfter > 0 && length > _dropAfter) {
+            length = _dropAfter;
+            _dropAfter = 0;
+            _drops++;
+        }
+        _requests.push_back(r);
+        lock.unlock();
+        if (sendAll(fd, head.data(), head.size()) && length > 0) { sendAll(fd, body.data() + start, length); }
+    }
+
+    int _fd = -1;
+    uint16_t _port = 0;
+    std::atomic<bool> _running{false};
+    std::thread _thread;
+    std::mutex _mutex;
+    std::vector<uint8_t> _body;
+    std::string _etag, _sha256, _version;
+    size_t _dropAfter = 0;
+    size_t _drops = 0;
+    std::vector<OtaRequest> _requests;
+};
+
+struct HostRestart {};
+
+// URL OTA bitip cihaz yeniden başlatılana kadar loop() çağrılır; ESP.restart() süreci sonlandırmak yerine
+// buraya döner. Süre dolarsa false
+static bool loopUntilRestart(ESP32Helper* helper, unsigned long timeoutMs) {
+    ESP.hostOnRestart([]() { throw HostRestart(); });
+    bool restarted = false;
+    unsigned long start = millis();
+    try {
+        while (millis() - start < timeoutMs) { helper->loop(); }
+    } catch (const HostRestart&) {
+        restarted = true;
+    }
+    ESP.hostOnRestart(nullptr);
+    return restarted;
+}
+
+static void benchOtaWrite() {
+    const size_t imageSize = quick ? 64 * 1024 : 1024 * 1024;
+    const int rounds = quick ? 1 : 5;
+    std::vector<uint8_t> image = makeImage(imageSize, 1);
+    std::string digest = sha256Hex(image.data(), image.size());
+
+    if (selected("ota_write/ham")) {
+        FirmwareWriter writer;
+        Measure m;
+        for (int r = 0; r < rounds; r++) {
+            bool ok = writer.begin(image.size(), digest.c_str());
+            for (size_t offset = 0; ok && offset < image.size(); offset += URL_OTA_CHUNK_SIZE) {
+                size_t chunk = image.size() - offset < URL_OTA_CHUNK_SIZE ? image.size() - offset : URL_OTA_CHUNK_SIZE;
+                ok = writer.write(image.data() + offset, chunk);
+            }
+            CHECK(ok && writer.end());
+        }
+        m.report("ota_write/ham 1460B parca", rounds, (uint64_t)rounds * image.size());
+        CHECK(Update.hostImage() == image);
+    }
+
+    if (selected("ota_write/delta")) {
+        // Yarısı çalışan imajdan kopyalanan, yarısı yeni veri olan bir yama
+        std::vector<uint8_t> base = makeImage(imageSize, 2);
+        std::vector<uint8_t> target(base.begin(), base.begin() + imageSize / 2);
+        target.insert(target.end(), image.begin() + imageSize / 2, image.end());
+        hostSetRunningImage(base.data(), base.size());
+        std::vector<uint8_t> patch(DELTA_MAGIC, DELTA_MAGIC + 4);
+        putU32(patch, target.size());
+        uint8_t targetDigest[32];
+        mbedtls_sha256(target.data(), target.size(), targetDigest, 0);
+        patch.insert(patch.end(), targetDigest, targetDigest + 32);
+        patch.push_back(0x01); putU32(patch, 0); putU32(patch, imageSize / 2);
+        patch.push_back(0x02); putU32(patch, target.size() - imageSize / 2);
+        patch.insert(patch.end(), target.begin() + imageSize / 2, target.end());
+        patch.push_back(0x00);
+
+        FirmwareWriter writer;
+        Measure m;
+        for (int r = 0; r < rounds; r++) {
+            bool ok = writer.begin(patch.size(), nullptr);
+            for (size_t offset = 0; ok && offset < patch.size(); offset += URL_OTA_CHUNK_SIZE) {
+                size_t chunk = patch.size() - offset < URL_OTA_CHUNK_SIZE ? patch.size() - offset : URL_OTA_CHUNK_SIZE;
+                ok = writer.write(patch.data() + offset, chunk);
+            }
+            CHECK(ok && writer.end() && writer.isDelta());
+        }
+        m.report("ota_write/delta %50 kopya", rounds, (uint64_t)rounds * target.size());
+        CHECK(Update.hostImage() == target);
+    }
+
+    if (selected("ota_write/gzip")) {
+        // Yarısı tekrarlı, yarısı rastgele bir imaj; gzip başlığında dosya adı alanı da bulunur
+        std::vector<uint8_t> compressible = image;
+        for (size_t i = 1; i < compressible.size(); i++) {
+            if ((i / 4096) % 2) { compressible[i] = (uint8_t)(i & 0x3F); }
+        }
+        std::vector<uint8_t> gz = gzipData(compressible);
+        gz[3] |= 0x08;
+        gz.insert(gz.begin() + 10, {'f', 'w', '.', 'b', 'i', 'n', 0});
+        std::string gzDigest = sha256Hex(compressible.data(), compressible.size());
+        FirmwareWriter writer;
+        Measure m;
+        for (int r = 0; r < rounds; r++) {
+            CHECK(writer.begin(UPDATE_SIZE_UNKNOWN, gzDigest.c_str()) && writeChunks(writer, gz, HTTP_UPLOAD_BUFLEN));
+            CHECK(writer.isCompressed() && writer.end());
+        }
+        m.report("ota_write/gzip acma", rounds, (uint64_t)rounds * compressible.size());
+        printf("    %u bayt gzip -> %u bayt imaj\n", (unsigned)gz.size(), (unsigned)compressible.size());
+        CHECK(Update.hostImage() == compressible);
+
+        // Kesik akış end()'de reddedilir
+        CHECK(writer.begin(UPDATE_SIZE_UNKNOWN, nullptr));
+        writer.write(gz.data(), gz.size() / 2);
+        CHECK(!writer.end() && strcmp(writer.error(), "Gzip verisi eksik") == 0);
+
+        // URL OTA'da Content-Length sıkıştırılmış boyuttur; açılan imaj ondan büyük olsa da yazılabilmelidir
+        OtaServer ota;
+        ota.publish(gz, "\"gz-1\"", gzDigest);
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        Measure url;
+        CHECK(server.hostRequest(HTTP_POST, "/urlupdate", {}, {{"url", ota.url().c_str()}}).code == 303);
+        CHECK(loopUntilRestart(helper, 10000));
+        url.report("ota_write/gzip url", 1, compressible.size());
+        CHECK(Update.hostCommits() == commits + 1 && Update.hostImage() == compressible);
+        destroyHelper(helper);
+    }
+
+    if (selected("ota_pipeline/")) {
+        // Ağdan her 1436 baytlık parça ~280 µs'de gelir, flash KB başına ~200 µs'de yazılır (ikisi de ~5 MB/sn).
+        // Sıralı yolda süreler toplanır, çift tamponda örtüşür.
+        const int pipelineRounds = quick ? 1 : 2;
+        auto receive = []() { delayMicroseconds(280); };
+        Update.hostSetWriteDelay(200);
+        {
+            FirmwareWriter writer;
+            Measure m;
+            for (int r = 0; r < pipelineRounds; r++) {
+                bool ok = writer.begin(UPDATE_SIZE_UNKNOWN, digest.c_str());
+                for (size_t offset = 0; ok && offset < image.size(); offset += HTTP_UPLOAD_BUFLEN) {
+                    receive();
+                    ok = writer.write(image.data() + offset, image.size() - offset < HTTP_UPLOAD_BUFLEN ? image.size() - offset : HTTP_UPLOAD_BUFLEN);
+                }
+                CHECK(ok && writer.end());
+            }
+            m.report("ota_pipeline/sirali", pipelineRounds, (uint64_t)pipelineRounds * image.size());
+        }
+        {
+            FirmwareWriter writer;
+            FirmwarePipeline pipeline(writer);
+            Measure m;
+            for (int r = 0; r < pipelineRounds; r++) {
+                bool ok = pipeline.begin(UPDATE_SIZE_UNKNOWN, digest.c_str());
+                for (size_t offset = 0; ok && offset < image.size(); offset += HTTP_UPLOAD_BUFLEN) {
+                    receive();
+                    ok = pipeline.write(image.data() + offset, image.size() - offset < HTTP_UPLOAD_BUFLEN ? image.size() - offset : HTTP_UPLOAD_BUFLEN);
+                }
+                CHECK(ok && pipeline.end());
+            }
+            m.report("ota_pipeline/cift tampon", pipelineRounds, (uint64_t)pipelineRounds * image.size());
+            CHECK(Update.hostImage() == image);
+
+            // Yazıcıyı başka bir güncelleme kullanıyorsa hat onu devralmaz, süren yazım tamamlanabilir
+            CHECK(writer.begin(UPDATE_SIZE_UNKNOWN, digest.c_str()) && writer.write(image.data(), image.size() / 2));
+            CHECK(!pipeline.begin(UPDATE_SIZE_UNKNOWN, nullptr) && strcmp(pipeline.error(), "Baska bir guncelleme suruyor") == 0);
+            CHECK(writer.isRunning() && writer.write(image.data() + image.size() / 2, image.size() - image.size() / 2) && writer.end());
+        }
+        Update.hostSetWriteDelay(0);
+    }
+
+    if (selected("ota_write/web")) {
+        // /update yeniden başlattığı için yükleme işleyicisi kayıtsız bir adres üzerinden çalıştırılır
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        Measure m;
+        for (int r = 0; r < rounds; r++) {
+            HostResponse response = server.hostUpload("/bench-upload", "firmware.bin", image.data(), image.size());
+            CHECK(response.code == 404);
+        }
+        m.report("ota_write/web yukleme", rounds, (uint64_t)rounds * image.size());
+        CHECK(Update.hostImage() == image);
+
+        // Hatalı imaj /update yanıtında bildirilir ve cihaz yeniden başlatılmaz
+        std::vector<uint8_t> corrupt = image;
+        corrupt[0] = 0;
+        HostResponse response = server.hostUpload("/update", "firmware.bin", corrupt.data(), corrupt.size());
+        CHECK(response.code == 500 && response.body.find("Wrong Magic Byte") != std::string::npos);
+        destroyHelper(helper);
+    }
+}
+
+// loop() koşul sağlanana ya da süre dolana kadar çağrılır
+static bool loopUntil(ESP32Helper* helper, const std::function<bool()>& done, unsigned long timeoutMs) {
+    unsigned long start = millis();
+    while (!done()) {
+        if (millis() - start >= timeoutMs) { return false; }
+        helper->loop();
+    }
+    return true;
+}
+
+static bool otaFailed(uint32_t count) {
+    char line[96];
+    snprintf(line, sizeof(line), "esp32helper_ota_updates_total{method=\"url\",result=\"failure\"} %u\n", (unsigned)count);
+    return server.hostRequest(HTTP_GET, "/metrics").body.find(line) != std::string::npos;
+}
+
+// URL OTA durum makinesi: koşullu kontrol, kesilen indirmenin sürdürülmesi, değişen dosya ve özet hatası
+static void benchUrlOta() {
+    if (!selected("url_ota/")) { return; }
+    std::vector<uint8_t> image = makeImage(quick ? 64 * 1024 : 512 * 1024, 4);
+    std::string digest = sha256Hex(image.data(), image.size());
+    auto startUpdate = [](OtaServer& ota) {
+        return server.hostRequest(HTTP_POST, "/urlupdate", {}, {{"url", ota.url().c_str()}}).code == 303;
+    };
+
+    if (selected("url_ota/304")) {
+        // Sürüm aynıysa ETag saklanır; sonraki kontrol If-None-Match ile 304 alır ve hiçbir şey indirilmez
+        OtaServer ota;
+        ota.publish(image, "\"a\"", digest, "1.0.0");
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        CHECK(startUpdate(ota) && loopUntil(helper, [&]() { return ota.requests().size() == 1; }, 2000));
+        ota.publish(image, "\"a\"", digest, "2.0.0");
+        CHECK(startUpdate(ota) && loopUntil(helper, [&]() { return ota.requests().size() == 2; }, 2000));
+        for (int i = 0; i < 10; i++) { helper->loop(); }
+        std::vector<OtaRequest> requests = ota.requests();
+        CHECK(requests.size() == 2 && requests[0].method == "HEAD" && requests[0].code == 200);
+        CHECK(requests.size() == 2 && requests[1].method == "HEAD" && requests[1].ifNoneMatch == "\"a\"" && requests[1].code == 304);
+        CHECK(Update.hostCommits() == commits);
+        destroyHelper(helper);
+    }
+
+    if (selected("url_ota/resume")) {
+        // İlk GET üçte birde kesilir; ikinci GET kalan kısmı Range ve If-Range ile ister
+        OtaServer ota;
+        ota.publish(image, "\"a\"", digest);
+        ota.dropAfter(image.size() / 3);
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        Measure m;
+        CHECK(startUpdate(ota) && loopUntilRestart(helper, 10000));
+        m.report("url_ota/resume kesik indirme", 1, image.size());
+        std::vector<OtaRequest> requests = ota.requests();
+        std::string range = "bytes=" + std::to_string(image.size() / 3) + "-";
+        CHECK(requests.size() == 3 && requests[1].method == "GET" && requests[1].range.empty() && requests[1].code == 200);
+        CHECK(requests.size() == 3 && requests[2].range == range && requests[2].ifRange == "\"a\"" && requests[2].code == 206);
+        CHECK(Update.hostCommits() == commits + 1 && Update.hostImage() == image);
+        destroyHelper(helper);
+    }
+
+    if (selected("url_ota/if-range")) {
+        // Kesintiden sonra dosya değişir: If-Range eşleşmez, sunucu yeni dosyanın tamamını gönderir ve
+        // yarım imaj atılıp yeni dosya baştan yazılır
+        std::vector<uint8_t> changed = makeImage(image.size() + 1000, 5);
+        OtaServer ota;
+        ota.publish(image, "\"a\"", digest);
+        ota.dropAfter(image.size() / 3);
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        CHECK(startUpdate(ota) && loopUntil(helper, [&]() { return ota.drops() > 0; }, 2000));
+        ota.publish(changed, "\"b\"", sha256Hex(changed.data(), changed.size()));
+        CHECK(loopUntilRestart(helper, 10000));
+        std::vector<OtaRequest> requests = ota.requests();
+        CHECK(requests.size() == 3 && requests[2].ifRange == "\"a\"" && requests[2].code == 200);
+        CHECK(Update.hostCommits() == commits + 1 && Update.hostImage() == changed);
+        destroyHelper(helper);
+    }
+
+    if (selected("url_ota/sha")) {
+        // Bildirilen özet tutmazsa imaj uygulanmaz ve cihaz yeniden başlatılmaz
+        OtaServer ota;
+        ota.publish(image, "\"a\"", sha256Hex(image.data(), image.size() - 1));
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        CHECK(startUpdate(ota) && loopUntil(helper, []() { return otaFailed(1); }, 10000));
+        CHECK(Update.hostCommits() == commits && !Update.isRunning());
+        destroyHelper(helper);
+    }
+
+    if (selected("url_ota/exclusive")) {
+        // Web ve URL OTA aynı FirmwareWriter'ı kullanır: biri sürerken diğeri başlamaz, süren bozulmaz
+        std::vector<uint8_t> uploaded = makeImage(image.size(), 6);
+        OtaServer ota;
+        ota.publish(image, "\"a\"", digest);
+        ota.dropAfter(image.size() / 3);
+        CHECK(ota.start());
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        uint32_t commits = Update.hostCommits();
+        CHECK(startUpdate(ota) && loopUntil(helper, [&]() { return ota.drops() > 0; }, 2000));
+        HostResponse response = server.hostUpload("/update", "firmware.bin", uploaded.data(), uploaded.size());
+        CHECK(response.code == 409 && response.body.find("URL OTA suruyor") != std::string::npos);
+        CHECK(loopUntilRestart(helper, 10000));
+        CHECK(Update.hostCommits() == commits + 1 && Update.hostImage() == image);
+        destroyHelper(helper);
+
+        // Yükleme sürerken gelen /urlupdate indirmeyi başlatmaz
+        OtaServer idle;
+        idle.publish(image, "\"a\"", digest);
+        CHECK(idle.start());
+        helper = createHelper(0, BTN_BUTTON);
+        commits = Update.hostCommits();
+        server.hostOnUploadChunk([&](size_t chunk) { if (chunk == 2) { startUpdate(idle); } });
+        response = server.hostUpload("/update", "firmware.bin", uploaded.data(), uploaded.size());
+        server.hostOnUploadChunk(nullptr);
+        CHECK(response.code == 200);
+        CHECK(loopUntilRestart(helper, 2000));
+        CHECK(idle.requests().empty());
+        CHECK(Update.hostCommits() == commits + 1 && Update.hostImage() == uploaded);
+        destroyHelper(helper);
+    }
+
+    if (selected("url_ota/connect")) {
+        // SYN'leri cevaplanmayan sunucu: kuyruğu dolu bir dinleme soketi. Kontrol loop()'u
+        // URL_OTA_CONNECT_TIMEOUT_MS kadar bekletir, URL_OTA_TIMEOUT_MS kadar değil
+        int listener = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in local = {};
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t size = sizeof(local);
+        bind(listener, (struct sockaddr*)&local, sizeof(local));
+        listen(listener, 0);
+        getsockname(listener, (struct sockaddr*)&local, &size);
+        std::vector<int> fillers;
+        for (int i = 0; i < 4; i++) {
+            fillers.push_back(socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0));
+            connect(fillers.back(), (struct sockaddr*)&local, sizeof(local));
+        }
+        ESP32Helper* helper = createHelper(0, BTN_BUTTON);
+        std::string url = "http://127.0.0.1:" + std::to_string(ntohs(local.sin_port)) + "/fw.bin";
+        CHECK(server.hostRequest(HTTP_POST, "/urlupdate", {}, {{"url", url.c_str()}}).code == 303);
+        unsigned long start = millis();
+        helper->loop();
+        unsigned long elapsed = millis() - start;
+        printf("    ulasilamayan sunucu: loop() %lu ms\n", elapsed);
+        CHECK(elapsed < URL_OTA_CONNECT_TIMEOUT_MS + 500);
+        destroyHelper(helper);
+        for (int fd : fillers) { close(fd); }
+        close(listener);
+    }
+}
+
+static void benchSpsc() {
+    if (!selected("spsc/")) { return; }
+    SpscQueue<uint32_t, 1024> queue;
+    const uint32_t n = (uint32_t)iterations(20000000);
+    bool ordered = true;
+    Measure m;
+    std::thread producer([&queue, n]() {
+        for (uint32_t i = 0; i < n; i++) {
+            while (!queue.push(i)) { std::this_thread::yield(); }
+        }
+    });
+    uint32_t expected = 0;
+    uint32_t value;
+    while (expected < n) {
+        if (!queue.pop(value)) { std::this_thread::yield(); continue; }
+        if (value != expected) { ordered = false; }
+        expected++;
+    }
+    producer.join();
+    m.report("spsc/2 is parcacigi", n, (uint64_t)n * sizeof(uint32_t));
+    CHECK(ordered);
+    CHECK(queue.empty());
+
+    // Dolu kuyruk öğeyi reddeder ve kaybı sayar
+    SpscQueue<uint32_t, 4> small;
+    for (uint32_t i = 0; i < 4; i++) { CHECK(small.push(i)); }
+    CHECK(!small.push(4));
+    CHECK(small.dropped() == 1);
+    CHECK(small.pop(value) && value == 0);
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) { quick = true; }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) { filter = argv[++i]; }
+        else { fprintf(stderr, "Kullanim: %s [--quick] [--filter <ad>]\n", argv[0]); return 2; }
+    }
+    printf("%-34s %9s %11s %13s %9s %9s\n", "olcum", "yineleme", "ns/yin.", "yin./sn", "MB/sn", "ayirma");
+    Serial.hostEcho(getenv("ECHO") != nullptr); // Kurulum logları ölçüm tablosuna karışmasın
+    benchStateJson();
+    benchPanel();
+    benchProvision();
+    benchMetrics();
+    benchWebPrintf();
+    benchLog();
+    benchLogStore();
+    benchDispatch();
+    benchControls();
+    benchTelemetry();
+    benchOtaWrite();
+    benchUrlOta();
+    benchSpsc();
+    if (failures > 0) { fprintf(stderr, "%d dogrulama basarisiz\n", failures); return 1; }
+    return 0;
+}
@@ -0,0 +1,133 @@
+// extras/host/bench/footprint.cpp
+// Bir özellik yapılandırmasının (HELPER_FEATURE_*) bellek, kod ve açılış maliyeti. CMakeLists her yapılandırma
+// için kütüphaneyi ayrı derler ve bu programı ona bağlar (esp32helper_footprint_<ad>); bağlama cihazdaki gibi
+// --gc-sections ile yapılır, kullanılmayan kütüphane ve shim kodu imaja girmez.
+//
+//   esp32helper_footprint_<ad> [--quick]
+//
+// Boyutlar x86-64 içindir (işaretçiler 8 bayt, komutlar Xtensa'dan farklı); yapılandırmalar arasındaki
+// farklar karşılaştırılabilir. Açılış süresi begin()'in masaüstündeki süresidir: LittleFS bağlama ve
+// ArduinoOTA'nın mDNS'i gibi cihaz maliyetleri shim'de yoktur. Hangi yolların var olduğu da doğrulanır.
+// Bu çıktı cihaz raporu değildir: Xtensa imaj boyutu ve cihazdaki açılış süresi burada ölçülemez.
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <unistd.h>
+
+#include <ESP32Helper.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include "HostShim.h"
+
+extern HelperWebServer server;
+#if HELPER_WEBSOCKET
+extern HelperSocketServer webSocket;
+#endif
+
+static int failures = 0;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "HATA %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+static void resetHost(bool credentials) {
+    server.hostReset();
+#if HELPER_WEBSOCKET
+    webSocket.hostReset();
+#endif
+    WiFi.hostReset();
+    Preferences::hostReset();
+    if (!credentials) { return; }
+    Preferences prefs;
+    prefs.begin("esp32helper");
+    prefs.putString("ssid", "footprint");
+    prefs.putString("password", "12345678");
+    prefs.end();
+}
+
+// Kendi imajının text/data/bss boyutları (binutils size)
+static bool imageSize(unsigned long& text, unsigned long& data, unsigned long& bss) {
+    char path[512];
+    ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (length <= 0) { return false; }
+    path[length] = 0;
+    char command[600];
+    snprintf(command, sizeof(command), "size '%s' 2>/dev/null", path);
+    FILE* pipe = popen(command, "r");
+    if (!pipe) { return false; }
+    char line[600];
+    bool found = fgets(line, sizeof(line), pipe) && fgets(line, sizeof(line), pipe) && sscanf(line, "%lu %lu %lu", &text, &data, &bss) == 3;
+    pclose(pipe);
+    return found;
+}
+
+int main(int argc, char** argv) {
+    bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+    int runs = quick ? 5 : 200;
+    WebSerial.setLevel(LOG_SINK_SERIAL, HELPER_LOG_NONE); // Açılış logları ölçümü bastırmasın
+
+    // Kayıtlı ağla açılış: begin() süresi ve yaptığı yığın ayırmaları
+    std::vector<double> times;
+    uint64_t heapBytes = 0, heapAllocations = 0;
+    for (int i = 0; i < runs; i++) {
+        resetHost(true);
+        ESP32Helper* helper = new ESP32Helper("footprint", "1.0.0");
+        HostHeapStats before = hostHeapStats();
+        auto start = std::chrono::steady_clock::now();
+        helper->begin();
+        times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        HostHeapStats after = hostHeapStats();
+        heapBytes = after.bytes - before.bytes;
+        heapAllocations = after.allocations - before.allocations;
+        helper->loop();
+        WebSerial.flush();
+        server.hostReset();
+        delete helper;
+    }
+    std::sort(times.begin(), times.end());
+
+    // Derlenen özelliklerin yolları vardır, derlenmeyenlerin 404 döner
+    resetHost(false);
+    ESP32Helper* helper = new ESP32Helper("footprint", "1.0.0");
+    helper->begin();
+    helper->loop();
+    // Kayıtlı ağ yok: AP modundadır, kök adres her yapılandırmada gzip'li kurulum sayfasıdır
+    HostResponse root = server.hostRequest(HTTP_GET, "/");
+    CHECK(root.code == 200 && root.header("Content-Encoding") == "gzip");
+    CHECK(server.hostRequest(HTTP_GET, "/api/scan").code == 200);
+    CHECK((server.hostRequest(HTTP_GET, "/panel").code == 200) == (bool)HELPER_FEATURE_PANEL);
+    CHECK((server.hostRequest(HTTP_GET, "/api/state").code == 200) == (bool)HELPER_FEATURE_PANEL);
+    CHECK((server.hostRequest(HTTP_GET, "/metrics").code == 200) == (bool)HELPER_FEATURE_METRICS);
+    CHECK((server.hostRequest(HTTP_POST, "/urlupdate").code != 404) == (bool)HELPER_FEATURE_URL_OTA);
+    CHECK((server.hostRequest(HTTP_POST, "/update").code != 404) == (bool)HELPER_FEATURE_WEB_OTA);
+#if HELPER_FEATURE_CAPTIVE_DNS
+    CHECK(helper->captiveDns().isRunning());
+#endif
+    // AP modundan kurulum her yapılandırmada vardır; yeniden başlatmadan bağlanılır
+    HostResponse saved = server.hostRequest(HTTP_POST, "/savewifi", {}, {{"ssid", "saha"}, {"password", "12345678"}});
+    CHECK(saved.code == 200 && helper->config().getString("ssid") == "saha");
+    helper->loop();
+    CHECK(server.hostRequest(HTTP_GET, "/api/wifi").body.find("\"state\":\"online\"") != std::string::npos);
+    server.hostReset();
+    delete helper;
+
+    unsigned long text = 0, data = 0, bss = 0;
+    bool sized = imageSize(text, data, bss);
+    printf("%-12s  imaj text %7lu  data+bss %6lu  ESP32Helper %5u  WebSerial %5u  begin() %6.1f us (medyan)  begin() yigin %5llu bayt / %llu ayirma\n",
+           FOOTPRINT_NAME, sized ? text : 0, sized ? data + bss : 0, (unsigned)sizeof(ESP32Helper), (unsigned)sizeof(WebSerial_),
+           times[times.size() / 2], (unsigned long long)heapBytes, (unsigned long long)heapAllocations);
+    printf("              (x86-64 masaustu olcumu; cihaz imaj boyutu ve acilis suresi degildir)\n");
+    printf("              ozellikler: panel=%d webserial=%d arduino_ota=%d web_ota=%d url_ota=%d metrics=%d log_store=%d captive_dns=%d\n",
+           HELPER_FEATURE_PANEL, HELPER_FEATURE_WEBSERIAL, HELPER_FEATURE_ARDUINO_OTA, HELPER_FEATURE_WEB_OTA,
+           HELPER_FEATURE_URL_OTA, HELPER_FEATURE_METRICS, HELPER_FEATURE_LOG_STORE, HELPER_FEATURE_CAPTIVE_DNS);
+    if (failures > 0) {
+        fprintf(stderr, "%d dogrulama basarisiz\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,469 @@
+// extras/host/bench/loadtest.cpp
+// Web sunucusunun gerçek geri döngü soketleri üzerinden yük testi. Aynı kaynak iki kez derlenir:
+// esp32helper_loadtest Arduino WebServer'ın taklidini (tek bağlantı, keep-alive yok), esp32helper_loadtest_engine
+// HttpEngine'i (HELPER_HTTP_ENGINE=1) ölçer. Cihaz döngüsü tek iş parçacığında, istemciler ayrı iş parçacıklarında
+// çalışır; mutlak sayılar cihazdan yüksektir, iki sunucunun farkı karşılaştırılabilir.
+//
+//   esp32helper_loadtest[_engine] [--quick]
+//
+// Senaryolar:
+//   state      : N istemci art arda /api/state ister; sunucu izin veriyorsa bağlantı yeniden kullanılır
+//   yavas      : aynı yük, bu sırada bir istemci isteğini bayt bayt gönderir (zayıf WiFi'deki telefon gibi)
+//   panel      : /panel (gzip) ve /metrics (chunked) karışık
+//   websocket  : (yalnızca motor) aynı portta /ws yükseltmesi, karşılama çerçevesi ve komut
+//   yavas okuyan: (yalnızca motor) istemciler /metrics ve /logs ister, bir süre okumaz; gövde okundukça
+//                 üretildiği için bağlantıların çıkış tamponları küçük kalır ve cevaplar eksiksiz gelir
+//
+// Doğrulama başarısız olursa program 1 ile çıkar.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <strings.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ESP32Helper.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include "HostShim.h"
+
+#if HELPER_HTTP_ENGINE
+extern HttpEngine server;
+static const char* const serverName = "HttpEngine";
+#else
+extern HelperWebServer server;
+static const char* const serverName = "WebServer";
+#endif
+
+static bool quick = false;
+static int failures = 0;
+static std::atomic<uint32_t> messageEvents(0);
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "HATA %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+typedef std::chrono::steady_clock Clock;
+
+// --- Basit HTTP/1.1 istemcisi ---
+
+struct Response {
+    int code = 0;
+    bool close = false;
+    std::string encoding;
+    std::string body;
+};
+
+class Client {
+public:
+    explicit Client(uint16_t port) : _port(port) {}
+    ~Client() { disconnect(); }
+
+    // receiveBuffer > 0 ise alma penceresi küçülür; okumayan istemcide sunucunun soketi çabuk dolar
+    bool connect(int receiveBuffer = 0) {
+        disconnect();
+        _fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (_fd < 0) { return false; }
+        int one = 1;
+        setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (receiveBuffer > 0) { setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer)); }
+        struct timeval timeout = {15, 0};
+        setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(_port);
+        if (::connect(_fd, (struct sockaddr*)&address, sizeof(address)) < 0) { disconnect(); return false; }
+        connects++;
+        return true;
+    }
+
+    void disconnect() {
+        if (_fd >= 0) { close(_fd); }
+        _fd = -1;
+        _rx.clear();
+    }
+
+    bool sendAll(const char* data, size_t length) {
+        while (length > 0) {
+            ssize_t n = send(_fd, data, length, MSG_NOSIGNAL);
+            if (n <= 0) { return false; }
+            data += n;
+            length -= (size_t)n;
+        }
+        return true;
+    }
+
+    // Sunucu bağlantıyı kapattıysa (keep-alive yok) yeni bağlantıyla bir kez daha dener
+    bool get(const char* path, Response& response) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            bool reused = _fd >= 0;
+            if (!reused && !connect()) { return false; }
+            std::string request = "GET ";
+            request += path;
+            request += " HTTP/1.1\r\nHost: esp32\r\nAccept-Encoding: gzip\r\n\r\n";
+            if (sendAll(request.data(), request.size()) && readResponse(response)) {
+                if (response.close) { disconnect(); }
+                return true;
+            }
+            disconnect();
+            if (!reused) { return false; }
+        }
+        return false;
+    }
+
+    bool readResponse(Response& response) {
+        response = Response();
+        size_t end;
+        while ((end = _rx.find("\r\n\r\n")) == std::string::npos) {
+            if (!fill()) { return false; }
+        }
+        std::string head = _rx.substr(0, end + 2);
+        _rx.erase(0, end + 4);
+        if (head.compare(0, 9, "HTTP/1.1 ") != 0 && head.compare(0, 9, "HTTP/1.0 ") != 0) { return false; }
+        response.code = atoi(head.c_str() + 9);
+        long length = -1;
+        bool chunked = false;
+        for (size_t line = head.find("\r\n") + 2; line < head.size();) {
+            size_t next = head.find("\r\n", line);
+            std::string field = head.substr(line, next - line);
+            line = next + 2;
+            size_t colon = field.find(':');
+            if (colon == std::string::npos) { continue; }
+            std::string name = field.substr(0, colon);
+            std::string value = field.substr(field.find_first_not_of(' ', colon + 1));
+            if (strcasecmp(name.c_str(), "Content-Length") == 0) { length = atol(value.c_str()); }
+            else if (strcasecmp(name.c_str(), "Transfer-Encoding") == 0) { chunked = strcasecmp(value.c_str(), "chunked") == 0; }
+            else if (strcasecmp(name.c_str(), "Connection") == 0) { response.close = strcasecmp(value.c_str(), "close") == 0; }
+            else if (strcasecmp(name.c_str(), "Content-Encoding") == 0) { response.encoding = value; }
+        }
+        if (chunked) {
+            for (;;) {
+                while ((end = _rx.find("\r\n")) == std::string::npos) {
+                    if (!fill()) { return false; }
+                }
+                size_t size = strtoul(_rx.c_str(), nullptr, 16);
+                _rx.erase(0, end + 2);
+                while (_rx.size() < size + 2) {
+                    if (!fill()) { return false; }
+                }
+                response.body.append(_rx, 0, size);
+                _rx.erase(0, size + 2);
+                if (size == 0) { return true; }
+            }
+        }
+        if (length < 0) {
+            // Uzunluk yoksa gövde bağlantı kapanana kadar sürer
+            while (fill()) {}
+            response.body.swap(_rx);
+            response.close = true;
+            return true;
+        }
+        while (_rx.size() < (size_t)length) {
+            if (!fill()) { return false; }
+        }
+        response.body = _rx.substr(0, length);
+        _rx.erase(0, length);
+        return true;
+    }
+
+    bool fill() {
+        char chunk[4096];
+        ssize_t n = recv(_fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) { return false; }
+        _rx.append(chunk, n);
+        return true;
+    }
+
+    int fd() const { return _fd; }
+    std::string& pending() { return _rx; }
+
+    uint32_t connects = 0;
+
+private:
+    uint16_t _port;
+    int _fd = -1;
+    std::string _rx;
+};
+
+// --- Senaryolar ---
+
+struct LoadResult {
+    std::vector<double> latencyMs;
+    uint64_t errors = 0;
+    uint32_t connects = 0;
+    double seconds = 0;
+    uint64_t duringSlow = 0; // Yavaş istemcinin isteği sürerken tamamlanan istekler
+};
+
+static double percentile(std::vector<double>& values, double p) {
+    if (values.empty()) { return 0; }
+    std::sort(values.begin(), values.end());
+    size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+static void report(const char* name, LoadResult& result) {
+    size_t n = result.latencyMs.size();
+    double max = n ? *std::max_element(result.latencyMs.begin(), result.latencyMs.end()) : 0;
+    double p50 = percentile(result.latencyMs, 0.50);
+    double p99 = percentile(result.latencyMs, 0.99);
+    printf("%-28s %8zu %10.0f %9.3f %9.3f %9.1f %9u %7llu\n", name, n, n / result.seconds, p50, p99, max,
+           result.connects, (unsigned long long)result.errors);
+}
+
+// paths istemciler arasında sırayla dağıtılır; slowMs > 0 ise bir istemci isteğini bu süreye yayar
+static LoadResult runLoad(uint16_t port, int clients, double seconds, std::vector<const char*> paths, double slowMs) {
+    LoadResult result;
+    std::vector<LoadResult> partial(clients);
+    std::atomic<bool> slowActive(false);
+    Clock::time_point start = Clock::now();
+    Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+
+    std::thread slow;
+    if (slowMs > 0) {
+        slow = std::thread([&]() {
+            Client client(port);
+            if (!client.connect()) { return; }
+            static const char request[] = "GET /api/state HTTP/1.1\r\nHost: esp32\r\n\r\n";
+            size_t length = sizeof(request) - 1;
+            slowActive = true;
+            for (size_t i = 0; i < length; i++) {
+                if (!client.sendAll(request + i, 1)) { break; }
+                std::this_thread::sleep_for(std::chrono::microseconds((long)(slowMs * 1000 / length)));
+            }
+            Response response;
+            bool ok = client.readResponse(response);
+            slowActive = false;
+            CHECK(ok && response.code == 200);
+        });
+        // Yavaş istemci ilk baytını göndermiş olsun
+        while (!slowActive) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < clients; t++) {
+        threads.emplace_back([&, t]() {
+            LoadResult& mine = partial[t];
+            Client client(port);
+            Response response;
+            for (size_t i = t; Clock::now() < deadline; i++) {
+                const char* path = paths[i % paths.size()];
+                Clock::time_point begin = Clock::now();
+                bool ok = client.get(path, response);
+                Clock::time_point end = Clock::now();
+                if (!ok || response.code != 200 || response.body.empty()) { mine.errors++; continue; }
+                mine.latencyMs.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+                if (slowActive) { mine.duringSlow++; }
+            }
+            mine.connects = client.connects;
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    if (slow.joinable()) { slow.join(); }
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    for (auto& mine : partial) {
+        result.latencyMs.insert(result.latencyMs.end(), mine.latencyMs.begin(), mine.latencyMs.end());
+        result.errors += mine.errors;
+        result.connects += mine.connects;
+        result.duringSlow += mine.duringSlow;
+    }
+    return result;
+}
+
+#if HELPER_HTTP_ENGINE
+// İstemci çerçevesi: maskeli, tek parça
+static std::string clientFrame(uint8_t opcode, const std::string& payload) {
+    std::string frame;
+    frame += (char)(0x80 | opcode);
+    frame += (char)(0x80 | payload.size());
+    const uint8_t mask[4] = {0x12, 0x34, 0x56, 0x78};
+    frame.append((const char*)mask, 4);
+    for (size_t i = 0; i < payload.size(); i++) { frame += (char)(payload[i] ^ mask[i & 3]); }
+    return frame;
+}
+
+// Sunucu çerçevesini okur; opcode ve yük döner
+static bool readFrame(Client& client, uint8_t& opcode, std::string& payload) {
+    std::string& rx = client.pending();
+    while (rx.size() < 2) { if (!client.fill()) { return false; } }
+    size_t length = (uint8_t)rx[1] & 0x7f;
+    size_t header = 2;
+    if (length == 126) {
+        while (rx.size() < 4) { if (!client.fill()) { return false; } }
+        length = ((size_t)(uint8_t)rx[2] << 8) | (uint8_t)rx[3];
+        header = 4;
+    }
+    while (rx.size() < header + length) { if (!client.fill()) { return false; } }
+    opcode = (uint8_t)rx[0] & 0x0f;
+    payload = rx.substr(header, length);
+    rx.erase(0, header + length);
+    return true;
+}
+
+static void testWebSocket(uint16_t port) {
+    Client client(port);
+    CHECK(client.connect());
+    // RFC 6455 örnek anahtarı ve beklenen cevabı
+    static const char upgrade[] = "GET " HTTP_ENGINE_WS_PATH " HTTP/1.1\r\nHost: esp32\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                                  "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    CHECK(client.sendAll(upgrade, sizeof(upgrade) - 1));
+    std::string& rx = client.pending();
+    while (rx.find("\r\n\r\n") == std::string::npos) { if (!client.fill()) { break; } }
+    size_t end = rx.find("\r\n\r\n");
+    std::string head = rx.substr(0, end);
+    rx.erase(0, end + 4);
+    CHECK(head.compare(0, 12, "HTTP/1.1 101") == 0);
+    CHECK(head.find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") != std::string::npos);
+
+    bool welcome = false;
+    uint8_t opcode;
+    std::string payload;
+    for (int i = 0; i < 20 && !welcome && readFrame(client, opcode, payload); i++) {
+        welcome = opcode == 0x1 && payload == "ESP32'ye Hosgeldiniz!";
+    }
+    CHECK(welcome);
+
+    uint32_t before = messageEvents;
+    std::string frame = clientFrame(0x1, "MSG:merhaba");
+    CHECK(client.sendAll(frame.data(), frame.size()));
+    for (int i = 0; i < 200 && messageEvents == before; i++) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+    CHECK(messageEvents == before + 1);
+
+    // Aynı portta WebSocket açıkken HTTP istekleri cevaplanmaya devam eder
+    Client http(port);
+    Response response;
+    CHECK(http.get("/api/state", response) && response.code == 200);
+    CHECK(response.body.find("\"ws\":\"" HTTP_ENGINE_WS_PATH "\"") != std::string::npos);
+
+    frame = clientFrame(0x8, std::string("\x03\xe8", 2));
+    CHECK(client.sendAll(frame.data(), frame.size()));
+    bool closed = false;
+    for (int i = 0; i < 50 && !closed && readFrame(client, opcode, payload); i++) { closed = opcode == 0x8; }
+    CHECK(closed);
+    printf("%-28s aynı portta yükseltme, karşılama, komut ve kapatma doğrulandı\n", "websocket");
+}
+
+// İsteyip okumayan istemciler: cevaplar soketleri dolunca bekler, diğer istemciler cevap almaya devam eder;
+// okumaya başlayınca gövde eksiksiz gelir
+static void testSlowReader(uint16_t port, int clients, uint32_t segment) {
+    std::string metrics = "GET /metrics HTTP/1.1\r\nHost: esp32\r\n\r\n";
+    std::string logs = "GET /logs?id=" + std::to_string(segment) + " HTTP/1.1\r\nHost: esp32\r\n\r\n";
+    std::vector<Client*> readers;
+    for (int i = 0; i < clients; i++) {
+        Client* reader = new Client(port);
+        const std::string& request = i == 0 ? logs : metrics;
+        CHECK(reader->connect(1024) && reader->sendAll(request.data(), request.size()));
+        readers.push_back(reader);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    Client http(port);
+    Response response;
+    CHECK(http.get("/api/state", response) && response.code == 200);
+
+    size_t bytes = 0;
+    for (int i = 0; i < clients; i++) {
+        bool ok = readers[i]->readResponse(response) && response.code == 200;
+        if (i == 0) { CHECK(ok && response.body.size() >= LOG_STORE_SEGMENT_SIZE); }
+        else { CHECK(ok && response.body.find("esp32helper_ota_updates_total") != std::string::npos); }
+        bytes += response.body.size();
+        delete readers[i];
+    }
+    printf("%-28s %d istemci, %u KB cevap okumadan bekletildi ve eksiksiz alındı\n", "yavas okuyan", clients, (unsigned)(bytes / 1024));
+}
+#endif
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) { quick = true; }
+        else { fprintf(stderr, "Kullanim: %s [--quick]\n", argv[0]); return 2; }
+    }
+    Serial.hostEcho(false);
+    Preferences prefs;
+    prefs.begin("esp32helper");
+    prefs.putString("ssid", "loadtest");
+    prefs.putString("password", "12345678");
+    prefs.end();
+#if !HELPER_HTTP_ENGINE
+    server.hostListen();
+#endif
+    ESP32Helper* helper = new ESP32Helper("loadtest", "1.0.0", [](String message) { messageEvents += message.length() > 0; });
+    for (int i = 0; i < 8; i++) {
+        static const char* const names[] = {"Role 1", "Role 2", "Role 3", "Role 4", "Fan", "Pompa", "Isik", "Alarm"};
+        helper->addButton(names[i], BTN_SWITCH, [](bool) {});
+    }
+    helper->enableLogStore();
+    helper->begin();
+    // Okumayan istemci senaryosu için en az bir dolu log segmenti
+    for (int i = 0; i < 1000; i++) {
+        helper->webPrintf("sensor=%u deger=%u durum=tamam\n", (unsigned)i, (unsigned)(i * 7));
+        if (i % 16 == 0) { helper->loop(); }
+    }
+    helper->logStore().flush();
+    uint16_t port = hostListenPort(80);
+    CHECK(port != 0);
+    if (port == 0) { return 1; }
+
+    std::atomic<bool> running(true);
+    std::thread device([&]() {
+        while (running) { helper->loop(); }
+    });
+
+    const double seconds = quick ? 0.5 : 3.0;
+    const int clients = 4;
+    printf("sunucu: %s, %d istemci, senaryo basina %.1f sn\n", serverName, clients, seconds);
+    printf("%-28s %8s %10s %9s %9s %9s %9s %7s\n", "senaryo", "istek", "istek/sn", "p50 ms", "p99 ms", "max ms", "baglanti", "hata");
+
+    LoadResult state = runLoad(port, clients, seconds, {"/api/state"}, 0);
+    report("state", state);
+    CHECK(state.errors == 0 && !state.latencyMs.empty());
+
+    LoadResult slow = runLoad(port, clients, seconds, {"/api/state"}, seconds * 1000);
+    report("yavas istemci + state", slow);
+    CHECK(slow.errors == 0);
+
+    LoadResult panel = runLoad(port, clients, seconds, {"/panel", "/metrics"}, 0);
+    report("panel + metrics", panel);
+    CHECK(panel.errors == 0 && !panel.latencyMs.empty());
+
+    Client check(port);
+    Response response;
+    CHECK(check.get("/panel", response) && response.code == 200 && response.encoding == "gzip");
+    CHECK(check.get("/metrics", response) && response.body.find("esp32helper_loop_duration_seconds") != std::string::npos);
+
+#if HELPER_HTTP_ENGINE
+    // Keep-alive: her istemci tek bağlantıyla çalışmalı; yavaş istemci diğerlerini bekletmemeli
+    CHECK(state.connects <= (uint32_t)clients * 2);
+    CHECK(slow.duringSlow > 0);
+    testWebSocket(port);
+    testSlowReader(port, clients, helper->logStore().first());
+#else
+    printf("(WebServer her istekten sonra bağlantıyı kapatır; yavaş istemci süresince tamamlanan istek: %llu)\n",
+           (unsigned long long)slow.duringSlow);
+#endif
+
+    running = false;
+    device.join();
+#if HELPER_HTTP_ENGINE
+    // Okumayan istemciler dahil, bağlantı başına en çok bir parça çıkışta bekler
+    printf("cikis tamponu tepe: %u bayt\n", (unsigned)server.outputPeak());
+    CHECK(server.outputPeak() <= (size_t)HTTP_ENGINE_MAX_CLIENTS * HTTP_ENGINE_RESPONSE_PENDING_MAX);
+#endif
+    if (failures > 0) { fprintf(stderr, "%d dogrulama basarisiz\n", failures); return 1; }
+    return 0;
+}
@@ -0,0 +1,246 @@
+// extras/host/shim/Arduino.cpp
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "HostShim.h"
+#include "freertos/queue.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// --- Zaman ---
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+// --- Yığın sayaçları ---
+
+static std::atomic<uint64_t> heapAllocations{0};
+static std::atomic<uint64_t> heapBytes{0};
+
+void hostCountAllocation(size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    heapBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+HostHeapStats hostHeapStats() {
+    HostHeapStats stats;
+    stats.allocations = heapAllocations.load(std::memory_order_relaxed);
+    stats.bytes = heapBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void* operator new(size_t size) {
+    hostCountAllocation(size);
+    void* p = malloc(size ? size : 1);
+    if (!p) { throw std::bad_alloc(); }
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { hostCountAllocation(size); return malloc(size ? size : 1); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { hostCountAllocation(size); return malloc(size ? size : 1); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// --- Print / Stream ---
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (!write(*buffer++)) { break; }
+        n++;
+    }
+    return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char loc_buf[64]; char* temp = loc_buf; va_list arg; va_list copy; va_start(arg, format);
+    va_copy(copy, arg); int len = vsnprintf(temp, sizeof(loc_buf), format, copy); va_end(copy);
+    if (len < 0) { va_end(arg); return 0; }
+    if (len >= (int)sizeof(loc_buf)) {
+        temp = (char*)malloc(len + 1);
+        if (temp == NULL) { va_end(arg); return 0; }
+        hostCountAllocation(len + 1);
+        len = vsnprintf(temp, len + 1, format, arg);
+    }
+    va_end(arg);
+    len = write((const uint8_t*)temp, len);
+    if (temp != loc_buf) { free(temp); }
+    return len;
+}
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    unsigned long start = millis();
+    while (count < length) {
+        int c = read();
+        if (c < 0) {
+            if (millis() - start >= _timeout) { break; }
+            delay(1);
+            continue;
+        }
+        buffer[count++] = (uint8_t)c;
+    }
+    return count;
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", _address.bytes[0], _address.bytes[1], _address.bytes[2], _address.bytes[3]);
+    return String(text);
+}
+
+// --- Serial / ESP ---
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    _bytesWritten += size;
+    if (_echo) { fwrite(buffer, 1, size, stdout); }
+    return size;
+}
+
+void HardwareSerial::flush() { fflush(stdout); }
+
+void EspClass::restart() {
+    if (_onRestart) { _onRestart(); }
+    fprintf(stderr, "ESP.restart() cagrildi, surec sonlandiriliyor.\n");
+    fflush(stdout);
+    exit(0);
+}
+
+uint32_t EspClass::getFreeHeap() { return 320 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 300 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 110 * 1024; }
+
+uint32_t EspClass::getCycleCount() {
+    uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - bootTime).count();
+    return (uint32_t)(ns * 240 / 1000);
+}
+
+// --- FreeRTOS ---
+
+struct HostTask {
+    TaskFunction_t fn;
+    void* arg;
+    BaseType_t core;
+};
+
+struct HostSemaphore {
+    std::timed_mutex mutex;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+static HostTask mainTask = {nullptr, nullptr, 1};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* created, BaseType_t core) {
+    (void)name; (void)stackDepth; (void)priority;
+    HostTask* task = new HostTask{fn, arg, core == tskNO_AFFINITY ? 0 : core};
+    if (created) { *created = task; }
+    std::thread([task]() {
+        currentTask = task;
+        task->fn(task->arg);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                       UBaseType_t priority, TaskHandle_t* created) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, arg, priority, created, tskNO_AFFINITY);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask ? currentTask : &mainTask; }
+
+void vTaskDelay(TickType_t ticks) { delay(ticks * portTICK_PERIOD_MS); }
+
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+    // Görev fonksiyonundan dönmek iş parçacığını bitirir; burada yapılacak bir şey yoktur
+}
+
+TickType_t xTaskGetTickCount() { return (TickType_t)(millis() / portTICK_PERIOD_MS); }
+
+BaseType_t xPortGetCoreID() { return xTaskGetCurrentTaskHandle()->core; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    if (ticks == portMAX_DELAY) { semaphore->mutex.lock(); return pdTRUE; }
+    return semaphore->mutex.try_lock_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    semaphore->mutex.unlock();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+// Öğeler sabit boyutlu bir halka tamponda tutulur; gönderme/alma sırasında bellek ayrılmaz
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<uint8_t> storage;
+    size_t length;
+    size_t itemSize;
+    size_t head = 0;
+    size_t count = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    HostQueue* queue = new HostQueue();
+    queue->storage.resize((size_t)length * itemSize);
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto hasRoom = [queue]() { return queue->count < queue->length; };
+    if (ticks == portMAX_DELAY) { queue->changed.wait(lock, hasRoom); }
+    else if (!queue->changed.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), hasRoom)) { return pdFALSE; }
+    size_t slot = (queue->head + queue->count) % queue->length;
+    memcpy(queue->storage.data() + slot * queue->itemSize, item, queue->itemSize);
+    queue->count++;
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto hasItem = [queue]() { return queue->count > 0; };
+    if (ticks == portMAX_DELAY) { queue->changed.wait(lock, hasItem); }
+    else if (!queue->changed.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), hasItem)) { return pdFALSE; }
+    memcpy(item, queue->storage.data() + queue->head * queue->itemSize, queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->count;
+}
+
+void vQueueDelete(QueueHandle_t queue) { delete queue; }
@@ -0,0 +1,83 @@
+// extras/host/shim/Arduino.h
+// ESP32 Arduino çekirdeğinin kütüphanede kullanılan kısmının masaüstü (Linux) karşılığı.
+// Amaç davranışı değil maliyeti ölçülebilir kılmaktır; donanıma özgü her şey bellekte taklit edilir.
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <functional>
+
+#include "freertos/FreeRTOS.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define FPSTR(p) (p)
+#define F(s) (s)
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define BUILTIN_LED 2
+#define LED_BUILTIN 2
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+// Seri port çıktısı varsayılan olarak stdout'a gider; ölçümlerde hostEcho(false) ile kapatılabilir
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+    operator bool() const { return true; }
+
+    void hostEcho(bool enabled) { _echo = enabled; }
+    uint64_t hostBytesWritten() const { return _bytesWritten; }
+
+private:
+    bool _echo = true;
+    uint64_t _bytesWritten = 0;
+};
+extern HardwareSerial Serial;
+
+// ESP.restart() cihazdaki gibi dönmez; varsayılan olarak süreç sonlandırılır
+class EspClass {
+public:
+    [[noreturn]] void restart();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    // 240 MHz'lik CCOUNT sayacı gibi davranır: monoton saatten türetilir, 32 bitte taşar
+    uint32_t getCycleCount();
+    void hostOnRestart(std::function<void()> handler) { _onRestart = handler; }
+
+private:
+    std::function<void()> _onRestart;
+};
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,38 @@
+// extras/host/shim/ArduinoOTA.h
+// Masaüstünde espota dinlenmez; geri çağrılar yalnızca kaydedilir.
+
+#ifndef HOST_ARDUINOOTA_H
+#define HOST_ARDUINOOTA_H
+
+#include <functional>
+#include "Arduino.h"
+
+typedef enum { OTA_AUTH_ERROR, OTA_BEGIN_ERROR, OTA_CONNECT_ERROR, OTA_RECEIVE_ERROR, OTA_END_ERROR } ota_error_t;
+
+class ArduinoOTAClass {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+    typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+    typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+
+    ArduinoOTAClass& setHostname(const char* hostname) { (void)hostname; return *this; }
+    ArduinoOTAClass& setPort(uint16_t port) { (void)port; return *this; }
+    ArduinoOTAClass& setPassword(const char* password) { (void)password; return *this; }
+    ArduinoOTAClass& onStart(THandlerFunction fn) { _start = fn; return *this; }
+    ArduinoOTAClass& onEnd(THandlerFunction fn) { _end = fn; return *this; }
+    ArduinoOTAClass& onError(THandlerFunction_Error fn) { _error = fn; return *this; }
+    ArduinoOTAClass& onProgress(THandlerFunction_Progress fn) { _progress = fn; return *this; }
+    void begin() { _started = true; }
+    void end() { _started = false; }
+    void handle() {}
+
+private:
+    THandlerFunction _start;
+    THandlerFunction _end;
+    THandlerFunction_Error _error;
+    THandlerFunction_Progress _progress;
+    bool _started = false;
+};
+extern ArduinoOTAClass ArduinoOTA;
+
+#endif
@@ -0,0 +1,107 @@
+// extras/host/shim/HTTPClient.cpp
+
+#include <strings.h>
+
+#include "HTTPClient.h"
+
+bool HTTPClient::begin(const String& url) {
+    end();
+    _requestHeaders.clear();
+    _responseHeaders.clear();
+    _size = -1;
+    if (!url.startsWith("http://")) { return false; }
+    String rest = url.substring(7);
+    int slash = rest.indexOf('/');
+    String authority = slash < 0 ? rest : rest.substring(0, slash);
+    _path = slash < 0 ? String("/") : rest.substring(slash);
+    int colon = authority.indexOf(':');
+    _host = colon < 0 ? authority : authority.substring(0, colon);
+    _port = colon < 0 ? 80 : (uint16_t)authority.substring(colon + 1).toInt();
+    return _host.length() > 0;
+}
+
+void HTTPClient::end() { _client.stop(); }
+
+void HTTPClient::addHeader(const String& name, const String& value, bool first, bool replace) {
+    if (replace) {
+        for (auto& item : _requestHeaders) {
+            if (item.first.equalsIgnoreCase(name)) { item.second = value; return; }
+        }
+    }
+    if (first) { _requestHeaders.insert(_requestHeaders.begin(), std::make_pair(name, value)); }
+    else { _requestHeaders.push_back(std::make_pair(name, value)); }
+}
+
+void HTTPClient::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+    _collect.clear();
+    for (size_t i = 0; i < headerKeysCount; i++) { _collect.push_back(String(headerKeys[i])); }
+}
+
+String HTTPClient::header(const char* name) {
+    for (const auto& item : _responseHeaders) {
+        if (strcasecmp(item.first.c_str(), name) == 0) { return item.second; }
+    }
+    return String();
+}
+
+bool HTTPClient::hasHeader(const char* name) {
+    for (const auto& item : _responseHeaders) {
+        if (strcasecmp(item.first.c_str(), name) == 0) { return true; }
+    }
+    return false;
+}
+
+bool HTTPClient::readLine(String& line) {
+    line = "";
+    char c;
+    while (_client.readBytes(&c, 1) == 1) {
+        if (c == '\n') { return true; }
+        if (c != '\r') { line += c; }
+    }
+    return false;
+}
+
+// Bağlantı her istekte yeniden kurulur (Connection: close); gövde getStreamPtr() ile okunur
+int HTTPClient::sendRequest(const char* type, const uint8_t* payload, size_t size) {
+    _responseHeaders.clear();
+    _size = -1;
+    if (!_client.connect(_host.c_str(), _port, _connectTimeout)) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    _client.setTimeout(_timeout);
+    String request = String(type) + " " + _path + " HTTP/1.1\r\nHost: " + _host + "\r\nUser-Agent: ESP32HTTPClient\r\nConnection: close\r\n";
+    for (const auto& item : _requestHeaders) { request += item.first + ": " + item.second + "\r\n"; }
+    if (payload && size > 0) { request += "Content-Length: " + String((unsigned long)size) + "\r\n"; }
+    request += "\r\n";
+    if (_client.write((const uint8_t*)request.c_str(), request.length()) != request.length()) { return HTTPC_ERROR_SEND_HEADER_FAILED; }
+    if (payload && size > 0 && _client.write(payload, size) != size) { return HTTPC_ERROR_SEND_HEADER_FAILED; }
+
+    String line;
+    if (!readLine(line)) { return HTTPC_ERROR_READ_TIMEOUT; }
+    if (!line.startsWith("HTTP/1.")) { return HTTPC_ERROR_NO_HTTP_SERVER; }
+    int code = line.substring(9, 12).toInt();
+    while (readLine(line) && line.length() > 0) {
+        int colon = line.indexOf(':');
+        if (colon < 0) { continue; }
+        String name = line.substring(0, colon);
+        String value = line.substring(colon + 1);
+        value.trim();
+        if (name.equalsIgnoreCase("Content-Length")) { _size = (int)value.toInt(); }
+        for (const auto& key : _collect) {
+            if (key.equalsIgnoreCase(name)) { _responseHeaders.push_back(std::make_pair(name, value)); break; }
+        }
+    }
+    return code;
+}
+
+String HTTPClient::getString() {
+    String body;
+    if (_size > 0) { body.reserve(_size); }
+    uint8_t buffer[512];
+    size_t remaining = _size >= 0 ? (size_t)_size : (size_t)-1;
+    while (remaining > 0) {
+        size_t n = _client.readBytes(buffer, remaining < sizeof(buffer) ? remaining : sizeof(buffer));
+        if (n == 0) { break; }
+        body.concat((const char*)buffer, n);
+        remaining -= n;
+    }
+    return body;
+}
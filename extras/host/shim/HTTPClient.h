@@ -0,0 +1,67 @@
+// extras/host/shim/HTTPClient.h
+// Düz HTTP/1.1 istemcisi (https ve chunked gövde desteklenmez); tools/ota_server.py ile yerel OTA denemeleri için yeterlidir.
+
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+    HTTP_CODE_OK = 200,
+    HTTP_CODE_NO_CONTENT = 204,
+    HTTP_CODE_PARTIAL_CONTENT = 206,
+    HTTP_CODE_MOVED_PERMANENTLY = 301,
+    HTTP_CODE_FOUND = 302,
+    HTTP_CODE_NOT_MODIFIED = 304,
+    HTTP_CODE_BAD_REQUEST = 400,
+    HTTP_CODE_NOT_FOUND = 404,
+    HTTP_CODE_PRECONDITION_FAILED = 412,
+    HTTP_CODE_RANGE_NOT_SATISFIABLE = 416,
+    HTTP_CODE_INTERNAL_SERVER_ERROR = 500
+} t_http_codes;
+
+class HTTPClient {
+public:
+    bool begin(const String& url);
+    void end();
+    bool connected() { return _client.connected(); }
+
+    void setTimeout(uint16_t timeout) { _timeout = timeout; }
+    void setConnectTimeout(int32_t timeout) { _connectTimeout = timeout; }
+    void addHeader(const String& name, const String& value, bool first = false, bool replace = true);
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+    String header(const char* name);
+    bool hasHeader(const char* name);
+
+    int GET() { return sendRequest("GET"); }
+    int sendRequest(const char* type, const uint8_t* payload = nullptr, size_t size = 0);
+    int getSize() const { return _size; }
+    WiFiClient* getStreamPtr() { return _client.connected() ? &_client : nullptr; }
+    WiFiClient& getStream() { return _client; }
+    String getString();
+
+private:
+    bool readLine(String& line);
+
+    WiFiClient _client;
+    String _host;
+    uint16_t _port = 80;
+    String _path;
+    uint16_t _timeout = 5000;
+    int32_t _connectTimeout = 5000;
+    int _size = -1;
+    std::vector<std::pair<String, String>> _requestHeaders;
+    std::vector<String> _collect;
+    std::vector<std::pair<String, String>> _responseHeaders;
+};
+
+#endif
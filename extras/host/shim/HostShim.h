@@ -0,0 +1,25 @@
+// extras/host/shim/HostShim.h
+// Yalnızca masaüstü derlemesinde bulunan ölçüm ve kurulum kancaları (cihaz kodunda kullanılmaz).
+
+#ifndef HOST_SHIM_H
+#define HOST_SHIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// operator new ve String büyütmeleri dahil yapılan toplam yığın ayırmaları
+struct HostHeapStats {
+    uint64_t allocations;
+    uint64_t bytes;
+};
+HostHeapStats hostHeapStats();
+// Shim içindeki malloc/realloc kullanan yerler (String, printf) tarafından çağrılır
+void hostCountAllocation(size_t size);
+
+// esp_ota_get_running_partition() ve esp_partition_read() bu imajı sunar (delta yamaları için)
+void hostSetRunningImage(const uint8_t* data, size_t size);
+
+// WiFiServer'ın cihazdaki port için geri döngüde bağlandığı gerçek port; dinlenmiyorsa 0
+uint16_t hostListenPort(uint16_t port);
+
+#endif
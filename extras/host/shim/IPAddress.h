@@ -0,0 +1,29 @@
+// extras/host/shim/IPAddress.h
+
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include "WString.h"
+
+// Adres cihazdaki gibi bellek sırasıyla saklanır; uint32_t dönüşümü ağ bayt sırasını korur
+class IPAddress {
+public:
+    IPAddress() { _address.dword = 0; }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { _address.bytes[0] = a; _address.bytes[1] = b; _address.bytes[2] = c; _address.bytes[3] = d; }
+    IPAddress(uint32_t address) { _address.dword = address; }
+
+    operator uint32_t() const { return _address.dword; }
+    bool operator==(const IPAddress& other) const { return _address.dword == other._address.dword; }
+    bool operator!=(const IPAddress& other) const { return _address.dword != other._address.dword; }
+    uint8_t operator[](int index) const { return _address.bytes[index]; }
+    String toString() const;
+
+private:
+    union {
+        uint8_t bytes[4];
+        uint32_t dword;
+    } _address;
+};
+
+#endif
@@ -0,0 +1,194 @@
+// extras/host/shim/LittleFS.cpp
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "LittleFS.h"
+
+fs::LittleFSFS LittleFS;
+
+static std::mutex fsLock;
+static std::map<std::string, std::vector<uint8_t>> files;
+static std::set<std::string> dirs = {"/"};
+
+struct fs::File::Handle {
+    std::string path;
+    std::string name;
+    bool directory = false;
+    bool writable = false;
+    bool append = false;
+    size_t pos = 0;
+    std::vector<std::string> entries; // Dizin içeriği (açıldığı andaki)
+    size_t next = 0;
+};
+
+static std::string normalize(const char* path) {
+    std::string out = path && path[0] == '/' ? path : std::string("/") + (path ? path : "");
+    while (out.size() > 1 && out.back() == '/') { out.pop_back(); }
+    return out;
+}
+
+static std::string parentOf(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == 0 ? "/" : path.substr(0, slash);
+}
+
+namespace fs {
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!_handle || !_handle->writable) { return 0; }
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto it = files.find(_handle->path);
+    if (it == files.end()) { return 0; }
+    std::vector<uint8_t>& data = it->second;
+    if (_handle->append) { _handle->pos = data.size(); }
+    if (_handle->pos + size > data.size()) { data.resize(_handle->pos + size); }
+    memcpy(data.data() + _handle->pos, buffer, size);
+    _handle->pos += size;
+    return size;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    if (!_handle || _handle->directory) { return 0; }
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto it = files.find(_handle->path);
+    if (it == files.end() || _handle->pos >= it->second.size()) { return 0; }
+    size_t count = it->second.size() - _handle->pos;
+    if (count > size) { count = size; }
+    memcpy(buffer, it->second.data() + _handle->pos, count);
+    _handle->pos += count;
+    return count;
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::available() {
+    size_t total = size();
+    return _handle && total > _handle->pos ? (int)(total - _handle->pos) : 0;
+}
+
+void File::flush() {}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!_handle || _handle->directory) { return false; }
+    size_t total = size();
+    size_t target = mode == SeekSet ? pos : mode == SeekCur ? _handle->pos + pos : total + pos;
+    if (target > total) { return false; }
+    _handle->pos = target;
+    return true;
+}
+
+size_t File::position() const { return _handle ? _handle->pos : 0; }
+
+size_t File::size() const {
+    if (!_handle || _handle->directory) { return 0; }
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto it = files.find(_handle->path);
+    return it == files.end() ? 0 : it->second.size();
+}
+
+const char* File::name() const { return _handle ? _handle->name.c_str() : ""; }
+const char* File::path() const { return _handle ? _handle->path.c_str() : ""; }
+bool File::isDirectory() const { return _handle && _handle->directory; }
+
+File File::openNextFile(const char* mode) {
+    if (!_handle || !_handle->directory || _handle->next >= _handle->entries.size()) { return File(); }
+    return LittleFS.open(_handle->entries[_handle->next++].c_str(), mode);
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    std::string full = normalize(path);
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto handle = std::make_shared<File::Handle>();
+    handle->path = full;
+    handle->name = full.substr(full.rfind('/') + 1);
+    if (strcmp(mode, FILE_READ) == 0) {
+        if (dirs.count(full)) {
+            handle->directory = true;
+            for (const auto& dir : dirs) { if (dir != full && parentOf(dir) == full) { handle->entries.push_back(dir); } }
+            for (const auto& file : files) { if (parentOf(file.first) == full) { handle->entries.push_back(file.first); } }
+            return File(handle);
+        }
+        if (!files.count(full)) { return File(); }
+        return File(handle);
+    }
+    if (dirs.count(full)) { return File(); }
+    std::string parent = parentOf(full);
+    if (!dirs.count(parent)) {
+        if (!create) { return File(); }
+        for (std::string dir = parent; dir != "/"; dir = parentOf(dir)) { dirs.insert(dir); }
+    }
+    std::vector<uint8_t>& data = files[full];
+    handle->writable = true;
+    handle->append = strcmp(mode, FILE_APPEND) == 0;
+    if (handle->append) { handle->pos = data.size(); } else { data.clear(); }
+    return File(handle);
+}
+
+bool FS::exists(const char* path) {
+    std::string full = normalize(path);
+    std::lock_guard<std::mutex> guard(fsLock);
+    return files.count(full) || dirs.count(full);
+}
+
+bool FS::remove(const char* path) {
+    std::lock_guard<std::mutex> guard(fsLock);
+    return files.erase(normalize(path)) > 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto it = files.find(normalize(from));
+    if (it == files.end()) { return false; }
+    std::vector<uint8_t> data = std::move(it->second);
+    files.erase(it);
+    files[normalize(to)] = std::move(data);
+    return true;
+}
+
+bool FS::mkdir(const char* path) {
+    std::string full = normalize(path);
+    std::lock_guard<std::mutex> guard(fsLock);
+    if (files.count(full) || !dirs.count(parentOf(full))) { return false; }
+    dirs.insert(full);
+    return true;
+}
+
+bool FS::rmdir(const char* path) {
+    std::string full = normalize(path);
+    std::lock_guard<std::mutex> guard(fsLock);
+    if (full == "/") { return false; }
+    for (const auto& file : files) { if (parentOf(file.first) == full) { return false; } }
+    return dirs.erase(full) > 0;
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    (void)formatOnFail; (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+    _mounted = true;
+    return true;
+}
+
+bool LittleFSFS::format() {
+    hostReset();
+    return true;
+}
+
+size_t LittleFSFS::usedBytes() {
+    std::lock_guard<std::mutex> guard(fsLock);
+    size_t used = 0;
+    for (const auto& file : files) { used += (file.second.size() + 4095) / 4096 * 4096; }
+    return used;
+}
+
+void LittleFSFS::hostReset() {
+    std::lock_guard<std::mutex> guard(fsLock);
+    files.clear();
+    dirs = {"/"};
+}
+
+} // namespace fs
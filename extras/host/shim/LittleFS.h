@@ -0,0 +1,35 @@
+// extras/host/shim/LittleFS.h
+
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "FS.h"
+
+// Varsayılan 4 MB bölümleme düzenindeki "spiffs" bölümünün boyutu
+#ifndef HOST_LITTLEFS_SIZE
+#define HOST_LITTLEFS_SIZE 0x160000
+#endif
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10, const char* partitionLabel = "spiffs");
+    void end() { _mounted = false; }
+    bool format();
+    size_t totalBytes() { return HOST_LITTLEFS_SIZE; }
+    // Dosyalar 4 KB'lık bloklara yuvarlanarak sayılır
+    size_t usedBytes();
+
+    // Tüm dosya ve dizinleri siler
+    static void hostReset();
+
+private:
+    bool _mounted = false;
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,110 @@
+// extras/host/shim/Preferences.cpp
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Preferences.h"
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+static std::mutex storeLock;
+static std::map<std::string, Namespace> store;
+static uint32_t writes = 0;
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+    (void)partitionLabel;
+    if (_started || !name || strlen(name) > 15) { return false; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    if (readOnly && store.find(name) == store.end()) { return false; }
+    store[name];
+    _name = name;
+    _readOnly = readOnly;
+    _started = true;
+    return true;
+}
+
+void Preferences::end() { _started = false; }
+
+bool Preferences::clear() {
+    if (!_started || _readOnly) { return false; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    store[_name.c_str()].clear();
+    writes++;
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!_started || _readOnly) { return false; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    writes++;
+    return store[_name.c_str()].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!_started) { return false; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    Namespace& ns = store[_name.c_str()];
+    return ns.find(key) != ns.end();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    if (!_started || _readOnly || !key || strlen(key) > 15) { return 0; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    const uint8_t* bytes = (const uint8_t*)value;
+    store[_name.c_str()][key].assign(bytes, bytes + length);
+    writes++;
+    return length;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putString(const char* key, const char* value) { return putBytes(key, value, strlen(value) + 1) > 0 ? strlen(value) : 0; }
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!_started) { return 0; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    Namespace& ns = store[_name.c_str()];
+    auto it = ns.find(key);
+    return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    if (!_started) { return 0; }
+    std::lock_guard<std::mutex> guard(storeLock);
+    Namespace& ns = store[_name.c_str()];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.size() > maxLength) { return 0; }
+    memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+    int32_t value;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    uint32_t value;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    size_t length = getBytesLength(key);
+    if (length == 0) { return defaultValue; }
+    std::vector<char> text(length);
+    getBytes(key, text.data(), length);
+    return String(text.data(), length - 1);
+}
+
+void Preferences::hostReset() {
+    std::lock_guard<std::mutex> guard(storeLock);
+    store.clear();
+    writes = 0;
+}
+
+uint32_t Preferences::hostWrites() {
+    std::lock_guard<std::mutex> guard(storeLock);
+    return writes;
+}
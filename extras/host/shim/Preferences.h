@@ -0,0 +1,42 @@
+// extras/host/shim/Preferences.h
+// NVS yerine süreç belleğinde tutulan anahtar/değer deposu; her put çağrısı bir flash yazması sayılır.
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include "Arduino.h"
+
+class Preferences {
+public:
+    // Salt okunur açılışta alan yoksa cihazdaki gibi false döner
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void end();
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putInt(const char* key, int32_t value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putBool(const char* key, bool value) { return putUInt(key, value ? 1 : 0); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char* key, const void* value, size_t length);
+
+    int32_t getInt(const char* key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    bool getBool(const char* key, bool defaultValue = false) { return getUInt(key, defaultValue ? 1 : 0) != 0; }
+    String getString(const char* key, const String& defaultValue = String());
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+
+    // Tüm alanları siler ve sayaçları sıfırlar
+    static void hostReset();
+    static uint32_t hostWrites();
+
+private:
+    bool _started = false;
+    bool _readOnly = false;
+    String _name;
+};
+
+#endif
@@ -0,0 +1,80 @@
+// extras/host/shim/Update.cpp
+
+#include "Update.h"
+#include "ArduinoOTA.h"
+#include "HostShim.h"
+#include "esp_ota_ops.h"
+#include "mbedtls/sha256.h"
+
+UpdateClass Update;
+ArduinoOTAClass ArduinoOTA;
+
+// --- Update ---
+
+bool UpdateClass::begin(size_t size, int command, int ledPin, uint8_t ledOn, const char* label) {
+    (void)command; (void)ledPin; (void)ledOn; (void)label;
+    if (_running) { _error = "Bad Argument"; return false; }
+    _error = nullptr;
+    if (size == 0) { _error = "Bad Size Given"; return false; }
+    if (size == UPDATE_SIZE_UNKNOWN) { size = HOST_OTA_PARTITION_SIZE; }
+    if (size > HOST_OTA_PARTITION_SIZE) { _error = "Not Enough Space"; return false; }
+    _size = size;
+    _image.clear();
+    _image.reserve(size);
+    _running = true;
+    return true;
+}
+
+size_t UpdateClass::write(uint8_t* data, size_t length) {
+    if (!_running || hasError()) { return 0; }
+    if (length > remaining()) { _error = "Not Enough Space"; abort(); return 0; }
+    if (_image.empty() && length > 0 && data[0] != ESP_IMAGE_HEADER_MAGIC) { _error = "Wrong Magic Byte"; abort(); return 0; }
+    _image.insert(_image.end(), data, data + length);
+    if (_writeDelayUs > 0) { delayMicroseconds((uint32_t)((uint64_t)length * _writeDelayUs / 1024)); }
+    return length;
+}
+
+bool UpdateClass::end(bool evenIfRemaining) {
+    if (!_running || hasError()) { return false; }
+    if (_image.size() != _size && !evenIfRemaining) { _error = "Aborted"; abort(); return false; }
+    _committed.swap(_image);
+    _image.clear();
+    _running = false;
+    _commits++;
+    return true;
+}
+
+void UpdateClass::abort() {
+    if (!_error) { _error = "Aborted"; }
+    _image.clear();
+    _running = false;
+}
+
+// --- Çalışan bölüm ---
+
+static std::vector<uint8_t> runningImage;
+static esp_partition_t runningPartition = {0x10000, HOST_OTA_PARTITION_SIZE, "app0"};
+
+void hostSetRunningImage(const uint8_t* data, size_t size) {
+    runningImage.assign(data, data + size);
+    runningImage.resize(HOST_OTA_PARTITION_SIZE > size ? HOST_OTA_PARTITION_SIZE : size, 0xFF);
+    runningPartition.size = runningImage.size();
+}
+
+const esp_partition_t* esp_ota_get_running_partition(void) { return &runningPartition; }
+
+esp_err_t esp_ota_get_partition_description(const esp_partition_t* partition, esp_app_desc_t* appDesc) {
+    if (partition != &runningPartition || !appDesc) { return ESP_ERR_INVALID_ARG; }
+    memset(appDesc, 0, sizeof(*appDesc));
+    appDesc->magic_word = 0xABCD5432;
+    snprintf(appDesc->project_name, sizeof(appDesc->project_name), "esp32helper-host");
+    mbedtls_sha256(runningImage.data(), runningImage.size(), appDesc->app_elf_sha256, 0);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t srcOffset, void* dst, size_t size) {
+    if (partition != &runningPartition || srcOffset > partition->size || size > partition->size - srcOffset) { return ESP_ERR_INVALID_SIZE; }
+    if (srcOffset + size <= runningImage.size()) { memcpy(dst, runningImage.data() + srcOffset, size); }
+    else { memset(dst, 0xFF, size); }
+    return ESP_OK;
+}
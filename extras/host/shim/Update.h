@@ -0,0 +1,49 @@
+// extras/host/shim/Update.h
+// OTA bölümü bellekte tutulur; sihirli bayt (0xE9), bölüm boyutu ve bildirilen boyut cihazdaki gibi denetlenir.
+
+#ifndef HOST_UPDATE_H
+#define HOST_UPDATE_H
+
+#include <vector>
+#include "Arduino.h"
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#define U_FLASH 0
+#define ESP_IMAGE_HEADER_MAGIC 0xE9
+
+#ifndef HOST_OTA_PARTITION_SIZE
+#define HOST_OTA_PARTITION_SIZE 0x1E0000
+#endif
+
+class UpdateClass {
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int ledPin = -1, uint8_t ledOn = LOW, const char* label = nullptr);
+    size_t write(uint8_t* data, size_t length);
+    bool end(bool evenIfRemaining = false);
+    void abort();
+
+    bool isRunning() const { return _running; }
+    bool hasError() const { return _error != nullptr; }
+    const char* errorString() const { return _error ? _error : "No Error"; }
+    size_t size() const { return _size; }
+    size_t progress() const { return _image.size(); }
+    size_t remaining() const { return _size - _image.size(); }
+
+    // Son başarılı güncellemenin imajı
+    const std::vector<uint8_t>& hostImage() const { return _committed; }
+    uint32_t hostCommits() const { return _commits; }
+    // Flash silme/yazma süresini taklit eder: her yazma KB başına bu kadar bekler
+    void hostSetWriteDelay(uint32_t microsecondsPerKB) { _writeDelayUs = microsecondsPerKB; }
+
+private:
+    bool _running = false;
+    size_t _size = 0;
+    const char* _error = nullptr;
+    std::vector<uint8_t> _image;
+    std::vector<uint8_t> _committed;
+    uint32_t _commits = 0;
+    uint32_t _writeDelayUs = 0;
+};
+extern UpdateClass Update;
+
+#endif
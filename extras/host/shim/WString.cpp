@@ -0,0 +1,184 @@
+// extras/host/shim/WString.cpp
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "WString.h"
+#include "HostShim.h"
+
+static void formatNumber(char* out, size_t size, unsigned long long value, bool negative, unsigned char base) {
+    char digits[66];
+    int n = 0;
+    if (base < 2 || base > 36) { base = 10; }
+    do {
+        int d = (int)(value % base);
+        digits[n++] = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+        value /= base;
+    } while (value > 0);
+    size_t pos = 0;
+    if (negative && pos + 1 < size) { out[pos++] = '-'; }
+    while (n > 0 && pos + 1 < size) { out[pos++] = digits[--n]; }
+    out[pos] = '\0';
+}
+
+String::String(const char* cstr) { if (cstr) { concat(cstr); } }
+String::String(const char* cstr, unsigned int length) { if (cstr) { concat(cstr, length); } }
+String::String(const String& other) { concat(other); }
+String::String(String&& other) noexcept { move(other); }
+String::String(char c) { concat(c); }
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(int value, unsigned char base) : String((long long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(long value, unsigned char base) : String((long long)value, base) {}
+String::String(unsigned long value, unsigned char base) : String((unsigned long long)value, base) {}
+
+String::String(long long value, unsigned char base) {
+    char text[68];
+    bool negative = value < 0 && base == 10;
+    formatNumber(text, sizeof(text), negative ? 0ULL - (unsigned long long)value : (unsigned long long)value, negative, base);
+    concat(text);
+}
+
+String::String(unsigned long long value, unsigned char base) {
+    char text[68];
+    formatNumber(text, sizeof(text), value, false, base);
+    concat(text);
+}
+
+String::String(double value, unsigned int decimalPlaces) {
+    char text[40];
+    snprintf(text, sizeof(text), "%.*f", (int)decimalPlaces, value);
+    concat(text);
+}
+
+String::~String() { free(_heap); }
+
+void String::move(String& other) {
+    free(_heap);
+    _heap = other._heap;
+    _capacity = other._capacity;
+    _len = other._len;
+    memcpy(_sso, other._sso, sizeof(_sso));
+    other._heap = nullptr;
+    other._capacity = SSO_CAPACITY;
+    other._len = 0;
+    other._sso[0] = '\0';
+}
+
+String& String::operator=(const String& rhs) {
+    if (this == &rhs) { return *this; }
+    _len = 0; buffer()[0] = '\0';
+    concat(rhs);
+    return *this;
+}
+
+String& String::operator=(String&& rhs) noexcept {
+    if (this != &rhs) { move(rhs); }
+    return *this;
+}
+
+String& String::operator=(const char* cstr) {
+    _len = 0; buffer()[0] = '\0';
+    if (cstr) { concat(cstr); }
+    return *this;
+}
+
+// Cihazdaki gibi tam istenen boyuta büyür; reserve() çağrılmazsa her ekleme bir realloc olabilir
+bool String::reserve(unsigned int size) {
+    if (size <= _capacity) { return true; }
+    char* heap = (char*)realloc(_heap, size + 1);
+    if (!heap) { return false; }
+    hostCountAllocation(size + 1);
+    if (!_heap) { memcpy(heap, _sso, _len + 1); }
+    _heap = heap;
+    _capacity = size;
+    return true;
+}
+
+bool String::concat(const char* cstr, unsigned int length) {
+    if (length == 0) { return true; }
+    unsigned int newLength = _len + length;
+    // Kaynak kendi tamponumuzdaysa büyütme sonrası konumu korunmalı
+    const char* base = buffer();
+    bool self = cstr >= base && cstr < base + _len;
+    size_t offset = self ? (size_t)(cstr - base) : 0;
+    if (!reserve(newLength)) { return false; }
+    if (self) { cstr = buffer() + offset; }
+    memmove(buffer() + _len, cstr, length);
+    _len = newLength;
+    buffer()[_len] = '\0';
+    return true;
+}
+
+bool String::concat(const char* cstr) { return cstr ? concat(cstr, strlen(cstr)) : false; }
+
+char& String::operator[](unsigned int index) {
+    static char dummy;
+    if (index >= _len) { dummy = 0; return dummy; }
+    return buffer()[index];
+}
+
+bool String::equals(const String& other) const { return _len == other._len && memcmp(buffer(), other.buffer(), _len) == 0; }
+
+bool String::equals(const char* cstr) const {
+    if (!cstr) { return _len == 0; }
+    return strlen(cstr) == _len && memcmp(buffer(), cstr, _len) == 0;
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (_len != other._len) { return false; }
+    for (unsigned int i = 0; i < _len; i++) {
+        if (tolower((unsigned char)buffer()[i]) != tolower((unsigned char)other.buffer()[i])) { return false; }
+    }
+    return true;
+}
+
+bool String::startsWith(const String& prefix) const {
+    return prefix._len <= _len && memcmp(buffer(), prefix.buffer(), prefix._len) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return suffix._len <= _len && memcmp(buffer() + _len - suffix._len, suffix.buffer(), suffix._len) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    if (from >= _len) { return -1; }
+    const char* p = (const char*)memchr(buffer() + from, c, _len - from);
+    return p ? (int)(p - buffer()) : -1;
+}
+
+int String::indexOf(const String& str, unsigned int from) const {
+    if (from > _len) { return -1; }
+    const char* p = strstr(buffer() + from, str.c_str());
+    return p ? (int)(p - buffer()) : -1;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= _len) { return String(); }
+    if (to > _len) { to = _len; }
+    return String(buffer() + from, to - from);
+}
+
+void String::trim() {
+    char* b = buffer();
+    unsigned int start = 0;
+    while (start < _len && isspace((unsigned char)b[start])) { start++; }
+    unsigned int end = _len;
+    while (end > start && isspace((unsigned char)b[end - 1])) { end--; }
+    _len = end - start;
+    memmove(b, b + start, _len);
+    b[_len] = '\0';
+}
+
+void String::toLowerCase() { for (unsigned int i = 0; i < _len; i++) { buffer()[i] = (char)tolower((unsigned char)buffer()[i]); } }
+void String::toUpperCase() { for (unsigned int i = 0; i < _len; i++) { buffer()[i] = (char)toupper((unsigned char)buffer()[i]); } }
+long String::toInt() const { return atol(buffer()); }
+
+String operator+(const String& lhs, const String& rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const String& lhs, const char* rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const char* lhs, const String& rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const String& lhs, char rhs) { String s(lhs); s += rhs; return s; }
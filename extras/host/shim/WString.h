@@ -0,0 +1,90 @@
+// extras/host/shim/WString.h
+// arduino-esp32 String davranışının masaüstü karşılığı: 11 karakterlik SSO, ardından tam boyutlu realloc.
+// Büyüme geometrik değildir; cihazdaki gibi her büyütme bir yığın işlemidir ve HostShim.h sayaçlarına yansır.
+
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class String {
+public:
+    String(const char* cstr = "");
+    String(const char* cstr, unsigned int length);
+    String(const String& other);
+    String(String&& other) noexcept;
+    explicit String(char c);
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+    ~String();
+
+    String& operator=(const String& rhs);
+    String& operator=(String&& rhs) noexcept;
+    String& operator=(const char* cstr);
+
+    bool reserve(unsigned int size);
+    unsigned int length() const { return _len; }
+    bool isEmpty() const { return _len == 0; }
+    const char* c_str() const { return buffer(); }
+
+    bool concat(const char* cstr, unsigned int length);
+    bool concat(const String& str) { return concat(str.c_str(), str.length()); }
+    bool concat(const char* cstr);
+    bool concat(char c) { return concat(&c, 1); }
+    String& operator+=(const String& rhs) { concat(rhs); return *this; }
+    String& operator+=(const char* cstr) { concat(cstr); return *this; }
+    String& operator+=(char c) { concat(c); return *this; }
+    String& operator+=(int value) { concat(String(value)); return *this; }
+    String& operator+=(unsigned int value) { concat(String(value)); return *this; }
+    String& operator+=(long value) { concat(String(value)); return *this; }
+    String& operator+=(unsigned long value) { concat(String(value)); return *this; }
+
+    char operator[](unsigned int index) const { return index < _len ? buffer()[index] : 0; }
+    char& operator[](unsigned int index);
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool equals(const String& other) const;
+    bool equals(const char* cstr) const;
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& rhs) const { return equals(rhs); }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& rhs) const { return !equals(rhs); }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool startsWith(const String& prefix) const;
+    bool endsWith(const String& suffix) const;
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& str, unsigned int from = 0) const;
+    String substring(unsigned int from) const { return substring(from, _len); }
+    String substring(unsigned int from, unsigned int to) const;
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    long toInt() const;
+
+private:
+    static const unsigned int SSO_CAPACITY = 11;
+
+    char* buffer() { return _heap ? _heap : _sso; }
+    const char* buffer() const { return _heap ? _heap : _sso; }
+    void move(String& other);
+
+    char* _heap = nullptr;
+    unsigned int _capacity = SSO_CAPACITY;
+    unsigned int _len = 0;
+    char _sso[SSO_CAPACITY + 1] = {0};
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+
+#endif
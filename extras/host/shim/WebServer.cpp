@@ -0,0 +1,293 @@
+// extras/host/shim/WebServer.cpp
+
+#include <strings.h>
+
+#include "WebServer.h"
+
+static bool sameName(const String& a, const char* b) { return strcasecmp(a.c_str(), b) == 0; }
+static const char* cstr(const char* s) { return s; }
+static const char* cstr(const String& s) { return s.c_str(); }
+
+String HostResponse::header(const char* name) const {
+    for (const auto& item : headers) {
+        if (sameName(item.first, name)) { return item.second; }
+    }
+    return String();
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler) {
+    _routes.push_back(Route{uri, method, handler, uploadHandler});
+}
+
+void WebServer::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+    _collect.clear();
+    for (size_t i = 0; i < headerKeysCount; i++) { _collect.push_back(String(headerKeys[i])); }
+}
+
+String WebServer::arg(const String& name) const {
+    for (const auto& item : _args) {
+        if (item.first == name) { return item.second; }
+    }
+    return String();
+}
+
+bool WebServer::hasArg(const String& name) const {
+    for (const auto& item : _args) {
+        if (item.first == name) { return true; }
+    }
+    return false;
+}
+
+String WebServer::header(const String& name) const {
+    for (const auto& item : _headers) {
+        if (sameName(item.first, name.c_str())) { return item.second; }
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const String& name) const {
+    for (const auto& item : _headers) {
+        if (sameName(item.first, name.c_str())) { return true; }
+    }
+    return false;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    if (first) { _pendingHeaders.insert(_pendingHeaders.begin(), std::make_pair(name, value)); }
+    else { _pendingHeaders.push_back(std::make_pair(name, value)); }
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+    _response.code = code;
+    _response.contentType = contentType ? contentType : "";
+    _response.headers = _pendingHeaders;
+    _pendingHeaders.clear();
+    _response.body.assign(content.c_str(), content.length());
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength) {
+    _response.code = code;
+    _response.contentType = contentType;
+    _response.headers = _pendingHeaders;
+    _pendingHeaders.clear();
+    _response.body.assign(content, contentLength);
+}
+
+template <typename Fields>
+void WebServer::prepare(HTTPMethod method, const String& uri, const Fields& headers, const Fields& form) {
+    _method = method;
+    _args.clear();
+    _headers.clear();
+    _pendingHeaders.clear();
+    _contentLength = CONTENT_LENGTH_UNKNOWN;
+    _clientContentLength = 0;
+    _response = HostResponse();
+    int query = uri.indexOf('?');
+    _uri = query < 0 ? uri : uri.substring(0, query);
+    if (query >= 0) {
+        String rest = uri.substring(query + 1);
+        while (rest.length() > 0) {
+            int amp = rest.indexOf('&');
+            String pair = amp < 0 ? rest : rest.substring(0, amp);
+            int eq = pair.indexOf('=');
+            if (eq < 0) { _args.push_back(std::make_pair(pair, String())); }
+            else { _args.push_back(std::make_pair(pair.substring(0, eq), pair.substring(eq + 1))); }
+            rest = amp < 0 ? String() : rest.substring(amp + 1);
+        }
+    }
+    for (const auto& item : form) { _args.push_back(std::make_pair(String(item.first), String(item.second))); }
+    for (const auto& item : headers) {
+        for (const auto& key : _collect) {
+            if (sameName(key, cstr(item.first))) { _headers.push_back(std::make_pair(String(item.first), String(item.second))); break; }
+        }
+    }
+}
+
+const WebServer::Route* WebServer::route() const {
+    for (const auto& r : _routes) {
+        if (r.uri == _uri && (r.method == HTTP_ANY || r.method == _method)) { return &r; }
+    }
+    return nullptr;
+}
+
+void WebServer::dispatch() {
+    const Route* r = route();
+    if (r) { r->handler(); }
+    else if (_notFound) { _notFound(); }
+    else { send(404, "text/plain", "Not found"); }
+}
+
+HostResponse WebServer::hostRequest(HTTPMethod method, const String& uri, HostFields headers, HostFields form) {
+    prepare(method, uri, headers, form);
+    dispatch();
+    return _response;
+}
+
+HostResponse WebServer::hostUpload(const String& uri, const String& filename, const uint8_t* data, size_t length) {
+    prepare(HTTP_POST, uri, HostFields{}, HostFields{});
+    _clientContentLength = length + 192;
+    const Route* r = route();
+    _upload.filename = filename;
+    _upload.name = "update";
+    _upload.type = "application/octet-stream";
+    _upload.totalSize = 0;
+    _upload.currentSize = 0;
+    auto dispatch = [this, r]() {
+        if (_fileUpload) { _fileUpload(); }
+        if (r && r->uploadHandler) { r->uploadHandler(); }
+    };
+    _upload.status = UPLOAD_FILE_START;
+    dispatch();
+    _upload.status = UPLOAD_FILE_WRITE;
+    for (size_t offset = 0; offset < length; offset += HTTP_UPLOAD_BUFLEN) {
+        size_t chunk = length - offset < HTTP_UPLOAD_BUFLEN ? length - offset : HTTP_UPLOAD_BUFLEN;
+        memcpy(_upload.buf, data + offset, chunk);
+        _upload.currentSize = chunk;
+        _upload.totalSize += chunk;
+        dispatch();
+        if (_onUploadChunk) { _onUploadChunk(offset / HTTP_UPLOAD_BUFLEN); }
+    }
+    _upload.status = UPLOAD_FILE_END;
+    _upload.currentSize = 0;
+    dispatch();
+    if (r) { r->handler(); }
+    else if (_notFound) { _notFound(); }
+    return _response;
+}
+
+void WebServer::hostReset() {
+    close();
+    _listen = false;
+    _routes.clear();
+    _notFound = nullptr;
+    _fileUpload = nullptr;
+    _onUploadChunk = nullptr;
+    _collect.clear();
+}
+
+// --- Gerçek soketten sunma ---
+
+static bool readLine(WiFiClient& client, std::string& line) {
+    line.clear();
+    uint8_t c;
+    while (client.readBytes(&c, 1) == 1) {
+        if (c == '\n') {
+            if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+            return true;
+        }
+        line += (char)c;
+    }
+    return false;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+    if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+}
+
+static String urlDecode(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '+') { out += ' '; }
+        else if (text[i] == '%' && i + 2 < text.size() && hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0) {
+            out += (char)(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2]));
+            i += 2;
+        } else { out += text[i]; }
+    }
+    return String(out.c_str());
+}
+
+static const char* reasonPhrase(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        default: return "";
+    }
+}
+
+void WebServer::handleClient() {
+    if (!_listener) { return; }
+    if (_client.fd() < 0) {
+        if (!_listener.hasClient()) { return; }
+        _client = _listener.available();
+        _clientSince = millis();
+    }
+    if (_client.available() == 0) {
+        if (!_client.connected() || millis() - _clientSince > HTTP_MAX_DATA_WAIT) { _client.stop(); }
+        return;
+    }
+    serveClient();
+    _client.stop();
+}
+
+void WebServer::serveClient() {
+    _client.setTimeout(HTTP_MAX_DATA_WAIT);
+    std::string line;
+    if (!readLine(_client, line)) { return; }
+    size_t first = line.find(' ');
+    size_t second = line.find(' ', first + 1);
+    if (first == std::string::npos || second == std::string::npos) { return; }
+    std::string methodName = line.substr(0, first);
+    String uri(line.substr(first + 1, second - first - 1).c_str());
+    static const char* const methods[] = {"", "GET", "HEAD", "POST", "PUT", "PATCH", "DELETE", "OPTIONS"};
+    HTTPMethod method = HTTP_GET;
+    for (int i = 1; i < 8; i++) {
+        if (methodName == methods[i]) { method = (HTTPMethod)i; }
+    }
+
+    std::vector<std::pair<String, String>> headers;
+    std::vector<std::pair<String, String>> form;
+    size_t contentLength = 0;
+    String contentType;
+    while (readLine(_client, line) && !line.empty()) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) { continue; }
+        size_t value = line.find_first_not_of(' ', colon + 1);
+        String name(line.substr(0, colon).c_str());
+        String text(value == std::string::npos ? "" : line.substr(value).c_str());
+        if (sameName(name, "Content-Length")) { contentLength = strtoul(text.c_str(), nullptr, 10); }
+        if (sameName(name, "Content-Type")) { contentType = text; }
+        headers.push_back(std::make_pair(name, text));
+    }
+    if (contentLength > 0) {
+        std::string body(contentLength, '\0');
+        body.resize(_client.readBytes((uint8_t*)&body[0], contentLength));
+        if (contentType.startsWith("application/x-www-form-urlencoded")) {
+            size_t start = 0;
+            while (start < body.size()) {
+                size_t amp = body.find('&', start);
+                std::string pair = body.substr(start, amp == std::string::npos ? std::string::npos : amp - start);
+                size_t eq = pair.find('=');
+                form.push_back(std::make_pair(urlDecode(pair.substr(0, eq)), eq == std::string::npos ? String() : urlDecode(pair.substr(eq + 1))));
+                start = amp == std::string::npos ? body.size() : amp + 1;
+            }
+        } else if (!contentType.startsWith("multipart/")) {
+            form.push_back(std::make_pair(String("plain"), String(body.c_str())));
+        }
+    }
+
+    prepare(method, uri, headers, form);
+    if (contentType.startsWith("multipart/")) { send(501, "text/plain", "Yukleme icin hostUpload() kullanin"); }
+    else { dispatch(); }
+
+    char head[128];
+    snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\n", _response.code, reasonPhrase(_response.code));
+    std::string out = head;
+    if (_response.contentType.length() > 0) { out += "Content-Type: "; out += _response.contentType.c_str(); out += "\r\n"; }
+    snprintf(head, sizeof(head), "Content-Length: %u\r\n", (unsigned)_response.body.size());
+    out += head;
+    for (const auto& item : _response.headers) {
+        if (sameName(item.first, "Connection")) { continue; }
+        out += item.first.c_str(); out += ": "; out += item.second.c_str(); out += "\r\n";
+    }
+    out += "Connection: close\r\n\r\n";
+    if (method != HTTP_HEAD) { out += _response.body; }
+    _client.write((const uint8_t*)out.data(), out.size());
+}
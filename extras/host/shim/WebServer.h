@@ -0,0 +1,137 @@
+// extras/host/shim/WebServer.h
+// İstekler soket yerine hostRequest()/hostUpload() ile süreç içinde işlenir; handleClient() boş döner.
+// Böylece ölçümler ağ yığınını değil kütüphanenin işleyicilerini kapsar. hostListen() ile gerçek soketten
+// de sunulabilir; o zaman cihazdaki sunucu gibi bağlantıları tek tek ve bloklayarak işler (yük testi için).
+
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+#ifndef HTTP_MAX_DATA_WAIT
+#define HTTP_MAX_DATA_WAIT 5000
+#endif
+#ifndef HTTP_UPLOAD_BUFLEN
+#define HTTP_UPLOAD_BUFLEN 1436
+#endif
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+struct HTTPUpload {
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+// Süreç içi isteğin cevabı; gövde ikili olabileceği için std::string tutulur
+struct HostResponse {
+    int code = 0;
+    String contentType;
+    std::vector<std::pair<String, String>> headers;
+    std::string body;
+
+    String header(const char* name) const;
+};
+
+typedef std::initializer_list<std::pair<const char*, const char*>> HostFields;
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) : _port(port), _listener(port) {}
+
+    void begin() { if (_listen) { _listener.begin(); } }
+    void close() { _listener.end(); _client.stop(); }
+    // hostListen() açıksa bekleyen bağlantıyı kabul eder, isteğini okuyup cevaplar ve bağlantıyı kapatır
+    void handleClient();
+
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler) { on(uri, method, handler, nullptr); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler);
+    void onNotFound(THandlerFunction handler) { _notFound = handler; }
+    void onFileUpload(THandlerFunction handler) { _fileUpload = handler; }
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+
+    String uri() const { return _uri; }
+    HTTPMethod method() const { return _method; }
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    int args() const { return (int)_args.size(); }
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    HTTPUpload& upload() { return _upload; }
+    // Yüklemelerde çok parçalı gövdenin boyutu; burada dosya boyutu artı sabit bir sınır payı
+    size_t clientContentLength() const { return _clientContentLength; }
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t length) { _contentLength = length; }
+    void send(int code, const char* contentType = nullptr, const String& content = String(""));
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+    void sendContent(const String& content) { _response.body.append(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t length) { _response.body.append(content, length); }
+
+    // query ("?a=b") ve form alanları arg() ile okunur; headers yalnızca collectHeaders() ile istenenler için saklanır
+    HostResponse hostRequest(HTTPMethod method, const String& uri, HostFields headers = {}, HostFields form = {});
+    // Çok parçalı dosya yüklemesini HTTP_UPLOAD_BUFLEN'lik parçalar halinde yükleme işleyicilerine verir
+    HostResponse hostUpload(const String& uri, const String& filename, const uint8_t* data, size_t length);
+    // Her yükleme parçası işlendikten sonra parçanın sırasıyla çağrılır; yükleme sürerken başka bir isteğin
+    // (hostRequest) araya girmesini taklit eder; kalan parçalar yine aynı yükleme işleyicilerine gider.
+    void hostOnUploadChunk(std::function<void(size_t)> handler) { _onUploadChunk = handler; }
+    // begin()'den önce çağrılırsa gerçek soketten de sunar (hostListenPort(port) ile bulunur). Cihazdaki gibi
+    // keep-alive yoktur; kabul edilen bağlantı ilk veriyi HTTP_MAX_DATA_WAIT boyunca bekler, bu sürede
+    // diğer bağlantılar sırada kalır. Çok parçalı yükleme desteklenmez, hostUpload() kullanılır.
+    void hostListen(bool enabled = true) { _listen = enabled; }
+    // Kayıtlı tüm işleyicileri siler (aynı süreçte birden fazla ESP32Helper kurmak için)
+    void hostReset();
+
+private:
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+        THandlerFunction uploadHandler;
+    };
+
+    template <typename Fields>
+    void prepare(HTTPMethod method, const String& uri, const Fields& headers, const Fields& form);
+    const Route* route() const;
+    void dispatch();
+    void serveClient();
+
+    int _port;
+    bool _listen = false;
+    WiFiServer _listener;
+    WiFiClient _client;
+    unsigned long _clientSince = 0;
+    std::vector<Route> _routes;
+    THandlerFunction _notFound;
+    THandlerFunction _fileUpload;
+    std::vector<String> _collect;
+
+    String _uri;
+    HTTPMethod _method = HTTP_GET;
+    std::vector<std::pair<String, String>> _args;
+    std::vector<std::pair<String, String>> _headers;
+    std::vector<std::pair<String, String>> _pendingHeaders;
+    size_t _contentLength = CONTENT_LENGTH_UNKNOWN;
+    size_t _clientContentLength = 0;
+    HTTPUpload _upload;
+    HostResponse _response;
+    std::function<void(size_t)> _onUploadChunk;
+};
+
+#endif
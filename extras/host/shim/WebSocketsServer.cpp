@@ -0,0 +1,158 @@
+// extras/host/shim/WebSocketsServer.cpp
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "WebSocketsServer.h"
+
+WebSocketsServer::WebSocketsServer(uint16_t port, const String& origin, const String& protocol) {
+    (void)port; (void)origin; (void)protocol;
+    for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) { _peer[i] = -1; }
+}
+
+// Bağlı istemci başına bir çerçeve sayılır; cihazda her biri ayrı bir TCP yazmasıdır
+bool WebSocketsServer::deliver(int num, bool binary, const uint8_t* payload, size_t length) {
+    bool ok = true;
+    if (num >= 0) {
+        if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !_connected[num] || !write((uint8_t)num, payload, length)) { return false; }
+    } else {
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+            if (_connected[i] && !write(i, payload, length)) { ok = false; }
+        }
+    }
+    if (_onSend) { _onSend(num, binary, payload, length); }
+    return ok;
+}
+
+// Kütüphane gibi yükün tamamı yazılana kadar bekler; HOST_WS_WRITE_TIMEOUT_MS içinde yazamazsa istemciyi düşürür
+bool WebSocketsServer::write(uint8_t num, const uint8_t* payload, size_t length) {
+    WiFiClient* tcp = _clients[num].tcp;
+    struct pollfd pfd = {tcp->fd(), POLLOUT, 0};
+    if (poll(&pfd, 1, 0) <= 0) { _blockedWrites++; }
+    if (tcp->write(payload, length) != length) { hostDisconnect(num); return false; }
+    _framesSent++; _bytesSent += length; _clientBytes[num] += length;
+    readPeer(num);
+    return true;
+}
+
+void WebSocketsServer::readPeer(uint8_t num) {
+    if (_paused[num] || _peer[num] < 0) { return; }
+    uint8_t sink[4096];
+    while (recv(_peer[num], sink, sizeof(sink), MSG_DONTWAIT) > 0) {}
+}
+
+void WebSocketsServer::closeClient(uint8_t num) {
+    delete _clients[num].tcp;
+    _clients[num].tcp = nullptr;
+    if (_peer[num] >= 0) { ::close(_peer[num]); }
+    _peer[num] = -1;
+    _paused[num] = false;
+}
+
+void WebSocketsServer::hostPauseReading(uint8_t num, bool paused) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return; }
+    _paused[num] = paused;
+    readPeer(num);
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, uint8_t* payload, size_t length, bool headerToPayload) {
+    (void)headerToPayload;
+    return sendTXT(num, (const uint8_t*)payload, length);
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const uint8_t* payload, size_t length) {
+    if (length == 0) { length = strlen((const char*)payload); }
+    return deliver(num, false, payload, length);
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, char* payload, size_t length, bool headerToPayload) {
+    return sendTXT(num, (uint8_t*)payload, length, headerToPayload);
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const char* payload, size_t length) {
+    return sendTXT(num, (const uint8_t*)payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(uint8_t* payload, size_t length, bool headerToPayload) {
+    (void)headerToPayload;
+    return broadcastTXT((const uint8_t*)payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(const uint8_t* payload, size_t length) {
+    if (length == 0) { length = strlen((const char*)payload); }
+    return deliver(-1, false, payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(char* payload, size_t length, bool headerToPayload) {
+    return broadcastTXT((uint8_t*)payload, length, headerToPayload);
+}
+
+bool WebSocketsServer::broadcastTXT(const char* payload, size_t length) {
+    return broadcastTXT((const uint8_t*)payload, length);
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, uint8_t* payload, size_t length, bool headerToPayload) {
+    (void)headerToPayload;
+    return deliver(num, true, payload, length);
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t* payload, size_t length) { return deliver(num, true, payload, length); }
+
+bool WebSocketsServer::broadcastBIN(uint8_t* payload, size_t length, bool headerToPayload) {
+    (void)headerToPayload;
+    return deliver(-1, true, payload, length);
+}
+
+bool WebSocketsServer::broadcastBIN(const uint8_t* payload, size_t length) { return deliver(-1, true, payload, length); }
+
+uint8_t WebSocketsServer::connectedClients(bool ping) {
+    (void)ping;
+    uint8_t count = 0;
+    for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+        if (_connected[i]) { count++; }
+    }
+    return count;
+}
+
+void WebSocketsServer::hostConnect(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return; }
+    closeClient(num);
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) { return; }
+    int size = HOST_WS_SOCKET_BUFFER;
+    setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+    _clients[num].num = num;
+    _clients[num].tcp = new WiFiClient(fds[0]);
+    _clients[num].tcp->setTimeout(HOST_WS_WRITE_TIMEOUT_MS);
+    _peer[num] = fds[1];
+    _connected[num] = true;
+    static uint8_t url[] = "/";
+    if (_event) { _event(num, WStype_CONNECTED, url, 1); }
+}
+
+void WebSocketsServer::hostDisconnect(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !_connected[num]) { return; }
+    _connected[num] = false;
+    closeClient(num);
+    if (_event) { _event(num, WStype_DISCONNECTED, nullptr, 0); }
+}
+
+void WebSocketsServer::hostReceive(uint8_t num, WStype_t type, const uint8_t* payload, size_t length) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !_connected[num] || !_event) { return; }
+    if (_rx.size() < length + 1) { _rx.resize(length + 1); }
+    memcpy(_rx.data(), payload, length);
+    _rx[length] = 0;
+    _event(num, type, _rx.data(), length);
+}
+
+void WebSocketsServer::hostReset() {
+    for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) { _connected[i] = false; _clientBytes[i] = 0; closeClient(i); }
+    _event = nullptr;
+    _onSend = nullptr;
+    _framesSent = 0;
+    _bytesSent = 0;
+    _blockedWrites = 0;
+}
@@ -0,0 +1,118 @@
+// extras/host/shim/WebSocketsServer.h
+// links2004/WebSockets sunucusunun süreç içi karşılığı. İstemci olayları hostConnect()/hostReceive() ile
+// üretilir; gönderilen çerçeveler sayılır ve isteğe bağlı olarak hostOnSend() ile yakalanır.
+// Her istemcinin kütüphanedeki gibi bir WiFiClient'ı (_clients[num].tcp) vardır: yük bir soket çiftine
+// yazılır, karşı uç okunmadıkça (hostPauseReading) gönderim tamponu dolar ve yazma bloklar.
+
+#ifndef HOST_WEBSOCKETSSERVER_H
+#define HOST_WEBSOCKETSSERVER_H
+
+#include <functional>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+
+#ifndef WEBSOCKETS_SERVER_CLIENT_MAX
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+#endif
+#define WEBSOCKETS_NETWORK_CLASS WiFiClient
+// Okunmayan istemcinin soketine sığan bayt (çekirdek bunu iki katına çıkarır) ve dolu sokete yazmanın
+// vazgeçilmeden önce bekleyeceği süre; kütüphane bu sürede yazamazsa istemciyi düşürür
+#ifndef HOST_WS_SOCKET_BUFFER
+#define HOST_WS_SOCKET_BUFFER 4096
+#endif
+#ifndef HOST_WS_WRITE_TIMEOUT_MS
+#define HOST_WS_WRITE_TIMEOUT_MS 100
+#endif
+
+typedef enum {
+    WStype_ERROR,
+    WStype_DISCONNECTED,
+    WStype_CONNECTED,
+    WStype_TEXT,
+    WStype_BIN,
+    WStype_FRAGMENT_TEXT_START,
+    WStype_FRAGMENT_BIN_START,
+    WStype_FRAGMENT,
+    WStype_FRAGMENT_FIN,
+    WStype_PING,
+    WStype_PONG
+} WStype_t;
+
+typedef struct {
+    uint8_t num;
+    WEBSOCKETS_NETWORK_CLASS* tcp;
+} WSclient_t;
+
+class WebSocketsServer {
+public:
+    typedef std::function<void(uint8_t num, WStype_t type, uint8_t* payload, size_t length)> WebSocketServerEvent;
+    // num == -1 yayın anlamına gelir
+    typedef std::function<void(int num, bool binary, const uint8_t* payload, size_t length)> HostSendCallback;
+
+    WebSocketsServer(uint16_t port, const String& origin = "", const String& protocol = "arduino");
+    virtual ~WebSocketsServer() { hostReset(); }
+
+    void begin() {}
+    void close() {}
+    void loop() {}
+    void onEvent(WebSocketServerEvent event) { _event = event; }
+
+    bool sendTXT(uint8_t num, uint8_t* payload, size_t length = 0, bool headerToPayload = false);
+    bool sendTXT(uint8_t num, const uint8_t* payload, size_t length = 0);
+    bool sendTXT(uint8_t num, char* payload, size_t length = 0, bool headerToPayload = false);
+    bool sendTXT(uint8_t num, const char* payload, size_t length = 0);
+    bool sendTXT(uint8_t num, String& payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+
+    bool broadcastTXT(uint8_t* payload, size_t length = 0, bool headerToPayload = false);
+    bool broadcastTXT(const uint8_t* payload, size_t length = 0);
+    bool broadcastTXT(char* payload, size_t length = 0, bool headerToPayload = false);
+    bool broadcastTXT(const char* payload, size_t length = 0);
+    bool broadcastTXT(String& payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+
+    bool sendBIN(uint8_t num, uint8_t* payload, size_t length, bool headerToPayload = false);
+    bool sendBIN(uint8_t num, const uint8_t* payload, size_t length);
+    bool broadcastBIN(uint8_t* payload, size_t length, bool headerToPayload = false);
+    bool broadcastBIN(const uint8_t* payload, size_t length);
+
+    void disconnect(uint8_t num) { hostDisconnect(num); }
+    IPAddress remoteIP(uint8_t num) { return IPAddress(127, 0, 0, 2 + num); }
+    uint8_t connectedClients(bool ping = false);
+    bool clientIsConnected(uint8_t num) { return num < WEBSOCKETS_SERVER_CLIENT_MAX && _connected[num]; }
+
+    void hostConnect(uint8_t num);
+    void hostDisconnect(uint8_t num);
+    // Yük kütüphanedeki gibi '\0' ile sonlandırılmış bir kopyada iletilir
+    void hostReceive(uint8_t num, WStype_t type, const uint8_t* payload, size_t length);
+    void hostOnSend(HostSendCallback callback) { _onSend = callback; }
+    void hostReset();
+    uint64_t hostFramesSent() const { return _framesSent; }
+    uint64_t hostBytesSent() const { return _bytesSent; }
+    uint64_t hostBytesSent(uint8_t num) const { return num < WEBSOCKETS_SERVER_CLIENT_MAX ? _clientBytes[num] : 0; }
+    // true iken istemci okumayı bırakır (zayıf bağlantıdaki sekme gibi); false ile biriken veri okunur
+    void hostPauseReading(uint8_t num, bool paused);
+    // Dolu sokete yapılan, yani gerçek cihazda görevi bekletecek yazmalar
+    uint64_t hostBlockedWrites() const { return _blockedWrites; }
+
+protected:
+    WSclient_t _clients[WEBSOCKETS_SERVER_CLIENT_MAX] = {};
+
+private:
+    bool deliver(int num, bool binary, const uint8_t* payload, size_t length);
+    bool write(uint8_t num, const uint8_t* payload, size_t length);
+    void readPeer(uint8_t num);
+    void closeClient(uint8_t num);
+
+    WebSocketServerEvent _event;
+    HostSendCallback _onSend;
+    bool _connected[WEBSOCKETS_SERVER_CLIENT_MAX] = {false};
+    std::vector<uint8_t> _rx;
+    uint64_t _framesSent = 0;
+    uint64_t _bytesSent = 0;
+    uint64_t _clientBytes[WEBSOCKETS_SERVER_CLIENT_MAX] = {0};
+    uint64_t _blockedWrites = 0;
+    int _peer[WEBSOCKETS_SERVER_CLIENT_MAX]; // Sınamanın okuduğu uç; bağlı değilken -1
+    bool _paused[WEBSOCKETS_SERVER_CLIENT_MAX] = {false};
+};
+
+#endif
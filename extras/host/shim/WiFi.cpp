@@ -0,0 +1,304 @@
+// extras/host/shim/WiFi.cpp
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "WiFi.h"
+#include "HostShim.h"
+
+WiFiClass WiFi;
+
+// --- WiFiClass ---
+
+int WiFiClass::onEvent(WiFiEventFuncCb callback) {
+    _callbacks.push_back(callback);
+    return (int)_callbacks.size();
+}
+
+void WiFiClass::emit(arduino_event_id_t event) {
+    arduino_event_info_t info = {0};
+    for (auto& callback : _callbacks) { callback(event, info); }
+}
+
+bool WiFiClass::config(IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+    (void)dns2;
+    _staticIP = (uint32_t)local != 0;
+    _localIP = local; _gateway = gateway; _subnet = subnet; _dns = dns1;
+    return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase, int32_t channel, const uint8_t* bssid, bool connect) {
+    (void)passphrase;
+    _ssid = ssid;
+    if (channel > 0) { _channel = channel; }
+    if (bssid) { memcpy(_bssid, bssid, sizeof(_bssid)); }
+    _status = WL_DISCONNECTED;
+    if (connect && _autoConnect) { hostConnect(); }
+    return _status;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+    (void)eraseAp;
+    if (wifiOff) { _mode = WIFI_OFF; }
+    if (_status == WL_CONNECTED) { hostDisconnect(); }
+    _status = WL_DISCONNECTED;
+    return true;
+}
+
+bool WiFiClass::softAP(const char* ssid, const char* passphrase) {
+    (void)ssid;
+    // Cihazdaki gibi WPA2 şifresi en az 8 karakter olmalıdır; boş şifre açık ağdır
+    if (passphrase && passphrase[0] && strlen(passphrase) < 8) { return false; }
+    _apPassword = passphrase ? passphrase : "";
+    _apStarted = true;
+    emit(ARDUINO_EVENT_WIFI_AP_START);
+    return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool wifiOff) {
+    (void)wifiOff;
+    if (_apStarted) { _apStarted = false; emit(ARDUINO_EVENT_WIFI_AP_STOP); }
+    return true;
+}
+
+void WiFiClass::hostConnect() {
+    if (!_staticIP) {
+        _localIP = IPAddress(127, 0, 0, 1);
+        _gateway = IPAddress(127, 0, 0, 1);
+        _subnet = IPAddress(255, 0, 0, 0);
+        _dns = IPAddress(127, 0, 0, 1);
+    }
+    _status = WL_CONNECTED;
+    emit(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+    emit(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+}
+
+void WiFiClass::hostDisconnect() {
+    _status = WL_DISCONNECTED;
+    emit(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+int16_t WiFiClass::scanNetworks(bool async, bool showHidden) {
+    (void)showHidden;
+    _scans++;
+    _scanStartedAt = millis();
+    _scanCount = WIFI_SCAN_RUNNING;
+    return async ? WIFI_SCAN_RUNNING : scanComplete();
+}
+
+int16_t WiFiClass::scanComplete() {
+    if (_scanCount == WIFI_SCAN_RUNNING && millis() - _scanStartedAt >= _scanDelayMs) { _scanCount = (int16_t)_scanResults.size(); }
+    return _scanCount;
+}
+
+String WiFiClass::SSID(uint8_t index) const { return index < _scanResults.size() ? String(_scanResults[index].ssid) : String(); }
+int32_t WiFiClass::RSSI(uint8_t index) const { return index < _scanResults.size() ? _scanResults[index].rssi : 0; }
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t index) const {
+    return index < _scanResults.size() && !_scanResults[index].open ? WIFI_AUTH_WPA2_PSK : WIFI_AUTH_OPEN;
+}
+int32_t WiFiClass::channel(uint8_t index) const { return index < _scanResults.size() ? _scanResults[index].channel : 0; }
+
+void WiFiClass::hostReset() {
+    _callbacks.clear();
+    _mode = WIFI_OFF;
+    _status = WL_IDLE_STATUS;
+    _apStarted = false;
+    _staticIP = false;
+    _autoConnect = true;
+    _apPassword = "";
+    _scanResults.clear();
+    _scanDelayMs = 0;
+    _scanCount = WIFI_SCAN_FAILED;
+    _scans = 0;
+}
+
+// --- WiFiClient ---
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+    stop();
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* result = nullptr;
+    char service[8];
+    snprintf(service, sizeof(service), "%u", port);
+    if (getaddrinfo(host, service, &hints, &result) != 0 || !result) { return 0; }
+    _fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+    if (_fd < 0) { freeaddrinfo(result); return 0; }
+    fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+    int one = 1;
+    setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    int rc = ::connect(_fd, result->ai_addr, result->ai_addrlen);
+    freeaddrinfo(result);
+    if (rc < 0 && errno != EINPROGRESS) { stop(); return 0; }
+    if (rc < 0) {
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (!wait(true, timeoutMs) || getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error != 0) { stop(); return 0; }
+    }
+    return 1;
+}
+
+bool WiFiClient::wait(bool forWrite, unsigned long timeoutMs) {
+    struct pollfd pfd = {_fd, (short)(forWrite ? POLLOUT : POLLIN), 0};
+    return poll(&pfd, 1, (int)timeoutMs) > 0;
+}
+
+uint8_t WiFiClient::connected() {
+    if (_fd < 0) { return 0; }
+    if (_peeked >= 0) { return 1; }
+    uint8_t probe;
+    ssize_t n = recv(_fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n == 0) { return 0; }
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) { return 0; }
+    return 1;
+}
+
+void WiFiClient::stop() {
+    if (_fd >= 0) { close(_fd); }
+    _fd = -1;
+    _peeked = -1;
+}
+
+int WiFiClient::available() {
+    if (_fd < 0) { return 0; }
+    int count = 0;
+    if (ioctl(_fd, FIONREAD, &count) < 0) { return 0; }
+    return count + (_peeked >= 0 ? 1 : 0);
+}
+
+int WiFiClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::peek() {
+    if (_peeked < 0) { _peeked = read(); }
+    return _peeked;
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+    if (_fd < 0 || size == 0) { return -1; }
+    int offset = 0;
+    if (_peeked >= 0) { buffer[0] = (uint8_t)_peeked; _peeked = -1; offset = 1; size--; }
+    if (size == 0) { return offset; }
+    ssize_t n = recv(_fd, buffer + offset, size, MSG_DONTWAIT);
+    if (n <= 0) { return offset > 0 ? offset : -1; }
+    return offset + (int)n;
+}
+
+size_t WiFiClient::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    unsigned long start = millis();
+    while (count < length) {
+        int n = read(buffer + count, length - count);
+        if (n > 0) { count += n; continue; }
+        unsigned long elapsed = millis() - start;
+        if (elapsed >= _timeout || !connected() || !wait(false, _timeout - elapsed)) { break; }
+    }
+    return count;
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+    size_t sent = 0;
+    while (_fd >= 0 && sent < size) {
+        ssize_t n = send(_fd, buffer + sent, size - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n > 0) { sent += n; continue; }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && wait(true, _timeout)) { continue; }
+        break;
+    }
+    return sent;
+}
+
+WiFiClient& WiFiClient::operator=(WiFiClient&& other) {
+    if (this != &other) {
+        stop();
+        _fd = other._fd; _peeked = other._peeked;
+        other._fd = -1; other._peeked = -1;
+    }
+    return *this;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+    struct sockaddr_in address;
+    socklen_t length = sizeof(address);
+    if (_fd < 0 || getpeername(_fd, (struct sockaddr*)&address, &length) < 0) { return IPAddress(); }
+    return IPAddress((uint32_t)address.sin_addr.s_addr);
+}
+
+int WiFiClient::setNoDelay(bool enabled) {
+    int value = enabled ? 1 : 0;
+    return _fd < 0 ? -1 : setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+}
+
+// --- WiFiServer ---
+
+static uint16_t listenPorts[8][2]; // {cihazdaki port, gerçek port}
+
+uint16_t hostListenPort(uint16_t port) {
+    for (auto& entry : listenPorts) {
+        if (entry[0] == port) { return entry[1]; }
+    }
+    return 0;
+}
+
+void WiFiServer::begin(uint16_t port) {
+    end();
+    if (port != 0) { _port = port; }
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_fd < 0) { return; }
+    int one = 1;
+    setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (bind(_fd, (struct sockaddr*)&address, sizeof(address)) < 0 || listen(_fd, _maxClients > 0 ? _maxClients : 1) < 0 ||
+        getsockname(_fd, (struct sockaddr*)&address, &length) < 0) {
+        end();
+        return;
+    }
+    fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+    for (auto& entry : listenPorts) {
+        if (entry[0] == _port || entry[0] == 0) { entry[0] = _port; entry[1] = ntohs(address.sin_port); break; }
+    }
+}
+
+void WiFiServer::end() {
+    if (_accepted >= 0) { ::close(_accepted); }
+    if (_fd >= 0) { ::close(_fd); }
+    _accepted = -1;
+    _fd = -1;
+}
+
+bool WiFiServer::hasClient() {
+    if (_accepted >= 0) { return true; }
+    if (_fd < 0) { return false; }
+    _accepted = ::accept(_fd, nullptr, nullptr);
+    if (_accepted < 0) { return false; }
+    fcntl(_accepted, F_SETFL, fcntl(_accepted, F_GETFL, 0) | O_NONBLOCK);
+    int size = HOST_TCP_SEND_BUFFER;
+    setsockopt(_accepted, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    if (_noDelay) {
+        int one = 1;
+        setsockopt(_accepted, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return true;
+}
+
+WiFiClient WiFiServer::available() {
+    if (!hasClient()) { return WiFiClient(); }
+    int fd = _accepted;
+    _accepted = -1;
+    return WiFiClient(fd);
+}
@@ -0,0 +1,199 @@
+// extras/host/shim/WiFi.h
+// WiFi bağlantısı taklit edilir; WiFiClient ise gerçek (geri döngü) TCP soketleri kullanır.
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <vector>
+#include "Arduino.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_AP_START,
+    ARDUINO_EVENT_WIFI_AP_STOP,
+    ARDUINO_EVENT_WIFI_AP_STACONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STADISCONNECTED
+} arduino_event_id_t;
+
+typedef struct {
+    uint8_t reason;
+} arduino_event_info_t;
+
+typedef enum { WIFI_AUTH_OPEN = 0, WIFI_AUTH_WEP, WIFI_AUTH_WPA_PSK, WIFI_AUTH_WPA2_PSK, WIFI_AUTH_WPA_WPA2_PSK } wifi_auth_mode_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+// hostSetScanResults() ile verilen tarama sonucu
+struct HostScanResult {
+    const char* ssid;
+    int32_t rssi;
+    bool open;
+    int32_t channel;
+};
+
+typedef std::function<void(arduino_event_id_t event, arduino_event_info_t info)> WiFiEventFuncCb;
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    // WiFiServer::available() kabul edilen soketi böyle sarar
+    explicit WiFiClient(int fd) : _fd(fd) {}
+    ~WiFiClient() { stop(); }
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+    WiFiClient(WiFiClient&& other) : _fd(other._fd), _peeked(other._peeked) { other._fd = -1; other._peeked = -1; }
+    WiFiClient& operator=(WiFiClient&& other);
+
+    int connect(const char* host, uint16_t port, int32_t timeoutMs = 3000);
+    uint8_t connected();
+    void stop();
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    int read(uint8_t* buffer, size_t size);
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    using Stream::readBytes;
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    operator bool() { return connected(); }
+    int fd() const { return _fd; }
+    IPAddress remoteIP() const;
+    int setNoDelay(bool enabled);
+
+private:
+    bool wait(bool forWrite, unsigned long timeoutMs);
+
+    int _fd = -1;
+    int _peeked = -1;
+};
+
+// Kabul edilen soketin gönderim tamponu (çekirdek bunu iki katına çıkarır): cihazdaki lwIP'nin TCP_SND_BUF'ı
+// (5744 bayt) kadar. Masaüstü çekirdeği tamponu megabaytlara büyüttüğü için aksi halde okumayan istemci hiç tıkanmaz.
+#ifndef HOST_TCP_SEND_BUFFER
+#define HOST_TCP_SEND_BUFFER 2872
+#endif
+
+// Geri döngü adresinde dinler. Cihazdaki port ayrıcalıklı olabileceği için sistemin verdiği bir porta
+// bağlanılır; gerçek port hostListenPort() ile bulunur.
+class WiFiServer {
+public:
+    explicit WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) : _port(port), _maxClients(maxClients) {}
+    ~WiFiServer() { end(); }
+
+    void begin(uint16_t port = 0);
+    void end();
+    void close() { end(); }
+    void stop() { end(); }
+    void setNoDelay(bool enabled) { _noDelay = enabled; }
+    // Bekleyen bağlantı var mı; bloklamaz
+    bool hasClient();
+    // Bekleyen bağlantıyı döndürür, yoksa bağlı olmayan bir istemci
+    WiFiClient available();
+    WiFiClient accept() { return available(); }
+    operator bool() const { return _fd >= 0; }
+
+private:
+    uint16_t _port;
+    uint8_t _maxClients;
+    bool _noDelay = false;
+    int _fd = -1;
+    int _accepted = -1;
+};
+
+// begin() varsayılan olarak hemen bağlanır ve 127.0.0.1 alır; hostSetAutoConnect(false) ile
+// olaylar hostConnect()/hostDisconnect() çağrılarıyla elle üretilir
+class WiFiClass {
+public:
+    int onEvent(WiFiEventFuncCb callback);
+    void persistent(bool enabled) { (void)enabled; }
+    void setAutoReconnect(bool enabled) { (void)enabled; }
+    bool mode(wifi_mode_t mode) { _mode = mode; return true; }
+    wifi_mode_t getMode() const { return _mode; }
+    bool config(IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = (uint32_t)0, IPAddress dns2 = (uint32_t)0);
+    wl_status_t begin(const char* ssid, const char* passphrase = nullptr, int32_t channel = 0, const uint8_t* bssid = nullptr, bool connect = true);
+    bool disconnect(bool wifiOff = false, bool eraseAp = false);
+    wl_status_t status() const { return _status; }
+    bool isConnected() const { return _status == WL_CONNECTED; }
+
+    IPAddress localIP() const { return _status == WL_CONNECTED ? _localIP : IPAddress(); }
+    IPAddress gatewayIP() const { return _gateway; }
+    IPAddress subnetMask() const { return _subnet; }
+    IPAddress dnsIP(uint8_t index = 0) const { (void)index; return _dns; }
+    uint8_t* BSSID() { return _bssid; }
+    int32_t channel() const { return _channel; }
+    String SSID() const { return _ssid; }
+
+    bool softAP(const char* ssid, const char* passphrase = nullptr);
+    bool softAPdisconnect(bool wifiOff = false);
+    IPAddress softAPIP() const { return _apStarted ? IPAddress(192, 168, 4, 1) : IPAddress(); }
+    const String& hostSoftAPPassword() const { return _apPassword; }
+
+    // async: hemen döner, sonuç hostSetScanDelay() kadar sonra scanComplete() ile alınır
+    int16_t scanNetworks(bool async = false, bool showHidden = false);
+    int16_t scanComplete();
+    void scanDelete() { _scanCount = WIFI_SCAN_FAILED; }
+    String SSID(uint8_t index) const;
+    int32_t RSSI(uint8_t index) const;
+    wifi_auth_mode_t encryptionType(uint8_t index) const;
+    int32_t channel(uint8_t index) const;
+
+    void hostSetAutoConnect(bool enabled) { _autoConnect = enabled; }
+    void hostSetScanResults(std::vector<HostScanResult> results) { _scanResults = results; }
+    void hostSetScanDelay(unsigned long ms) { _scanDelayMs = ms; }
+    uint32_t hostScans() const { return _scans; }
+    void hostConnect();
+    void hostDisconnect();
+    // Olay geri çağrılarını ve bağlantı durumunu siler
+    void hostReset();
+
+private:
+    void emit(arduino_event_id_t event);
+
+    std::vector<WiFiEventFuncCb> _callbacks;
+    wifi_mode_t _mode = WIFI_OFF;
+    wl_status_t _status = WL_IDLE_STATUS;
+    bool _autoConnect = true;
+    bool _apStarted = false;
+    bool _staticIP = false;
+    String _apPassword;
+    std::vector<HostScanResult> _scanResults;
+    unsigned long _scanDelayMs = 0;
+    unsigned long _scanStartedAt = 0;
+    int16_t _scanCount = WIFI_SCAN_FAILED;
+    uint32_t _scans = 0;
+    String _ssid;
+    IPAddress _localIP;
+    IPAddress _gateway;
+    IPAddress _subnet;
+    IPAddress _dns;
+    uint8_t _bssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+    int32_t _channel = 1;
+};
+extern WiFiClass WiFi;
+
+#endif
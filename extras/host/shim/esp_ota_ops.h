@@ -0,0 +1,25 @@
+// extras/host/shim/esp_ota_ops.h
+
+#ifndef HOST_ESP_OTA_OPS_H
+#define HOST_ESP_OTA_OPS_H
+
+#include "esp_partition.h"
+
+typedef struct {
+    uint32_t magic_word;
+    uint32_t secure_version;
+    uint32_t reserv1[2];
+    char version[32];
+    char project_name[32];
+    char time[16];
+    char date[16];
+    char idf_ver[32];
+    uint8_t app_elf_sha256[32];
+    uint32_t reserv2[20];
+} esp_app_desc_t;
+
+// hostSetRunningImage() ile verilen imajı sunar; ELF özeti olarak imajın SHA-256 özeti kullanılır
+const esp_partition_t* esp_ota_get_running_partition(void);
+esp_err_t esp_ota_get_partition_description(const esp_partition_t* partition, esp_app_desc_t* appDesc);
+
+#endif
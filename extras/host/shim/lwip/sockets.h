@@ -0,0 +1,14 @@
+// extras/host/shim/lwip/sockets.h
+// lwIP BSD soket arayüzü; masaüstünde doğrudan POSIX soketleridir.
+
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#endif
@@ -0,0 +1,12 @@
+// extras/host/shim/mbedtls/sha1.h
+// mbedtls SHA-1 arayüzünün bağımsız bir uygulaması (WebSocket el sıkışması için yalnızca tek seferlik özet).
+
+#ifndef HOST_MBEDTLS_SHA1_H
+#define HOST_MBEDTLS_SHA1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+int mbedtls_sha1(const unsigned char* input, size_t length, unsigned char output[20]);
+
+#endif
@@ -0,0 +1,33 @@
+// extras/host/shim/miniz.cpp
+
+#include <string.h>
+#include "rom/miniz.h"
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* inSize, mz_uint8* outStart,
+                              mz_uint8* outNext, size_t* outSize, const mz_uint32 flags) {
+    (void)outStart;
+    if (!r->started) {
+        memset(&r->stream, 0, sizeof(r->stream));
+        if (inflateInit2(&r->stream, (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15) != Z_OK) { return TINFL_STATUS_FAILED; }
+        r->started = 1;
+    }
+    r->stream.next_in = const_cast<mz_uint8*>(in);
+    r->stream.avail_in = (uInt)*inSize;
+    r->stream.next_out = outNext;
+    r->stream.avail_out = (uInt)*outSize;
+    int rc = inflate(&r->stream, Z_NO_FLUSH);
+    *inSize -= r->stream.avail_in;
+    *outSize -= r->stream.avail_out;
+    if (rc == Z_STREAM_END) {
+        inflateEnd(&r->stream);
+        r->started = 0;
+        return TINFL_STATUS_DONE;
+    }
+    if (rc != Z_OK && rc != Z_BUF_ERROR) {
+        inflateEnd(&r->stream);
+        r->started = 0;
+        return TINFL_STATUS_FAILED;
+    }
+    if (r->stream.avail_out == 0) { return TINFL_STATUS_HAS_MORE_OUTPUT; }
+    return (flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
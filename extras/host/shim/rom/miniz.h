@@ -0,0 +1,44 @@
+// extras/host/shim/rom/miniz.h
+// ESP32 ROM'undaki tinfl akış açıcısının zlib üzerinde karşılığı. Yalnızca kütüphanenin kullandığı
+// kalıp desteklenir: 32 KB'lık dairesel çıkış tamponu ve TINFL_FLAG_HAS_MORE_INPUT.
+
+#ifndef HOST_ROM_MINIZ_H
+#define HOST_ROM_MINIZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+typedef uint8_t mz_uint8;
+typedef uint32_t mz_uint32;
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+// Cihazdakinin aksine zlib akışı ilk çağrıda açılır ve akış bitince kapanır
+typedef struct {
+    z_stream stream;
+    int started;
+} tinfl_decompressor;
+
+#define tinfl_init(r) do { (r)->started = 0; } while (0)
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* inSize, mz_uint8* outStart,
+                              mz_uint8* outNext, size_t* outSize, const mz_uint32 flags);
+
+#endif
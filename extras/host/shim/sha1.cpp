@@ -0,0 +1,48 @@
+// extras/host/shim/sha1.cpp
+// FIPS 180-4 SHA-1
+
+#include <string.h>
+
+#include "mbedtls/sha1.h"
+
+static inline uint32_t rotl(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+static void transform(uint32_t state[5], const unsigned char block[64]) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) | ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+    }
+    for (int i = 16; i < 80; i++) { w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1); }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+        if (i < 20) { f = (b & c) | (~b & d); k = 0x5a827999; }
+        else if (i < 40) { f = b ^ c ^ d; k = 0x6ed9eba1; }
+        else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8f1bbcdc; }
+        else { f = b ^ c ^ d; k = 0xca62c1d6; }
+        uint32_t t = rotl(a, 5) + f + e + k + w[i];
+        e = d; d = c; c = rotl(b, 30); b = a; a = t;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e;
+}
+
+int mbedtls_sha1(const unsigned char* input, size_t length, unsigned char output[20]) {
+    uint32_t state[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    size_t offset = 0;
+    for (; offset + 64 <= length; offset += 64) { transform(state, input + offset); }
+    unsigned char last[128] = {0};
+    size_t rest = length - offset;
+    memcpy(last, input + offset, rest);
+    last[rest] = 0x80;
+    size_t blocks = rest < 56 ? 1 : 2;
+    uint64_t bits = (uint64_t)length * 8;
+    for (int i = 0; i < 8; i++) { last[blocks * 64 - 1 - i] = (unsigned char)(bits >> (8 * i)); }
+    for (size_t i = 0; i < blocks; i++) { transform(state, last + i * 64); }
+    for (int i = 0; i < 5; i++) {
+        output[i * 4] = (unsigned char)(state[i] >> 24);
+        output[i * 4 + 1] = (unsigned char)(state[i] >> 16);
+        output[i * 4 + 2] = (unsigned char)(state[i] >> 8);
+        output[i * 4 + 3] = (unsigned char)state[i];
+    }
+    return 0;
+}
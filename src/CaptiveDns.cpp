@@ -0,0 +1,102 @@
+// lib/ESP32Helper/CaptiveDns.cpp
+
+#include <lwip/sockets.h>
+
+#include "CaptiveDns.h"
+
+// RFC 1035 başlığı: kimlik, bayraklar, soru/cevap/yetki/ek sayıları (her biri 16 bit, büyük uçlu)
+static const size_t DNS_HEADER_SIZE = 12;
+static const size_t DNS_PACKET_SIZE = 512; // EDNS'siz UDP sınırı
+static const uint16_t DNS_TYPE_A = 1;
+static const uint16_t DNS_TYPE_ANY = 255;
+static const uint16_t DNS_CLASS_IN = 1;
+
+static uint16_t readU16(const uint8_t* p) { return (uint16_t)(p[0] << 8 | p[1]); }
+static void writeU16(uint8_t* p, uint16_t value) { p[0] = value >> 8; p[1] = value & 0xff; }
+
+bool CaptiveDns::begin(const IPAddress& address, uint16_t port) {
+    end();
+    _address = address;
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) { return false; }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (struct sockaddr*)&local, sizeof(local)) != 0) {
+        close(fd);
+        return false;
+    }
+    _fd = fd;
+    return true;
+}
+
+void CaptiveDns::end() {
+    if (_fd < 0) { return; }
+    close(_fd);
+    _fd = -1;
+}
+
+uint16_t CaptiveDns::port() const {
+    if (_fd < 0) { return 0; }
+    struct sockaddr_in local;
+    socklen_t size = sizeof(local);
+    if (getsockname(_fd, (struct sockaddr*)&local, &size) != 0) { return 0; }
+    return ntohs(local.sin_port);
+}
+
+void CaptiveDns::loop() {
+    if (_fd < 0) { return; }
+    uint8_t packet[DNS_PACKET_SIZE];
+    for (int i = 0; i < CAPTIVE_DNS_QUERIES_PER_LOOP; i++) {
+        struct sockaddr_in from;
+        socklen_t fromSize = sizeof(from);
+        int length = (int)recvfrom(_fd, packet, sizeof(packet), MSG_DONTWAIT, (struct sockaddr*)&from, &fromSize);
+        if (length < 0) { return; } // EAGAIN: bekleyen sorgu yok
+        _stats.queries++;
+        size_t reply = answer(packet, (size_t)length, sizeof(packet));
+        if (reply == 0) { _stats.dropped++; continue; }
+        sendto(_fd, packet, reply, MSG_DONTWAIT, (struct sockaddr*)&from, fromSize);
+    }
+}
+
+size_t CaptiveDns::answer(uint8_t* packet, size_t length, size_t capacity) {
+    if (length < DNS_HEADER_SIZE) { return 0; }
+    uint16_t flags = readU16(packet + 2);
+    // QR=0 (sorgu), OPCODE=0 (standart) ve tek soru
+    if ((flags & 0xf800) != 0 || readU16(packet + 4) != 1) { return 0; }
+
+    // Ad etiketleri; sorguda sıkıştırma işaretçisi beklenmez
+    size_t offset = DNS_HEADER_SIZE;
+    while (offset < length && packet[offset] != 0) {
+        if (packet[offset] & 0xc0) { return 0; }
+        offset += packet[offset] + 1;
+    }
+    if (offset + 5 > length) { return 0; }
+    uint16_t type = readU16(packet + offset + 1);
+    uint16_t qclass = readU16(packet + offset + 3);
+    size_t end = offset + 5; // Sorunun sonu; ardındaki ek kayıtlar atılır
+
+    bool isA = (type == DNS_TYPE_A || type == DNS_TYPE_ANY) && qclass == DNS_CLASS_IN;
+    writeU16(packet + 2, 0x8400 | (flags & 0x0100) | 0x0080); // QR, AA, istemcinin RD'si, RA; RCODE 0
+    writeU16(packet + 6, isA ? 1 : 0);
+    writeU16(packet + 8, 0);
+    writeU16(packet + 10, 0);
+    if (!isA) { _stats.empty++; return end; }
+    if (end + 16 > capacity) { return 0; }
+
+    // Soru adına işaretçi (0xc00c), A, IN, TTL, 4 baytlık adres
+    uint8_t* record = packet + end;
+    writeU16(record, 0xc00c);
+    writeU16(record + 2, DNS_TYPE_A);
+    writeU16(record + 4, DNS_CLASS_IN);
+    writeU16(record + 6, (uint16_t)(CAPTIVE_DNS_TTL >> 16));
+    writeU16(record + 8, (uint16_t)(CAPTIVE_DNS_TTL & 0xffff));
+    writeU16(record + 10, 4);
+    memcpy(record + 12, &_address, 4);
+    _stats.answered++;
+    return end + 16;
+}
@@ -0,0 +1,54 @@
+// lib/ESP32Helper/CaptiveDns.h
+
+#ifndef CAPTIVEDNS_H
+#define CAPTIVEDNS_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#ifndef CAPTIVE_DNS_PORT
+#define CAPTIVE_DNS_PORT 53
+#endif
+// Cevaplardaki TTL (sn); kısa tutulur ki STA'ya geçince telefon gerçek adreslere dönsün
+#ifndef CAPTIVE_DNS_TTL
+#define CAPTIVE_DNS_TTL 60
+#endif
+// Bir loop() çağrısında cevaplanan en fazla sorgu
+#ifndef CAPTIVE_DNS_QUERIES_PER_LOOP
+#define CAPTIVE_DNS_QUERIES_PER_LOOP 4
+#endif
+
+struct CaptiveDnsStats {
+    uint32_t queries = 0;  // Alınan paketler
+    uint32_t answered = 0; // AP adresiyle cevaplanan A sorguları
+    uint32_t empty = 0;    // Cevapsız (NOERROR) dönülen diğer türler (AAAA, HTTPS...)
+    uint32_t dropped = 0;  // Çözülemeyen ya da sorgu olmayan paketler
+};
+
+// AP modunda her ada AP adresini döndüren küçük DNS sunucusu; telefonların bağlantı kontrolü böylece
+// kurulum sayfasına düşer. Bloklamayan UDP soketi loop() içinde okunur, paket yığında değil yığıtta
+// işlenir. Yalnızca tek sorulu standart sorgular cevaplanır: A (ve ANY) için tek kayıt, diğer türler
+// için cevapsız NOERROR (telefon IPv4'e düşer); ek bölümler (EDNS) cevaba kopyalanmaz.
+class CaptiveDns {
+public:
+    ~CaptiveDns() { end(); }
+
+    bool begin(const IPAddress& address, uint16_t port = CAPTIVE_DNS_PORT);
+    void end();
+    void loop();
+    bool isRunning() const { return _fd >= 0; }
+    // Bağlanılan gerçek port (port 0 ile açıldıysa işletim sisteminin seçtiği)
+    uint16_t port() const;
+
+    const CaptiveDnsStats& stats() const { return _stats; }
+
+private:
+    // Sorgu paketini yerinde cevaba çevirir; gönderilecek uzunluğu ya da 0 döner
+    size_t answer(uint8_t* packet, size_t length, size_t capacity);
+
+    int _fd = -1;
+    uint32_t _address = 0;
+    CaptiveDnsStats _stats;
+};
+
+#endif
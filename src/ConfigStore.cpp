@@ -0,0 +1,201 @@
+// lib/ESP32Helper/ConfigStore.cpp
+
+#include "ConfigStore.h"
+
+// Doğrudan Preferences ile tek bir okuma/yazma: begin + get/put + end
+static const uint32_t NVS_OPS_PER_ACCESS = 3;
+
+ConfigStore::ConfigStore(const char* ns) : _ns(ns) {}
+
+ConfigStore::~ConfigStore() {
+    if (_lock) { vSemaphoreDelete(_lock); }
+}
+
+ConfigStore::Entry* ConfigStore::add(const char* key, ConfigType type) {
+    if (_count >= CONFIG_MAX_KEYS || strlen(key) > 15) { return nullptr; }
+    for (size_t i = 0; i < _count; i++) {
+        if (strcmp(_entries[i].key, key) == 0) { return nullptr; }
+    }
+    Entry* entry = &_entries[_count++];
+    entry->key = key;
+    entry->type = type;
+    return entry;
+}
+
+bool ConfigStore::addString(const char* key, const char* defaultValue) {
+    Entry* entry = add(key, CONFIG_STRING);
+    if (!entry) { return false; }
+    entry->defaultStr = defaultValue;
+    entry->str = defaultValue;
+    return true;
+}
+
+bool ConfigStore::addInt(const char* key, int32_t defaultValue) {
+    Entry* entry = add(key, CONFIG_INT);
+    if (!entry) { return false; }
+    entry->defaultNum = defaultValue;
+    entry->num = defaultValue;
+    return true;
+}
+
+bool ConfigStore::addBlob(const char* key) {
+    return add(key, CONFIG_BLOB) != nullptr;
+}
+
+ConfigStore::Entry* ConfigStore::find(const char* key, ConfigType type) {
+    for (size_t i = 0; i < _count; i++) {
+        if (_entries[i].type == type && strcmp(_entries[i].key, key) == 0) { return &_entries[i]; }
+    }
+    return nullptr;
+}
+
+void ConfigStore::begin() {
+    if (!_lock) { _lock = xSemaphoreCreateMutex(); }
+    lock();
+    _prefs.begin(_ns, true);
+    for (size_t i = 0; i < _count; i++) {
+        Entry& entry = _entries[i];
+        if (!_prefs.isKey(entry.key)) { continue; }
+        switch (entry.type) {
+            case CONFIG_STRING: entry.str = _prefs.getString(entry.key, entry.defaultStr); break;
+            case CONFIG_INT: entry.num = _prefs.getInt(entry.key, entry.defaultNum); break;
+            case CONFIG_BLOB: entry.blobLength = _prefs.getBytes(entry.key, entry.blob, sizeof(entry.blob)); break;
+        }
+    }
+    _prefs.end();
+    unlock();
+}
+
+void ConfigStore::loop() {
+    lock();
+    bool due = _dirty && millis() - _lastChange >= CONFIG_COMMIT_DELAY_MS;
+    unlock();
+    if (due) { commit(); }
+}
+
+// Tüm kirli anahtarlar tek bir begin/end çifti içinde yazılır
+void ConfigStore::commit() {
+    lock();
+    if (!_dirty) { unlock(); return; }
+    _prefs.begin(_ns, false);
+    uint32_t written = 0;
+    for (size_t i = 0; i < _count; i++) {
+        Entry& entry = _entries[i];
+        if (!entry.dirty) { continue; }
+        switch (entry.type) {
+            case CONFIG_STRING: _prefs.putString(entry.key, entry.str); break;
+            case CONFIG_INT: _prefs.putInt(entry.key, entry.num); break;
+            case CONFIG_BLOB:
+                if (entry.blobLength > 0) { _prefs.putBytes(entry.key, entry.blob, entry.blobLength); }
+                else { _prefs.remove(entry.key); }
+                break;
+        }
+        entry.dirty = false;
+        written++;
+    }
+    _prefs.end();
+    _stats.nvsWrites += written;
+    if (written > 1) { _stats.nvsOpsAvoided += (written - 1) * 2; }
+    _dirty = false;
+    unlock();
+}
+
+void ConfigStore::markDirty(Entry* entry) {
+    if (entry->dirty) { _stats.writesCoalesced++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS; }
+    entry->dirty = true;
+    _dirty = true;
+    _lastChange = millis();
+}
+
+// Değer kilit altında kopyalanır; dönen String başka görevin yazmasından etkilenmez
+String ConfigStore::getString(const char* key) {
+    Entry* entry = find(key, CONFIG_STRING);
+    if (!entry) { return String(); }
+    lock();
+    _stats.ramReads++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS;
+    String value = entry->str;
+    unlock();
+    return value;
+}
+
+int32_t ConfigStore::getInt(const char* key) {
+    Entry* entry = find(key, CONFIG_INT);
+    if (!entry) { return 0; }
+    lock();
+    _stats.ramReads++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS;
+    int32_t value = entry->num;
+    unlock();
+    return value;
+}
+
+size_t ConfigStore::getBlob(const char* key, void* out, size_t size) {
+    Entry* entry = find(key, CONFIG_BLOB);
+    if (!entry) { return 0; }
+    lock();
+    size_t length = entry->blobLength < size ? entry->blobLength : size;
+    if (entry->blobLength > 0) { _stats.ramReads++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS; }
+    memcpy(out, entry->blob, length);
+    unlock();
+    return length;
+}
+
+// Kilit çağıran tarafından tutulur
+void ConfigStore::assignString(Entry* entry, const String& value) {
+    if (entry->str == value) { _stats.writesUnchanged++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS; return; }
+    entry->str = value;
+    markDirty(entry);
+}
+
+void ConfigStore::assignInt(Entry* entry, int32_t value) {
+    if (entry->num == value) { _stats.writesUnchanged++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS; return; }
+    entry->num = value;
+    markDirty(entry);
+}
+
+void ConfigStore::setString(const char* key, const String& value) {
+    Entry* entry = find(key, CONFIG_STRING);
+    if (!entry) { return; }
+    lock();
+    assignString(entry, value);
+    unlock();
+}
+
+void ConfigStore::setInt(const char* key, int32_t value) {
+    Entry* entry = find(key, CONFIG_INT);
+    if (!entry) { return; }
+    lock();
+    assignInt(entry, value);
+    unlock();
+}
+
+void ConfigStore::setBlob(const char* key, const void* data, size_t size) {
+    Entry* entry = find(key, CONFIG_BLOB);
+    if (!entry || size > sizeof(entry->blob)) { return; }
+    lock();
+    if (entry->blobLength == size && memcmp(entry->blob, data, size) == 0) {
+        _stats.writesUnchanged++; _stats.nvsOpsAvoided += NVS_OPS_PER_ACCESS;
+    } else {
+        memcpy(entry->blob, data, size);
+        entry->blobLength = size;
+        markDirty(entry);
+    }
+    unlock();
+}
+
+// Anahtarı varsayılan değerine döndürür (blob için NVS'ten siler)
+void ConfigStore::reset(const char* key) {
+    for (size_t i = 0; i < _count; i++) {
+        Entry& entry = _entries[i];
+        if (strcmp(entry.key, key) != 0) { continue; }
+        lock();
+        switch (entry.type) {
+            case CONFIG_STRING: assignString(&entry, entry.defaultStr); break;
+            case CONFIG_INT: assignInt(&entry, entry.defaultNum); break;
+            case CONFIG_BLOB:
+                if (entry.blobLength > 0) { entry.blobLength = 0; markDirty(&entry); }
+                break;
+        }
+        unlock();
+        return;
+    }
+}
@@ -0,0 +1,94 @@
+// lib/ESP32Helper/ConfigStore.h
+
+#ifndef CONFIGSTORE_H
+#define CONFIGSTORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Kayıt edilebilecek en fazla anahtar sayısı ve ikili (blob) değerlerin en büyük boyutu
+#ifndef CONFIG_MAX_KEYS
+#define CONFIG_MAX_KEYS 16
+#endif
+#ifndef CONFIG_BLOB_SIZE
+#define CONFIG_BLOB_SIZE 32
+#endif
+// Son değişiklikten sonra NVS'e yazmadan önce beklenen süre; bu sürede gelen değişiklikler birleştirilir
+#ifndef CONFIG_COMMIT_DELAY_MS
+#define CONFIG_COMMIT_DELAY_MS 2000
+#endif
+
+enum ConfigType : uint8_t {
+    CONFIG_STRING,
+    CONFIG_INT,
+    CONFIG_BLOB
+};
+
+struct ConfigStats {
+    uint32_t ramReads = 0;        // RAM'den karşılanan okumalar
+    uint32_t nvsWrites = 0;       // NVS'e yapılan anahtar yazmaları
+    uint32_t writesCoalesced = 0; // Yazılmadan önce üzerine yazılan değişiklikler
+    uint32_t writesUnchanged = 0; // Değer aynı olduğu için atlanan yazmalar
+    uint32_t nvsOpsAvoided = 0;   // Doğrudan Preferences kullanımına göre kaçınılan begin/get/put/end çağrıları
+};
+
+// Tüm anahtarları begin() içinde bir kez okuyup RAM'den sunan, değişiklikleri toplu yazan ayar deposu.
+// Anahtarlar begin() öncesinde kaydedilmelidir; anahtar isimleri NVS sınırı gereği en fazla 15 karakterdir.
+// begin() sonrasında okuma ve yazmalar her görevden yapılabilir; değerler kopyalanarak döner.
+class ConfigStore {
+public:
+    explicit ConfigStore(const char* ns);
+    ~ConfigStore();
+
+    bool addString(const char* key, const char* defaultValue = "");
+    bool addInt(const char* key, int32_t defaultValue = 0);
+    bool addBlob(const char* key);
+
+    void begin();
+    void loop();
+    void commit();
+
+    String getString(const char* key);
+    int32_t getInt(const char* key);
+    size_t getBlob(const char* key, void* out, size_t size);
+
+    void setString(const char* key, const String& value);
+    void setInt(const char* key, int32_t value);
+    void setBlob(const char* key, const void* data, size_t size);
+    void reset(const char* key);
+
+    bool isDirty() const { return _dirty; }
+    const ConfigStats& stats() const { return _stats; }
+
+private:
+    struct Entry {
+        const char* key = nullptr;
+        ConfigType type = CONFIG_STRING;
+        bool dirty = false;
+        String str;
+        const char* defaultStr = "";
+        int32_t num = 0;
+        int32_t defaultNum = 0;
+        uint8_t blobLength = 0;
+        uint8_t blob[CONFIG_BLOB_SIZE];
+    };
+
+    Entry* add(const char* key, ConfigType type);
+    Entry* find(const char* key, ConfigType type);
+    void markDirty(Entry* entry);
+    void assignString(Entry* entry, const String& value);
+    void assignInt(Entry* entry, int32_t value);
+    void lock() const { if (_lock) { xSemaphoreTake(_lock, portMAX_DELAY); } }
+    void unlock() const { if (_lock) { xSemaphoreGive(_lock); } }
+
+    const char* _ns;
+    Preferences _prefs;
+    Entry _entries[CONFIG_MAX_KEYS];
+    size_t _count = 0;
+    bool _dirty = false;
+    unsigned long _lastChange = 0;
+    ConfigStats _stats;
+    SemaphoreHandle_t _lock = nullptr; // Ağ görevi ve uygulama aynı anda okuyup yazabilir
+};
+
+#endif
@@ -0,0 +1,62 @@
+// lib/ESP32Helper/ControlRegistry.h
+
+#ifndef CONTROLREGISTRY_H
+#define CONTROLREGISTRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Buton türlerini tanımlayan enum yapısı
+enum ButtonType {
+    BTN_BUTTON, // Bas-bırak tarzı normal buton
+    BTN_SWITCH  // Açık/Kapalı durumuna sahip anahtar
+};
+
+// Kontrol geri çağrısı; context kayıt sırasında verilen işaretçidir
+typedef void (*ControlCallback)(void* context, uint8_t id, bool state);
+
+// Bir kontrolün sabit bilgileri; name kopyalanmaz, flash'taki sabit metni (string literal) gösterir
+struct Control {
+    const char* name;
+    ControlCallback callback;
+    void* context;
+    uint8_t type;
+};
+
+// Sabit kapasiteli kontrol listesi: yığın kullanmaz, kimlik kayıt sırasıdır.
+// Durumlar bit dizisinde tutulur; N kontrol için N/8 bayt.
+// Arduino'ya bağımlı değildir; SpscQueue gibi masaüstünde de derlenir.
+template <size_t N>
+class ControlRegistry {
+    static_assert(N > 0 && N <= 256, "Kontrol kimlikleri tek bayta sigmali (ikili komut [0x01, id, durum])");
+
+public:
+    // Kimliği, liste doluysa -1 döner
+    int add(const char* name, ButtonType type, ControlCallback callback, void* context) {
+        if (_count >= N) { return -1; }
+        Control& control = _controls[_count];
+        control.name = name ? name : "";
+        control.callback = callback;
+        control.context = context;
+        control.type = (uint8_t)type;
+        setState(_count, false);
+        return (int)_count++;
+    }
+
+    size_t size() const { return _count; }
+    static constexpr size_t capacity() { return N; }
+    bool contains(size_t id) const { return id < _count; }
+    const Control& operator[](size_t id) const { return _controls[id]; }
+
+    bool state(size_t id) const { return (_states[id >> 5] >> (id & 31)) & 1; }
+    void setState(size_t id, bool on) {
+        if (on) { _states[id >> 5] |= 1u << (id & 31); } else { _states[id >> 5] &= ~(1u << (id & 31)); }
+    }
+
+private:
+    Control _controls[N];
+    uint32_t _states[(N + 31) / 32] = {0};
+    size_t _count = 0;
+};
+
+#endif
@@ -1,451 +1,1871 @@
 // lib/ESP32Helper/ESP32Helper.cpp
 
 #include <Preferences.h>
-#include <WebSocketsServer.h>
-#include <ArduinoOTA.h>
-#include <Update.h>
-#include <HTTPClient.h>
 #include <stdarg.h>
 
 #include "ESP32Helper.h"
+#if HELPER_FEATURE_ARDUINO_OTA
+#include <ArduinoOTA.h>
+#endif
+#if HELPER_FEATURE_WEB_OTA
+#include <Update.h>
+#endif
+#if HELPER_FEATURE_URL_OTA
+#include <HTTPClient.h>
+#include <esp_ota_ops.h>
+#endif
+#if HELPER_FEATURE_LOG_STORE
+#include <LittleFS.h>
+#endif
+#if !HELPER_HTTP_ENGINE && HELPER_WEBSOCKET
+#include <lwip/sockets.h>
+#endif
+#include "PanelHtml.h" // Kurulum sayfası her yapılandırmada vardır; panel kapalıysa kullanılmayan dizi bağlanmaz
 
 // --- Global Nesneler ---
-Preferences preferences;
-WebServer server(80);
-WebSocketsServer webSocket(81);
+#if HELPER_HTTP_ENGINE
+HttpEngine server(80);
+#if HELPER_WEBSOCKET
+HttpEngine& webSocket = server; // WebSocket aynı portta yükseltmeyle açılır
+#endif
+#else
+HelperWebServer server(80);
+
+void HelperWebServer::sendContent(TContentProducer producer) {
+    String chunk;
+    for (bool more = true; more;) {
+        more = producer(chunk);
+        if (chunk.length() > 0) { sendContent(chunk); chunk = ""; }
+    }
+    sendContent("");
+}
+
+#if HELPER_WEBSOCKET
+HelperSocketServer webSocket(81);
+
+// Sıfır bekleme süreli select(); yazılabilir soketin gönderim tamponunda en az TCP_SNDLOWAT kadar yer vardır
+size_t HelperSocketServer::availableForWrite(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !clientIsConnected(num) || !_clients[num].tcp) { return 0; }
+    int fd = _clients[num].tcp->fd();
+    if (fd < 0) { return 0; }
+    fd_set writable;
+    FD_ZERO(&writable);
+    FD_SET(fd, &writable);
+    struct timeval zero = {0, 0};
+    return select(fd + 1, nullptr, &writable, nullptr, &zero) > 0 ? HELPER_SOCKET_WRITE_SIZE : 0;
+}
+#endif
+#endif
 WebSerial_ WebSerial;
 
 // --- WebSerial_ Sınıfı Implementasyonu ---
 WebSerial_::WebSerial_() {}
-void WebSerial_::begin(WebSocketsServer* socket) { _socket = socket; }
-size_t WebSerial_::write(uint8_t c) { if (_socket) { _socket->broadcastTXT(&c, 1); } return 1; }
-size_t WebSerial_::write(const uint8_t *buffer, size_t size) { if (_socket) { _socket->broadcastTXT(buffer, size); } return size; }
+#if HELPER_FEATURE_WEBSERIAL
+void WebSerial_::begin(HelperSocketServer* socket) {
+    _socket = socket;
+    if (!_lock) { _lock = xSemaphoreCreateMutex(); }
+    // Kuyruklar bir kez, tek blok halinde ayrılır; bağlanıp kopan istemciler yığını parçalamaz
+    if (!_queues) {
+        _queues = (uint8_t*)malloc(WEBSOCKETS_SERVER_CLIENT_MAX * WEBSERIAL_CLIENT_QUEUE_SIZE);
+        if (!_queues) { return; }
+        for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) { _clients[num].data = _queues + num * WEBSERIAL_CLIENT_QUEUE_SIZE; }
+    }
+}
+#endif
+
+size_t WebSerial_::write(uint8_t c) { return write(&c, 1); }
+
+// Print üzerinden doğrudan yazılanlar bilgi seviyesinde sayılır
+size_t WebSerial_::write(const uint8_t *buffer, size_t size) { return append(buffer, size, HELPER_LOG_INFO); }
+
+// [saniye.ms] ve seviye harfi; printf'e gitmeden birkaç bölmeyle yazılır
+static size_t formatLogPrefix(char* out, HelperLogLevel level) {
+    static const char letters[] = "-EWIDV";
+    uint32_t ms = millis();
+    char digits[10];
+    size_t count = 0;
+    uint32_t seconds = ms / 1000;
+    do { digits[count++] = '0' + seconds % 10; seconds /= 10; } while (seconds > 0);
+    size_t len = 0;
+    out[len++] = '[';
+    while (count > 0) { out[len++] = digits[--count]; }
+    uint32_t fraction = ms % 1000;
+    out[len++] = '.';
+    out[len++] = '0' + fraction / 100;
+    out[len++] = '0' + fraction / 10 % 10;
+    out[len++] = '0' + fraction % 10;
+    out[len++] = ']';
+    out[len++] = ' ';
+    out[len++] = letters[level];
+    out[len++] = ' ';
+    return len;
+}
+
+void WebSerial_::logf(HelperLogLevel level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vlogf(level, format, args);
+    va_end(args);
+}
+
+// Satır yığın tamponunda bir kez biçimlendirilir ve eşiği geçen hedeflere aynı tampondan yazılır;
+// sığmayan satır "...\n" ile kırpılır, yığın ayrılmaz. Hiçbir hedef istemiyorsa biçimlendirme yapılmaz.
+void WebSerial_::vlogf(HelperLogLevel level, const char* format, va_list args) {
+    bool toSerial = level <= _levels[LOG_SINK_SERIAL];
+    bool wanted = toSerial;
+#if HELPER_FEATURE_WEBSERIAL
+    wanted = wanted || level <= _levels[LOG_SINK_WEBSOCKET] || level <= _levels[LOG_SINK_HISTORY];
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    wanted = wanted || (_store && level <= _levels[LOG_SINK_FLASH]);
+#endif
+    if (level == HELPER_LOG_NONE || !wanted) { return; }
+    char line[WEBSERIAL_LINE_SIZE];
+    size_t len = HELPER_LOG_TIMESTAMPS ? formatLogPrefix(line, level) : 0;
+    int written = vsnprintf(line + len, sizeof(line) - len, format, args);
+    if (written < 0) { return; }
+    len += written;
+    if (len >= sizeof(line)) { len = sizeof(line) - 1; memcpy(line + len - 4, "...\n", 4); }
+    if (toSerial) { Serial.write((const uint8_t*)line, len); }
+    append((const uint8_t*)line, len, level);
+}
+
+// Geçmiş satırı hemen kaydeder; WebSocket'e gidecekler tamponda birleştirilir. Flash deposunun kendi kilidi vardır.
+size_t WebSerial_::append(const uint8_t* buffer, size_t size, HelperLogLevel level) {
+#if HELPER_FEATURE_LOG_STORE
+    if (_store && level <= _levels[LOG_SINK_FLASH]) { _store->append(buffer, size, level <= HELPER_LOG_STORE_SYNC_LEVEL); }
+#endif
+#if HELPER_FEATURE_WEBSERIAL
+    bool toSocket = level <= _levels[LOG_SINK_WEBSOCKET];
+    bool toHistory = level <= _levels[LOG_SINK_HISTORY];
+    if (!toSocket && !toHistory) { return size; }
+    lock();
+    if (toHistory) { record(buffer, size); }
+    if (!toSocket) { unlock(); return size; }
+    _bytesLogged += size;
+    size_t remaining = size;
+    unsigned long waitStart = 0;
+    while (remaining > 0) {
+        if (_length == sizeof(_buffer)) {
+            if (canSend()) {
+                // Tampon doluysa tam satırları, hiç tam satır yoksa hepsini kuyruklara ekle; soketler kilit dışında
+                send(_lineEnd > 0 ? _lineEnd : _length);
+                unlock(); drainClients(WEBSERIAL_CLIENT_FRAMES_PER_DRAIN); lock();
+            } else {
+                // Gönderim ağ görevinde; boşaltmasını kısa süre bekle, gelmezse kalanı at
+                if (waitStart == 0) { waitStart = millis() | 1; }
+                if (millis() - waitStart >= WEBSERIAL_WRITE_WAIT_MS) { _bytesDropped += remaining; break; }
+                unlock(); vTaskDelay(1); lock();
+                continue;
+            }
+        }
+        if (_length == 0) { _pendingSince = millis(); }
+        size_t chunk = sizeof(_buffer) - _length;
+        if (chunk > remaining) { chunk = remaining; }
+        memcpy(_buffer + _length, buffer, chunk);
+        for (size_t i = chunk; i > 0; i--) {
+            if (buffer[i - 1] == '\n') { _lineEnd = _length + i; break; }
+        }
+        _length += chunk; buffer += chunk; remaining -= chunk;
+    }
+    unlock();
+#else
+    (void)buffer; (void)level;
+#endif
+    return size;
+}
+
+#if HELPER_FEATURE_WEBSERIAL
+
+// Bekleyen veri WEBSERIAL_FLUSH_TIMEOUT_MS kadar eskidiyse ya da tampon dolduysa tam satırlar kuyruklara eklenir;
+// ardından her istemcinin kuyruğu sınırlı sayıda çerçeveyle boşaltılır
+void WebSerial_::loop() {
+    bool evict[WEBSOCKETS_SERVER_CLIENT_MAX] = {false};
+    lock();
+    if (_length > 0 && (_length == sizeof(_buffer) || millis() - _pendingSince >= WEBSERIAL_FLUSH_TIMEOUT_MS)) {
+        send(_lineEnd > 0 ? _lineEnd : _length);
+    }
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        evict[num] = _socket && _clients[num].evict;
+        if (evict[num]) { _evictions++; }
+    }
+    unlock();
+    // Bağlantı kesme olayı tekrar log yazdığından kilit dışında yapılır
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        if (evict[num]) { _socket->disconnect(num); detachClient(num); }
+        else { drain(num, WEBSERIAL_CLIENT_FRAMES_PER_DRAIN); }
+    }
+}
+
+// Yeniden başlatma öncesi gibi durumlarda bekleyen her şey gönderilir; soketi dolu istemciler yine atlanır
+void WebSerial_::flush() {
+    if (!canSend()) { return; }
+    lock();
+    if (_length > 0) { send(_length); }
+    unlock();
+    drainClients(WEBSERIAL_CLIENT_QUEUE_SIZE);
+}
+
+// Çağıran kilidi tutuyor olmalıdır. Yalnızca kuyruklara ekler; sokete drain() yazar.
+void WebSerial_::send(size_t length) {
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        ClientQueue& client = _clients[num];
+        if (!client.stats.connected) { continue; }
+        enqueue(client, _buffer, length, client.stats.policy);
+    }
+    _length -= length;
+    if (_length > 0) { memmove(_buffer, _buffer + length, _length); _pendingSince = millis(); }
+    _lineEnd = _lineEnd > length ? _lineEnd - length : 0;
+}
+
+// Çağıran kilidi tutuyor olmalıdır. Yer açmak gerekirse yalnızca tam satırlar atılır.
+void WebSerial_::enqueue(ClientQueue& client, const uint8_t* data, size_t length, WebSerialPolicy policy) {
+    if (length > WEBSERIAL_CLIENT_QUEUE_SIZE) {
+        client.stats.bytesDropped += length - WEBSERIAL_CLIENT_QUEUE_SIZE;
+        data += length - WEBSERIAL_CLIENT_QUEUE_SIZE;
+        length = WEBSERIAL_CLIENT_QUEUE_SIZE;
+    }
+    size_t space = WEBSERIAL_CLIENT_QUEUE_SIZE - client.length;
+    if (length > space) {
+        if (policy == WEBSERIAL_COALESCE) {
+            char notice[40];
+            int noticeLength = snprintf(notice, sizeof(notice), "... %u bayt atlandi\n", (unsigned)client.length);
+            client.stats.bytesDropped += client.length;
+            memcpy(client.data, notice, noticeLength);
+            client.length = noticeLength;
+            space = WEBSERIAL_CLIENT_QUEUE_SIZE - client.length;
+            if (length > space) { client.stats.bytesDropped += length - space; data += length - space; length = space; }
+        } else {
+            size_t cut = client.length;
+            for (size_t i = length - space - 1; i < client.length; i++) {
+                if (client.data[i] == '\n') { cut = i + 1; break; }
+            }
+            client.stats.bytesDropped += cut;
+            client.length -= cut;
+            memmove(client.data, client.data + cut, client.length);
+            space = WEBSERIAL_CLIENT_QUEUE_SIZE - client.length;
+            if (length > space) { client.stats.bytesDropped += length - space; data += length - space; length = space; }
+        }
+    }
+    memcpy(client.data + client.length, data, length);
+    client.length += length;
+    if (client.length > client.stats.peakDepth) { client.stats.peakDepth = client.length; }
+    if (policy == WEBSERIAL_DISCONNECT && client.length > WEBSERIAL_DISCONNECT_THRESHOLD) { client.evict = true; }
+}
+
+void WebSerial_::drainClients(int maxFrames) {
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) { drain(num, maxFrames); }
+}
+
+// Kilit tutulmadan, sahip görevden çağrılır. Her çerçeve kilit altında kuyruktan _frame'e alınır ve kilit
+// bırakılınca gönderilir; çerçeve soketin beklemeden kabul edeceği kadardır ve satır sınırında bölünür.
+void WebSerial_::drain(uint8_t num, int maxFrames) {
+    if (!_socket || !canSend()) { return; }
+    lock();
+    bool pending = _clients[num].stats.connected && _clients[num].length > 0;
+    unlock();
+    if (!pending) { return; } // Boş kuyruk için sokete sorulmaz
+    while (maxFrames-- > 0) {
+        size_t room = _socket->availableForWrite(num);
+        lock();
+        ClientQueue& client = _clients[num];
+        if (!client.stats.connected || client.evict || client.length == 0) { unlock(); return; }
+        if (room == 0) {
+            // Soket dolu; veri kuyrukta bekler, politika taşmayı enqueue() içinde karşılar
+            if (!client.blocked) { client.blocked = true; client.stats.stalls++; }
+            unlock();
+            return;
+        }
+        client.blocked = false;
+        size_t length = client.length;
+        if (room > sizeof(_frame)) { room = sizeof(_frame); }
+        if (length > room) {
+            length = room;
+            for (size_t i = length; i > 0; i--) {
+                if (client.data[i - 1] == '\n') { length = i; break; }
+            }
+        }
+        memcpy(_frame, client.data, length);
+        client.length -= length;
+        memmove(client.data, client.data + length, client.length);
+        unlock();
+
+        bool sent = _socket->sendTXT(num, _frame, length);
+        lock();
+        if (sent) {
+            client.stats.framesSent++; client.stats.bytesSent += length;
+            _framesSent++; _bytesSent += length;
+        } else {
+            // İstemci olaysız kopmuş; kuyruk boşaltılır
+            client.length = 0;
+            client.stats.connected = false;
+        }
+        unlock();
+        if (!sent) { return; }
+    }
+}
+
+void WebSerial_::attachClient(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return; }
+    lock();
+    // Bekleyen satırlar geçmişte zaten var; yeni istemciye ikinci kez gitmemeleri için önce diğerlerine gönderilir
+    if (_length > 0 && canSend()) { send(_length); }
+    ClientQueue& client = _clients[num];
+    client.length = 0;
+    client.blocked = false;
+    client.evict = false;
+    client.stats = WebSerialClientStats();
+    client.stats.policy = _policy;
+    client.stats.connected = client.data != nullptr;
+    if (client.data) { replayHistory(client); }
+    unlock();
+    drain(num, WEBSERIAL_CLIENT_FRAMES_PER_DRAIN);
+}
+
+void WebSerial_::detachClient(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return; }
+    lock();
+    ClientQueue& client = _clients[num];
+    client.length = 0;
+    client.evict = false;
+    client.stats.connected = false;
+    unlock();
+}
+
+void WebSerial_::setClientPolicy(WebSerialPolicy policy) {
+    lock();
+    _policy = policy;
+    for (ClientQueue& client : _clients) { client.stats.policy = policy; }
+    unlock();
+}
+
+void WebSerial_::setClientPolicy(uint8_t num, WebSerialPolicy policy) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return; }
+    lock();
+    _clients[num].stats.policy = policy;
+    unlock();
+}
+
+WebSerialClientStats WebSerial_::clientStats(uint8_t num) const {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) { return WebSerialClientStats(); }
+    lock();
+    WebSerialClientStats stats = _clients[num].stats;
+    stats.depth = _clients[num].length;
+    unlock();
+    return stats;
+}
+
+void WebSerial_::record(const uint8_t* data, size_t length) {
+    if (length >= sizeof(_history)) {
+        memcpy(_history, data + length - sizeof(_history), sizeof(_history));
+        _historyHead = 0; _historyWrapped = true;
+        return;
+    }
+    size_t first = sizeof(_history) - _historyHead;
+    if (first > length) { first = length; }
+    memcpy(_history + _historyHead, data, first);
+    memcpy(_history, data + first, length - first);
+    _historyHead += length;
+    if (_historyHead >= sizeof(_history)) { _historyHead -= sizeof(_history); _historyWrapped = true; }
+}
+
+// Geçmiş yeni istemcinin kuyruğuna eklenir (sığmayan en eski satırlar atılır); taşmış tamponda yarım kalan ilk satır atlanır
+void WebSerial_::replayHistory(ClientQueue& client) {
+    if (!_historyWrapped) {
+        if (_historyHead > 0) { enqueue(client, _history, _historyHead, WEBSERIAL_DROP_OLDEST); }
+        return;
+    }
+    size_t start = _historyHead;
+    for (size_t i = 0; i < sizeof(_history); i++) {
+        size_t pos = (_historyHead + i) % sizeof(_history);
+        if (_history[pos] == '\n') { start = (pos + 1) % sizeof(_history); break; }
+    }
+    if (start >= _historyHead) {
+        if (start < sizeof(_history)) { enqueue(client, _history + start, sizeof(_history) - start, WEBSERIAL_DROP_OLDEST); }
+        if (_historyHead > 0) { enqueue(client, _history, _historyHead, WEBSERIAL_DROP_OLDEST); }
+    } else {
+        enqueue(client, _history + start, _historyHead - start, WEBSERIAL_DROP_OLDEST);
+    }
+    client.stats.bytesDropped = 0; // Geçmişten sığmayanlar kayıp sayılmaz
+}
+#else
+// Seri port yazması vlogf() içinde doğrudan yapılır; bekletilen bir şey yoktur
+void WebSerial_::flush() {}
+#endif
+
+// --- Yardımcı Fonksiyonlar ---
+
+static void appendJsonString(String& out, const char* value) {
+    out += '"';
+    for (; *value; value++) {
+        char c = *value;
+        if (c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if ((uint8_t)c < 0x20) { char esc[7]; snprintf(esc, sizeof(esc), "\\u%04x", c); out += esc; }
+        else { out += c; }
+    }
+    out += '"';
+}
+
+static void appendJsonString(String& out, const String& value) { appendJsonString(out, value.c_str()); }
 
 // --- ESP32Helper Sınıfı Implementasyonu ---
 
 ESP32Helper::ESP32Helper(const char* hostname, const char* firmwareVersion, std::function<void(String)> messageCallback)
-    : _hostname(hostname), _firmwareVersion(firmwareVersion), _messageCallback(messageCallback) {}
+    : _hostname(hostname), _firmwareVersion(firmwareVersion),
+#if HELPER_FEATURE_WEB_OTA
+      _upload(_firmware),
+#endif
+#if HELPER_FEATURE_PANEL
+      _messageCallback(messageCallback),
+#endif
+      _config("esp32helper") {
+    (void)messageCallback;
+    _config.addString("ssid");
+    _config.addString("password");
+#if HELPER_FEATURE_URL_OTA
+    _config.addString("ota_url");
+    _config.addString("ota_etag");
+#endif
+    _config.addBlob("wifi_cache");
+}
 
 void ESP32Helper::begin() {
+    _bootMs = millis();
     Serial.begin(115200);
+#if HELPER_FEATURE_WEBSERIAL
     WebSerial.begin(&webSocket);
-    webPrintf("Firmware Versiyonu: %s\n", _firmwareVersion.c_str());
-    connectToWifi();
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    // Açılış logları da flash'a gitsin diye ilk iş olarak bağlanır; bağlanamazsa bir kez biçimlendirilir
+    if (_logStoreEnabled) {
+        if (LittleFS.begin(true) && _logStore.begin(LittleFS)) { WebSerial.setStore(&_logStore); }
+        else { HELPER_LOGW("Log deposu acilamadi\n"); }
+    }
+#endif
+    HELPER_LOGI("Firmware Versiyonu: %s\n", _firmwareVersion.c_str());
+#if HELPER_FEATURE_URL_OTA
+    // Çalışan imajın ELF SHA-256 özeti; sunucu buna göre delta yaması seçebilir
+    esp_app_desc_t appDesc;
+    if (esp_ota_get_partition_description(esp_ota_get_running_partition(), &appDesc) == ESP_OK) {
+        char hex[65];
+        for (int i = 0; i < 32; i++) { snprintf(hex + i * 2, 3, "%02x", appDesc.app_elf_sha256[i]); }
+        _firmwareBase = hex;
+    }
+#endif
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t) {
+        if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) { _wifiGotIp = true; }
+        else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) { _wifiDisconnected = true; }
+    });
+    _config.begin();
+    migrateLegacyConfig();
+    startWebServer();
+    if (_config.getString("ssid").length() > 0) {
+        WiFi.persistent(false);
+        WiFi.setAutoReconnect(false);
+        WiFi.mode(WIFI_STA);
+        HELPER_LOGI("Kayitli aga baglaniliyor: %s\n", _config.getString("ssid").c_str());
+        connectToWifi(true);
+    } else {
+        startAPMode();
+    }
+    HELPER_LOGD("begin() suresi: %lu ms\n", millis() - _bootMs);
+    if (_networkTaskEnabled) {
+        BaseType_t core = _networkCore >= 0 ? _networkCore : (xPortGetCoreID() == 0 ? 1 : 0);
+        if (xTaskCreatePinnedToCore(networkTask, "esp32helper_net", NETWORK_TASK_STACK_SIZE, this, NETWORK_TASK_PRIORITY, &_networkTaskHandle, core) == pdPASS) {
+#if HELPER_FEATURE_WEBSERIAL
+            WebSerial.setOwner(_networkTaskHandle);
+#endif
+            HELPER_LOGD("Ag gorevi cekirdek %d uzerinde calisiyor\n", (int)core);
+        } else {
+            _networkTaskEnabled = false;
+            HELPER_LOGW("Ag gorevi olusturulamadi, loop() icinde devam ediliyor\n");
+        }
+    }
+}
+
+void ESP32Helper::enableNetworkTask(int core) {
+    _networkTaskEnabled = true;
+    _networkCore = core;
+}
+
+void ESP32Helper::networkTask(void* arg) {
+    ESP32Helper* self = static_cast<ESP32Helper*>(arg);
+    for (;;) {
+#if HELPER_FEATURE_METRICS
+        uint32_t start = ESP.getCycleCount();
+        self->networkLoop();
+        self->_networkDuration.observe(ESP.getCycleCount() - start);
+#else
+        self->networkLoop();
+#endif
+        vTaskDelay(1); // Aynı çekirdekteki WiFi/lwIP görevlerine ve watchdog'a zaman tanı
+    }
 }
 
+// Ağ görevi modunda uygulamanın loop()'u yalnızca kuyruğu boşaltır; yavaş kullanıcı kodu HTTP/WS'i bekletmez
 void ESP32Helper::loop() {
+#if HELPER_FEATURE_METRICS
+    uint32_t start = ESP.getCycleCount();
+    if (_lastLoopStart != 0) { _loopInterval.observe(start - _lastLoopStart); }
+    _lastLoopStart = start | 1;
+#endif
+    if (!_networkTaskEnabled) { networkLoop(); }
+#if HELPER_FEATURE_PANEL
+    dispatchEvents();
+#endif
+#if HELPER_FEATURE_METRICS
+    _loopDuration.observe(ESP.getCycleCount() - start);
+#endif
+}
+
+#if HELPER_FEATURE_PANEL
+void ESP32Helper::dispatchEvents() {
+    PanelEvent event;
+    while (_events.pop(event)) {
+        if (event.type == EVENT_BUTTON) {
+            const Control& control = _controls[event.index];
+            control.callback(control.context, (uint8_t)event.index, event.state);
+        } else if (event.type == EVENT_MESSAGE) {
+            if (_messageCallback) { _messageCallback(String(event.text, event.length)); }
+        }
+    }
+}
+#endif
+
+void ESP32Helper::networkLoop() {
     server.handleClient();
+#if HELPER_WEBSOCKET
     webSocket.loop();
+#endif
+#if HELPER_FEATURE_WEBSERIAL
+    WebSerial.loop();
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    _logStore.loop();
+#endif
+    _config.loop();
+    updateWifi();
+    updateAPMode();
+#if HELPER_FEATURE_URL_OTA
+    updateUrlOta();
+#endif
+#if HELPER_FEATURE_PANEL
+    updateTelemetry();
+    sendPanelFrames();
+#endif
+    updateRestart();
+#if HELPER_FEATURE_ARDUINO_OTA
     if (_sta_connected) {
-        // --- YENİ: WiFi yeniden bağlanma mantığı ---
-        if (WiFi.status() != WL_CONNECTED) {
-            // Her 30 saniyede bir yeniden bağlanmayı dene (bloke etmez)
-            if (millis() - _lastReconnectAttempt > 30000) {
-                webPrintln("WiFi baglantisi koptu. Yeniden baglaniliyor...");
-                _lastReconnectAttempt = millis();
-                WiFi.reconnect();
-            }
-        }
-        // --- BİTTİ ---
-
         ArduinoOTA.handle();
     }
+#endif
+}
+
+#if HELPER_FEATURE_PANEL
+
+int ESP32Helper::addButton(const char* name, ButtonType type, ControlCallback callback, void* context) {
+    // Ağ görevi kontrol listesini kilitsiz okur; liste yalnızca görev başlamadan değişebilir
+    if (_networkTaskHandle) { HELPER_LOGW("addButton() ag gorevi basladiktan sonra cagrilamaz\n"); return -1; }
+    int id = _controls.add(name, type, callback, context);
+    if (id < 0) { HELPER_LOGW("Buton eklenemedi, en fazla %u kontrol (HELPER_MAX_CONTROLS)\n", (unsigned)_controls.capacity()); }
+    return id;
+}
+
+// Yakalamasız lambda ve düz fonksiyonlar için: fonksiyon işaretçisi context olarak saklanır
+static void invokePlainCallback(void* context, uint8_t id, bool state) {
+    (void)id;
+    reinterpret_cast<void (*)(bool)>(context)(state);
 }
 
-void ESP32Helper::addButton(const String& name, ButtonType type, std::function<void(bool)> callback) {
-    CustomButton newButton;
-    newButton.name = name;
-    newButton.type = type;
-    newButton.callback = callback;
-    newButton.id = "btn_" + String(_buttons.size());
-    _buttons.push_back(newButton);
+int ESP32Helper::addButton(const char* name, ButtonType type, void (*callback)(bool)) {
+    return addButton(name, type, callback ? invokePlainCallback : nullptr, reinterpret_cast<void*>(callback));
+}
+
+int ESP32Helper::addSeries(const char* name, const char* unit, uint8_t decimals) {
+    if (_networkTaskHandle) { HELPER_LOGW("addSeries() ag gorevi basladiktan sonra cagrilamaz\n"); return -1; }
+    int id = _telemetry.add(name, unit, decimals);
+    if (id < 0) { HELPER_LOGW("Seri eklenemedi, en fazla %u seri (TELEMETRY_MAX_SERIES)\n", (unsigned)TELEMETRY_MAX_SERIES); }
+    return id;
+}
+#endif
+
+// Kullanıcı logları bilgi seviyesindedir; satır tek seferde biçimlendirilip yazılır, böylece görevler karışmaz
+void ESP32Helper::webPrintln(const char* message) {
+    WebSerial.logf(HELPER_LOG_INFO, "%s\r\n", message);
 }
 
 void ESP32Helper::webPrintln(const String& message) {
-    Serial.println(message);
-    WebSerial.println(message);
+    webPrintln(message.c_str());
 }
 
 void ESP32Helper::webPrintf(const char* format, ...) {
-    char loc_buf[128]; char* temp = loc_buf; va_list arg; va_list copy; va_start(arg, format);
-    va_copy(copy, arg); int len = vsnprintf(temp, sizeof(loc_buf), format, copy); va_end(copy);
-    if (len < 0) { va_end(arg); return; };
-    if (len >= sizeof(loc_buf)) {
-        temp = (char*)malloc(len + 1);
-        if (temp == NULL) { va_end(arg); return; }
-        len = vsnprintf(temp, len + 1, format, arg);
-    }
-    va_end(arg); Serial.print(temp); WebSerial.print(temp);
-    if (temp != loc_buf) { free(temp); }
-}
-
-void ESP32Helper::connectToWifi() {
-    preferences.begin("wifi-creds", true);
-    String ssid = preferences.getString("ssid", "");
-    String password = preferences.getString("password", "");
-    preferences.end();
-    if (ssid.length() > 0) {
-        WiFi.begin(ssid.c_str(), password.c_str());
-        webPrintf("Kayitli aga baglaniliyor: %s\n", ssid.c_str());
-        int attempts = 0;
-        while (WiFi.status() != WL_CONNECTED && attempts < 20) { delay(500); Serial.print("."); attempts++; }
-        if (WiFi.status() == WL_CONNECTED) {
-            webPrintln("\nBaglanti basarili!");
-            webPrintf("IP Adresi: %s\n", WiFi.localIP().toString().c_str());
-            _sta_connected = true; 
-            _lastReconnectAttempt = millis(); // Başarılı bağlantıda zamanlayıcıyı sıfırla
-            setupOTA(); 
-            startWebServer(); 
-            autoUpdateCheck();
-            return;
+    va_list args;
+    va_start(args, format);
+    WebSerial.vlogf(HELPER_LOG_INFO, format, args);
+    va_end(args);
+}
+
+// Bir bağlantı denemesi başlatır ve hemen döner; sonucu updateWifi() takip eder.
+// Hızlı yolda kayıtlı BSSID/kanal ile tarama atlanır, kayıtlı IP ile DHCP beklenmez.
+void ESP32Helper::connectToWifi(bool allowFastPath) {
+    WifiCache cache;
+    _wifiFastPath = false;
+    if (allowFastPath) {
+        _wifiFastPath = _config.getBlob("wifi_cache", &cache, sizeof(cache)) == sizeof(cache);
+    }
+    _wifiGotIp = false;
+    _wifiDisconnected = false;
+    if (_wifiFastPath) {
+        WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+        WiFi.begin(_config.getString("ssid").c_str(), _config.getString("password").c_str(), cache.channel, cache.bssid);
+    } else {
+        WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+        WiFi.begin(_config.getString("ssid").c_str(), _config.getString("password").c_str());
+    }
+    _wifiState = CONN_CONNECTING;
+    _wifiStateSince = millis();
+}
+
+void ESP32Helper::updateWifi() {
+    unsigned long now = millis();
+    switch (_wifiState) {
+        case CONN_CONNECTING: {
+            if (_wifiGotIp) { onWifiConnected(); break; }
+            unsigned long elapsed = now - _wifiStateSince;
+            unsigned long timeout = _wifiFastPath ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS;
+            // Önceki denemeden gecikmeli gelen kopma olayları kısa bir süre yok sayılır
+            bool failed = _wifiDisconnected && elapsed >= WIFI_EVENT_GRACE_MS;
+            if (!failed && elapsed < timeout) { break; }
+            WiFi.disconnect();
+            if (_wifiFastPath) {
+                // Kayıtlı ağ bilgisi geçersiz olabilir; beklemeden tam tarama ile tekrar dene
+                HELPER_LOGW("Hizli baglanti basarisiz, tam tarama ile deneniyor.\n");
+                connectToWifi(false);
+                break;
+            }
+            _wifiFailures++;
+            unsigned long backoff = WIFI_BACKOFF_MIN_MS << (_wifiFailures < 7 ? _wifiFailures - 1 : 6);
+            if (backoff > WIFI_BACKOFF_MAX_MS) { backoff = WIFI_BACKOFF_MAX_MS; }
+            HELPER_LOGW("Baglanti basarisiz, %lu ms sonra tekrar denenecek.\n", backoff);
+            _wifiBackoffMs = backoff;
+            _wifiState = CONN_BACKOFF;
+            _wifiStateSince = now;
+            // Yeniden başlatma olmadığından hatalı /savewifi cihazı AP'siz bırakmamalı: önceki ağa dönülür
+            // ve AP açılır. Durum önce değişir: bağlantı denemesi sürerken tarama başlatılmaz.
+            bool provisionFailed = _provisionStart != 0 && _wifiFailures >= HELPER_PROVISION_MAX_FAILURES;
+            if (provisionFailed && _previousSsid.length() > 0) { restorePreviousWifi(); }
+            if (!_apStarted && (!_sta_connected || provisionFailed)) { startAPMode(); }
+            break;
         }
-        webPrintln("\nBaglanti basarisiz.");
+        case CONN_BACKOFF:
+            if (now - _wifiStateSince >= _wifiBackoffMs) {
+                _wifiStats.reconnectAttempts++;
+                connectToWifi(true);
+            }
+            break;
+        case CONN_ONLINE:
+            if (_wifiDisconnected) {
+                HELPER_LOGW("WiFi baglantisi koptu. Yeniden baglaniliyor...\n");
+                _linkUp = false;
+                publishNetworkState();
+                _wifiDisconnectedAt = now;
+                _wifiStats.reconnectAttempts++;
+                connectToWifi(true);
+            }
+            break;
+        default:
+            break;
     }
-    _sta_connected = false; startAPMode(); startWebServer();
 }
 
+void ESP32Helper::onWifiConnected() {
+    unsigned long now = millis();
+    _wifiState = CONN_ONLINE;
+    _wifiFailures = 0;
+    _linkUp = true;
+    if (_wifiFastPath) { _wifiStats.fastConnects++; }
+    HELPER_LOGI("Baglanti basarili! (%s, %lu ms)\n", _wifiFastPath ? "hizli yol" : "tam tarama", now - _wifiStateSince);
+    HELPER_LOGI("IP Adresi: %s\n", WiFi.localIP().toString().c_str());
+    if (_wifiDisconnectedAt != 0) {
+        _wifiStats.lastReconnectMs = now - _wifiDisconnectedAt;
+        HELPER_LOGD("Yeniden baglanma suresi: %lu ms\n", (unsigned long)_wifiStats.lastReconnectMs);
+        _wifiDisconnectedAt = 0;
+    }
+    saveWifiCache();
+    bool provisioned = _provisionStart != 0;
+    if (provisioned) {
+        _wifiStats.provisionToOnlineMs = now - _provisionStart;
+        _provisionStart = 0;
+        HELPER_LOGD("Kurulumdan cevrimici olmaya: %lu ms\n", (unsigned long)_wifiStats.provisionToOnlineMs);
+    }
+    if (_apStarted) {
+        // Kurulum sayfası sonucu AP üzerinden okuyabilsin diye AP bir süre daha açık kalır
+        if (provisioned && HELPER_AP_LINGER_MS > 0) { _apCloseAt = (now + HELPER_AP_LINGER_MS) | 1; }
+        else { stopAPMode(); }
+    }
+    publishNetworkState();
+    if (!_sta_connected) {
+        _sta_connected = true;
+        _wifiStats.bootToOnlineMs = now - _bootMs;
+        HELPER_LOGD("Acilistan cevrimici olmaya: %lu ms\n", (unsigned long)_wifiStats.bootToOnlineMs);
+#if HELPER_FEATURE_ARDUINO_OTA
+        setupOTA();
+#endif
+#if HELPER_FEATURE_URL_OTA
+        startUrlUpdate();
+#endif
+    }
+}
+
+// Son başarılı bağlantının BSSID, kanal ve IP ayarları; ayar deposu yalnızca değiştiğinde yazar
+void ESP32Helper::saveWifiCache() {
+    WifiCache cache;
+    memset(&cache, 0, sizeof(cache));
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel = WiFi.channel();
+    cache.ip = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.subnet = WiFi.subnetMask();
+    cache.dns = WiFi.dnsIP();
+    _config.setBlob("wifi_cache", &cache, sizeof(cache));
+}
+
+// Eski sürümlerin "wifi-creds" ve "ota" alanlarındaki ayarlar bir kez tek alana taşınır.
+// URL OTA derlenmemişse eski URL kopyalanmaz, yalnızca silinir.
+void ESP32Helper::migrateLegacyConfig() {
+    static const struct { const char* ns; const char* key; bool copy; } legacy[] = {
+        {"wifi-creds", "ssid", true}, {"wifi-creds", "password", true}, {"ota", "ota_url", HELPER_FEATURE_URL_OTA != 0}
+    };
+    Preferences preferences;
+    for (const auto& item : legacy) {
+        if (!preferences.begin(item.ns, true)) { continue; }
+        bool found = preferences.isKey(item.key);
+        if (found && item.copy) { _config.setString(item.key, preferences.getString(item.key, "")); }
+        preferences.end();
+        if (found) { preferences.begin(item.ns, false); preferences.remove(item.key); preferences.end(); }
+    }
+    _config.commit();
+}
+
+// Yeniden başlatma ağ döngüsüne bırakılır: istek yolu beklemez, cevap bu sürede istemciye ulaşır
+void ESP32Helper::restartDevice(unsigned long delayMs) {
+    _restartAt = (millis() + delayMs) | 1;
+}
+
+// Bekleyen log ve ayarları kaybetmeden yeniden başlatır
+void ESP32Helper::updateRestart() {
+    if (_restartAt == 0 || (long)(millis() - _restartAt) < 0) { return; }
+    _config.commit();
+    WebSerial.flush();
+#if HELPER_FEATURE_LOG_STORE
+    _logStore.flush();
+#endif
+    ESP.restart();
+}
+
+// Kurulum modu: AP, her adı AP'ye çeviren DNS ve arka planda ilk WiFi taraması; sayfa açıldığında
+// ağ listesi genellikle hazırdır
 void ESP32Helper::startAPMode() {
-    webPrintln("AP modu baslatiliyor.");
-    WiFi.softAP(_hostname.c_str(), "12345678");
-    webPrintf("AP IP Adresi: %s\n", WiFi.softAPIP().toString().c_str());
+    HELPER_LOGI("AP modu baslatiliyor.\n");
+    _apStarted = true;
+    _apCloseAt = 0;
+    WiFi.mode(WIFI_AP_STA); // Tarama ve kurulumdan sonraki bağlantı STA arayüzünü kullanır
+    const char* password = HELPER_AP_PASSWORD;
+    if (!WiFi.softAP(_hostname.c_str(), password[0] ? password : nullptr)) { HELPER_LOGE("AP baslatilamadi\n"); }
+    HELPER_LOGI("AP IP Adresi: %s\n", WiFi.softAPIP().toString().c_str());
+#if HELPER_FEATURE_CAPTIVE_DNS
+    if (!_dns.begin(WiFi.softAPIP())) { HELPER_LOGW("Kurulum DNS'i baslatilamadi\n"); }
+#endif
+    startScan();
+}
+
+void ESP32Helper::restorePreviousWifi() {
+    HELPER_LOGW("Yeni ag ile baglanilamadi, onceki aga donuluyor: %s\n", _previousSsid.c_str());
+    _config.setString("ssid", _previousSsid);
+    _config.setString("password", _previousPassword);
+    _config.commit();
+    _previousSsid = String();
+    _previousPassword = String();
+    _provisionStart = 0;
+    _wifiBackoffMs = WIFI_BACKOFF_MIN_MS;
+}
+
+void ESP32Helper::stopAPMode() {
+#if HELPER_FEATURE_CAPTIVE_DNS
+    _dns.end();
+#endif
+    WiFi.softAPdisconnect(true);
+    WiFi.mode(WIFI_STA);
+    _apStarted = false;
+    _apCloseAt = 0;
+    _scanJson = String(); // Önbellek yalnızca kurulum içindir
+    HELPER_LOGI("AP modu kapatildi.\n");
+}
+
+void ESP32Helper::updateAPMode() {
+    if (_scanRunning) {
+        int16_t count = WiFi.scanComplete();
+        if (count != WIFI_SCAN_RUNNING) {
+            _scanRunning = false;
+            if (count >= 0) { cacheScanResults(count); }
+            WiFi.scanDelete();
+        }
+    }
+    if (!_apStarted) { return; }
+#if HELPER_FEATURE_CAPTIVE_DNS
+    _dns.loop();
+#endif
+    if (_apCloseAt != 0 && (long)(millis() - _apCloseAt) >= 0) { stopAPMode(); }
+}
+
+// Tarama kanalları gezer; bağlantı denemesiyle çakışırsa ikisi de bozulur, o yüzden o sırada başlatılmaz
+void ESP32Helper::startScan() {
+    if (_scanRunning || _wifiState == CONN_CONNECTING) { return; }
+    if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED) { HELPER_LOGW("WiFi taramasi baslatilamadi\n"); return; }
+    _scanRunning = true;
+}
+
+// En güçlü HELPER_SCAN_MAX_RESULTS ağ sinyale göre sıralanır; aynı SSID'yi yayınlayan erişim noktalarından
+// yalnızca en güçlüsü kalır. Liste bir kez JSON'a çevrilir, /api/scan bunu kopyalar.
+void ESP32Helper::cacheScanResults(int16_t count) {
+    String names[HELPER_SCAN_MAX_RESULTS];
+    int32_t rssi[HELPER_SCAN_MAX_RESULTS];
+    bool open[HELPER_SCAN_MAX_RESULTS];
+    size_t kept = 0;
+    for (int16_t i = 0; i < count; i++) {
+        String name = WiFi.SSID(i);
+        if (name.isEmpty()) { continue; } // Gizli ağ
+        int32_t signal = WiFi.RSSI(i);
+        size_t at = 0;
+        while (at < kept && names[at] != name) { at++; }
+        if (at < kept) {
+            if (rssi[at] >= signal) { continue; }
+            for (size_t j = at; j + 1 < kept; j++) { names[j] = names[j + 1]; rssi[j] = rssi[j + 1]; open[j] = open[j + 1]; }
+            kept--;
+        }
+        size_t pos = 0;
+        while (pos < kept && rssi[pos] >= signal) { pos++; }
+        if (pos >= HELPER_SCAN_MAX_RESULTS) { continue; }
+        if (kept < HELPER_SCAN_MAX_RESULTS) { kept++; }
+        for (size_t j = kept - 1; j > pos; j--) { names[j] = names[j - 1]; rssi[j] = rssi[j - 1]; open[j] = open[j - 1]; }
+        names[pos] = name;
+        rssi[pos] = signal;
+        open[pos] = WiFi.encryptionType(i) == WIFI_AUTH_OPEN;
+    }
+    _scanJson = "[";
+    for (size_t i = 0; i < kept; i++) {
+        if (i > 0) { _scanJson += ','; }
+        _scanJson += "{\"ssid\":"; appendJsonString(_scanJson, names[i]);
+        _scanJson += ",\"rssi\":"; _scanJson += String(rssi[i]);
+        _scanJson += ",\"open\":"; _scanJson += open[i] ? "true" : "false";
+        _scanJson += '}';
+    }
+    _scanJson += ']';
+    _scanAt = millis();
+    HELPER_LOGD("WiFi taramasi: %d ag, %u listelendi\n", (int)count, (unsigned)kept);
 }
 
+// Başka bir ada gelen istek (telefonların bağlantı kontrolü gibi) kurulum DNS'inin yönlendirmesidir.
+// Host başlığı yoksa ya da cihazın adı/adresiyse normal 404 verilir.
+bool ESP32Helper::isCaptiveRequest() {
+    String host = server.header("Host");
+    int colon = host.indexOf(':');
+    if (colon >= 0) { host = host.substring(0, colon); }
+    if (host.isEmpty()) { return false; }
+    if (host == WiFi.softAPIP().toString() || host == WiFi.localIP().toString()) { return false; }
+    return !host.equalsIgnoreCase(_hostname) && !host.equalsIgnoreCase(_hostname + ".local");
+}
+
+#if HELPER_FEATURE_ARDUINO_OTA
 void ESP32Helper::setupOTA() {
     ArduinoOTA.setHostname(_hostname.c_str());
-    ArduinoOTA.onStart([this]() { webPrintln("Arduino OTA guncellemesi basladi..."); })
-        .onEnd([this]() { webPrintln("\nEnd"); })
+    ArduinoOTA.onStart([]() { HELPER_LOGI("Arduino OTA guncellemesi basladi...\n"); })
+        .onEnd([this]() {
+            HELPER_LOGI("Arduino OTA guncellemesi tamamlandi.\n");
+#if HELPER_FEATURE_LOG_STORE
+            _logStore.flush();
+#endif
+        })
         .onProgress([this](unsigned int progress, unsigned int total) { Serial.printf("Progress: %u%%\r", (progress / (total / 100))); })
-        .onError([this](ota_error_t error) { webPrintf("Error[%u]: \n", error); });
+        .onError([](ota_error_t error) { HELPER_LOGE("Error[%u]: \n", error); });
     ArduinoOTA.begin();
 }
+#endif
 
 void ESP32Helper::startWebServer() {
+#if HELPER_WEBSOCKET
     webSocket.begin();
     webSocket.onEvent([this](uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
         this->webSocketEvent(num, type, payload, length);
     });
-    server.on("/panel", HTTP_GET, [this]() { this->handleRoot(); });
-    server.on("/", HTTP_GET, []() {
-        server.sendHeader("Location", "/panel");
-        server.send(302, "text/plain", "Redirecting to /panel...");
+#endif
+    const char* headerKeys[] = {"If-None-Match", "Range", "Host"};
+    server.collectHeaders(headerKeys, 3);
+#if HELPER_FEATURE_PANEL
+    on("/panel", HTTP_GET, [this]() { this->handleRoot(); });
+    on("/api/state", HTTP_GET, [this]() { this->handleState(); });
+#endif
+    // AP modunda (ya da panel yoksa) kök adres kurulum sayfasıdır
+    on("/", HTTP_GET, [this]() {
+#if HELPER_FEATURE_PANEL
+        if (!_apStarted) {
+            server.sendHeader("Location", "/panel");
+            server.send(302, "text/plain", "Redirecting to /panel...");
+            return;
+        }
+#endif
+        this->handleSetup();
     });
-    server.on("/savewifi", HTTP_POST, [this]() { this->handleSaveWifi(); });
-    server.on("/urlupdate", HTTP_POST, [this]() { this->handleUrlUpdate(); });
-    server.on("/restart", HTTP_GET, []() { server.send(200, "text/plain", "Cihaz yeniden baslatiliyor..."); delay(200); ESP.restart(); });
-    server.on("/update", HTTP_POST, [this]() { server.sendHeader("Connection", "close"); server.send(200, "text/plain", "Guncelleme Tamamlandi! Cihaz yeniden baslatiliyor..."); delay(200); ESP.restart(); });
-    server.onFileUpload([this]() { this->handleFileUpload(); });
-    server.onNotFound([this]() { this->handleNotFound(); });
+    on("/setup", HTTP_GET, [this]() { this->handleSetup(); });
+    on("/api/wifi", HTTP_GET, [this]() { this->handleWifiStatus(); });
+    on("/api/scan", HTTP_GET, [this]() { this->handleScan(); });
+#if HELPER_FEATURE_METRICS
+    on("/metrics", HTTP_GET, [this]() { this->handleMetrics(); });
+#endif
+    on("/savewifi", HTTP_POST, [this]() { this->handleSaveWifi(); });
+#if HELPER_FEATURE_URL_OTA
+    on("/urlupdate", HTTP_POST, [this]() { this->handleUrlUpdate(); });
+#endif
+    on("/restart", HTTP_GET, [this]() { server.send(200, "text/plain", "Cihaz yeniden baslatiliyor..."); restartDevice(200); });
+#if HELPER_FEATURE_WEB_OTA
+    on("/update", HTTP_POST, [this]() { this->handleUpdateResult(); });
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    if (_logStore.isRunning()) {
+        on("/logs", HTTP_GET, [this]() { server.hasArg("id") ? this->handleLogDownload() : this->handleLogList(); });
+    }
+#endif
+#if HELPER_FEATURE_WEB_OTA
+    // Yükleme parçaları ayrı ölçülür: her çağrı bir parçanın flash'a yazılmasıdır
+    server.onFileUpload(timed("upload", [this]() { this->handleFileUpload(); }));
+#endif
+    server.onNotFound(timed("*", [this]() { this->handleNotFound(); }));
     server.begin();
-    webPrintln("Web sunucusu baslatildi.");
+    HELPER_LOGI("Web sunucusu baslatildi.\n");
+}
+
+void ESP32Helper::on(const char* uri, HTTPMethod method, std::function<void()> handler) {
+    server.on(uri, method, timed(uri, handler));
 }
 
+// İşleyiciyi süre ölçümüyle sarar; yer kalmadıysa olduğu gibi döndürür
+std::function<void()> ESP32Helper::timed(const char* uri, std::function<void()> handler) {
+#if !HELPER_FEATURE_METRICS
+    (void)uri;
+    return handler;
+#else
+    if (_routeCount >= METRICS_MAX_ROUTES) { return handler; }
+    RouteMetrics* metrics = &_routeMetrics[_routeCount++];
+    metrics->uri = uri;
+    return [metrics, handler]() {
+        uint32_t start = ESP.getCycleCount();
+        handler();
+        metrics->latency.observe(ESP.getCycleCount() - start);
+    };
+#endif
+}
+
+#if HELPER_FEATURE_WEB_OTA
+// URL OTA sürerken gelen yükleme bu hatayla reddedilir; /update 409 döner
+static const char UPLOAD_BUSY_ERROR[] = "URL OTA suruyor";
+
+// Beklenen SHA-256 özeti isteğe bağlı olarak /update?sha256=<hex> ile verilir; delta ve gzip yüklemeleri otomatik tanınır.
+// Parçalar FirmwarePipeline'a kopyalanır, flash'a yazılmaları sonraki parçaların alımıyla örtüşür.
 void ESP32Helper::handleFileUpload() {
-    if (server.upload().status == UPLOAD_FILE_START) {
-        webPrintf("Web OTA guncellemesi basladi: %s\n", server.upload().filename.c_str());
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN)) { Update.printError(Serial); }
-    } else if (server.upload().status == UPLOAD_FILE_WRITE) {
-        if (Update.write(server.upload().buf, server.upload().currentSize) != server.upload().currentSize) { Update.printError(Serial); }
-    } else if (server.upload().status == UPLOAD_FILE_END) {
-        if (Update.end(true)) { webPrintf("Guncelleme basarili: %u bytes. Cihaz yeniden baslatilacak.\n", server.upload().totalSize);
-        } else { Update.printError(Serial); webPrintln("Guncelleme sirasinda hata!"); }
+    HTTPUpload& upload = server.upload();
+    if (upload.status == UPLOAD_FILE_START) {
+        HELPER_LOGI("Web OTA guncellemesi basladi: %s\n", upload.filename.c_str());
+        _uploadError = "";
+        _uploadDone = false;
+        _uploadTotal = server.clientContentLength();
+        _uploadLastProgress = millis();
+#if HELPER_FEATURE_URL_OTA
+        // İki güncelleme aynı FirmwareWriter'ı ve Update bölümünü kullanır; arka plandaki indirme bozulmaz
+        if (_urlOtaState != URL_OTA_IDLE) {
+            _uploadError = UPLOAD_BUSY_ERROR;
+            HELPER_LOGW("Web OTA reddedildi: %s\n", UPLOAD_BUSY_ERROR);
+            return;
+        }
+#endif
+        if (!_upload.begin(UPDATE_SIZE_UNKNOWN, server.arg("sha256").c_str())) {
+            _uploadError = _upload.error();
+            HELPER_LOGE("Guncelleme hatasi: %s\n", _uploadError.c_str());
+            return;
+        }
+        publishProgress(PROGRESS_WEB_OTA, PROGRESS_RUNNING, 0, _uploadTotal);
+    } else if (upload.status == UPLOAD_FILE_WRITE) {
+        if (!_upload.isRunning() || _uploadError.length() > 0) { return; }
+        if (!_upload.write(upload.buf, upload.currentSize)) {
+            _uploadError = _upload.error();
+            HELPER_LOGE("Guncelleme hatasi: %s\n", _uploadError.c_str());
+            publishProgress(PROGRESS_WEB_OTA, PROGRESS_FAILED, _upload.receivedBytes(), _uploadTotal);
+        } else if (millis() - _uploadLastProgress >= OTA_PROGRESS_INTERVAL_MS) {
+            _uploadLastProgress = millis();
+            publishProgress(PROGRESS_WEB_OTA, PROGRESS_RUNNING, _upload.receivedBytes(), _uploadTotal);
+        }
+    } else if (upload.status == UPLOAD_FILE_END) {
+        if (!_upload.isRunning()) {
+            if (_uploadError.length() == 0) { _uploadError = "Yukleme baslatilamadi"; }
+            _otaResults[PROGRESS_WEB_OTA][0]++;
+            return;
+        }
+        unsigned long elapsed = millis() - _progressStart[PROGRESS_WEB_OTA];
+        _uploadDone = _upload.end();
+        if (!_uploadDone && _uploadError.length() == 0) { _uploadError = _upload.error(); }
+        _otaResults[PROGRESS_WEB_OTA][_uploadDone ? 1 : 0]++;
+        publishProgress(PROGRESS_WEB_OTA, _uploadDone ? PROGRESS_DONE : PROGRESS_FAILED, _upload.receivedBytes(), _uploadTotal);
+        if (_uploadDone) {
+            HELPER_LOGI("Guncelleme basarili: %u bayt alindi, %u bayt yazildi%s%s, %u KB/sn (flash bekleme %u ms). Cihaz yeniden baslatilacak.\n",
+                      (unsigned)_upload.receivedBytes(), (unsigned)_firmware.imageBytes(), _firmware.isCompressed() ? " (gzip)" : "",
+                      _firmware.isDelta() ? " (delta)" : "", (unsigned)((uint64_t)_upload.receivedBytes() * 1000 / 1024 / (elapsed > 0 ? elapsed : 1)),
+                      (unsigned)_upload.waitMs());
+        } else { HELPER_LOGE("Guncelleme sirasinda hata! %s\n", _uploadError.c_str()); }
+    } else if (upload.status == UPLOAD_FILE_ABORTED) {
+        _upload.abort();
+        _uploadDone = false;
+        _uploadError = "Yukleme yarida kesildi";
+        _otaResults[PROGRESS_WEB_OTA][0]++;
+        publishProgress(PROGRESS_WEB_OTA, PROGRESS_FAILED, _upload.receivedBytes(), _uploadTotal);
+        HELPER_LOGW("Web OTA yuklemesi yarida kesildi.\n");
     }
 }
 
+// Yükleme bittikten sonra çağrılır; hata varsa tarayıcıya gösterilir ve cihaz yeniden başlatılmaz
+void ESP32Helper::handleUpdateResult() {
+    server.sendHeader("Connection", "close");
+    if (!_uploadDone) {
+        String message = "Guncelleme basarisiz: ";
+        message += _uploadError.length() > 0 ? _uploadError : String("Dosya alinmadi");
+        server.send(_uploadError == UPLOAD_BUSY_ERROR ? 409 : 500, "text/plain", message);
+        return;
+    }
+    _uploadDone = false;
+    server.send(200, "text/plain", "Guncelleme Tamamlandi! Cihaz yeniden baslatiliyor...");
+    restartDevice(200);
+}
+#endif
+
+#if HELPER_FEATURE_PANEL
+// Panel flash'taki gzip'li sabit sayfadır; tarayıcı önbelleği ETag ile doğrulanır
 void ESP32Helper::handleRoot() {
-    server.send(200, "text/html", getDynamicPanelHtml());
+    server.sendHeader("ETag", PANEL_HTML_ETAG);
+    server.sendHeader("Cache-Control", "no-cache");
+    if (server.header("If-None-Match") == PANEL_HTML_ETAG) { server.send(304); return; }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (PGM_P)PANEL_HTML_GZ, sizeof(PANEL_HTML_GZ));
 }
 
+void ESP32Helper::handleState() {
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", getStateJson());
+}
+#endif
+
+// Kurulum sayfası panel gibi flash'taki gzip'li sabit sayfadır (~1.5 KB); ağ listesini /api/scan'den alır
+void ESP32Helper::handleSetup() {
+    server.sendHeader("ETag", SETUP_HTML_ETAG);
+    server.sendHeader("Cache-Control", "no-cache");
+    if (server.header("If-None-Match") == SETUP_HTML_ETAG) { server.send(304); return; }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (PGM_P)SETUP_HTML_GZ, sizeof(SETUP_HTML_GZ));
+}
+
+// Yeni ağa yeniden başlatmadan geçilir: cevap gönderilir, bağlantı denemesi hemen başlar. AP açıksa
+// AP+STA'da kalınır; sayfa /api/wifi ile sonucu izler, bağlanınca AP HELPER_AP_LINGER_MS sonra kapanır.
 void ESP32Helper::handleSaveWifi() {
-    preferences.begin("wifi-creds", false);
-    preferences.putString("ssid", server.arg("ssid"));
-    preferences.putString("password", server.arg("password"));
-    preferences.end();
-    webPrintln("WiFi bilgileri kaydedildi. ESP32 yeniden baslatiliyor...");
-    delay(1000);
-    ESP.restart();
+    String ssid = server.arg("ssid");
+    if (ssid.isEmpty()) { server.send(400, "text/plain", "SSID gerekli!"); return; }
+    // Çalışan ağ, yeni bilgiler HELPER_PROVISION_MAX_FAILURES kez başarısız olursa geri yüklenir
+    if (_wifiState == CONN_ONLINE) {
+        _previousSsid = _config.getString("ssid");
+        _previousPassword = _config.getString("password");
+    } else if (_provisionStart == 0) {
+        _previousSsid = String();
+        _previousPassword = String();
+    }
+    _config.setString("ssid", ssid);
+    _config.setString("password", server.arg("password"));
+    _config.reset("wifi_cache");
+    _config.commit();
+    HELPER_LOGI("WiFi bilgileri kaydedildi, baglaniliyor: %s\n", ssid.c_str());
+    server.send(200, "text/plain", "WiFi bilgileri kaydedildi. Baglaniliyor...");
+
+    _provisionStart = millis() | 1;
+    _wifiFailures = 0;
+    _linkUp = false;
+    if (_apStarted) { _apCloseAt = 0; }
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    WiFi.disconnect();
+    WiFi.mode(_apStarted ? WIFI_AP_STA : WIFI_STA);
+    connectToWifi(false);
+    publishNetworkState();
+}
+
+// {"ssid":"ev","state":"connecting","ip":"","failures":0,"ap":true,"provisionMs":0}
+void ESP32Helper::handleWifiStatus() {
+    static const char* const states[] = {"idle", "connecting", "online", "backoff"};
+    String json;
+    json.reserve(128);
+    json = "{\"ssid\":"; appendJsonString(json, _config.getString("ssid"));
+    json += ",\"state\":\""; json += states[_wifiState]; json += '"';
+    json += ",\"ip\":\""; if (_linkUp) { json += WiFi.localIP().toString(); } json += '"';
+    json += ",\"failures\":"; json += String(_wifiFailures);
+    json += ",\"ap\":"; json += _apStarted ? "true" : "false";
+    json += ",\"provisionMs\":"; json += String(_wifiStats.provisionToOnlineMs);
+    json += '}';
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", json);
+}
+
+// Önbellekteki liste hemen döner; eskiyse yeni tarama arka planda başlar ve "scanning" true olur
+// {"scanning":false,"age":1200,"networks":[{"ssid":"ev","rssi":-52,"open":false},...]}
+void ESP32Helper::handleScan() {
+    bool cached = _scanJson.length() > 0;
+    if (!cached || millis() - _scanAt >= HELPER_SCAN_CACHE_MS) { startScan(); }
+    String json;
+    json.reserve(_scanJson.length() + 48);
+    json = "{\"scanning\":"; json += _scanRunning ? "true" : "false";
+    json += ",\"age\":"; json += cached ? String(millis() - _scanAt) : String(-1);
+    json += ",\"networks\":"; json += cached ? _scanJson : String("[]");
+    json += '}';
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", json);
 }
 
+#if HELPER_FEATURE_URL_OTA
 void ESP32Helper::handleUrlUpdate() {
     if (!server.hasArg("url")) { server.send(400, "text/plain", "URL gerekli!"); return; }
     String url = server.arg("url");
-    preferences.begin("ota", false);
-    preferences.putString("ota_url", url);
-    preferences.end();
-    webPrintln("OTA URL'si kaydedildi.");
-    autoUpdateCheck();
+    _config.setString("ota_url", url);
+    HELPER_LOGI("OTA URL'si kaydedildi.\n");
+#if HELPER_FEATURE_PANEL
+    String fields = "\"otaUrl\":"; appendJsonString(fields, url); publishState(fields.c_str());
+#endif
+    server.sendHeader("Location", "/panel");
+    server.send(303, "text/plain", "Guncelleme kontrolu baslatildi.");
+    startUrlUpdate();
 }
 
-void ESP32Helper::autoUpdateCheck() {
-    preferences.begin("ota", true);
-    String url = preferences.getString("ota_url", "");
-    preferences.end();
-
+// URL OTA arka planda ilerler: HEAD ile koşullu kontrol, ardından loop() içinde parça parça indirme.
+// Bağlantı koparsa Range/If-Range ile kalınan yerden devam edilir; dosya bu arada değiştiyse baştan indirilir.
+void ESP32Helper::startUrlUpdate() {
+    if (_urlOtaState != URL_OTA_IDLE) {
+        HELPER_LOGI("Guncelleme zaten devam ediyor.\n");
+        return;
+    }
+#if HELPER_FEATURE_WEB_OTA
+    if (_upload.isRunning()) {
+        HELPER_LOGW("Web OTA yuklemesi suruyor, URL guncellemesi atlandi.\n");
+        return;
+    }
+#endif
+    String url = _config.getString("ota_url");
     if (url.isEmpty()) {
-        webPrintln("Kayitli OTA URL'si bulunamadi, otomatik guncelleme atlandi.");
+        HELPER_LOGI("Kayitli OTA URL'si bulunamadi, otomatik guncelleme atlandi.\n");
         return;
     }
+    HELPER_LOGI("Guncelleme kontrol ediliyor: %s\n", url.c_str());
+    HELPER_LOGD("Mevcut versiyon: %s\n", _firmwareVersion.c_str());
+    _urlOtaState = URL_OTA_CHECK;
+}
 
-    webPrintf("Guncelleme kontrol ediliyor: %s\n", url.c_str());
-    webPrintf("Mevcut versiyon: %s\n", _firmwareVersion.c_str());
+void ESP32Helper::updateUrlOta() {
+    switch (_urlOtaState) {
+        case URL_OTA_CHECK: checkUrlUpdate(); break;
+        case URL_OTA_DOWNLOAD: downloadUrlUpdate(); break;
+        case URL_OTA_RETRY:
+            if (millis() - _urlOtaStateSince >= (unsigned long)URL_OTA_RETRY_DELAY_MS * _urlOtaRetries) { requestUrlUpdate(); }
+            break;
+        default: break;
+    }
+}
 
+void ESP32Helper::checkUrlUpdate() {
     HTTPClient http;
-    http.begin(url);
-    const char* headerKeys[] = {"x-firmware-version"};
-    http.collectHeaders(headerKeys, 1);
-    
-    int httpCode = http.GET();
-    if (httpCode == HTTP_CODE_OK) {
-        if (http.hasHeader("x-firmware-version")) {
-            String serverVersion = http.header("x-firmware-version");
-            webPrintf("Sunucu versiyonu: %s\n", serverVersion.c_str());
-            
-            if (serverVersion != _firmwareVersion && serverVersion.length() > 0) {
-                webPrintln("Yeni bir firmware versiyonu bulundu! Guncelleme baslatiliyor...");
-                int len = http.getSize();
-                if (!Update.begin(len)) { 
-                    Update.printError(Serial); 
-                    webPrintln("Guncelleme icin yeterli alan yok!");
-                    http.end();
-                    return; 
-                }
-                WiFiClient* stream = http.getStreamPtr();
-                size_t written = Update.writeStream(*stream);
-                if (written == len) {
-                    if (Update.end()) {
-                        webPrintln("Guncelleme tamamlandi. Cihaz yeniden baslatiliyor.");
-                        ESP.restart();
-                    } else {
-                        Update.printError(Serial);
-                        webPrintln("Guncelleme sonlandirilamadi.");
-                    }
-                } else {
-                    webPrintf("Yazma hatasi: %u / %d bytes yazildi.\n", written, len);
+    http.setConnectTimeout(URL_OTA_CONNECT_TIMEOUT_MS);
+    http.setTimeout(URL_OTA_TIMEOUT_MS);
+    http.begin(_config.getString("ota_url"));
+    const char* headerKeys[] = {"x-firmware-version", "ETag", "x-firmware-sha256"};
+    http.collectHeaders(headerKeys, 3);
+    http.addHeader("x-firmware-base", _firmwareBase);
+    String installedEtag = _config.getString("ota_etag");
+    if (installedEtag.length() > 0) { http.addHeader("If-None-Match", installedEtag); }
+
+    int httpCode = http.sendRequest("HEAD");
+    String serverVersion = http.header("x-firmware-version");
+    String etag = http.header("ETag");
+    String sha256 = http.header("x-firmware-sha256");
+    int size = http.getSize();
+    http.end();
+
+    _urlOtaState = URL_OTA_IDLE;
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        HELPER_LOGI("Firmware guncel (sunucudaki dosya degismemis).\n");
+        return;
+    }
+    if (httpCode != HTTP_CODE_OK) {
+        HELPER_LOGW("Guncelleme kontrolu basarisiz, HTTP Kodu: %d\n", httpCode);
+        return;
+    }
+    if (serverVersion.length() == 0) {
+        HELPER_LOGW("Sunucu versiyon bilgisi ('x-firmware-version' header) gondermedi. Guncelleme atlandi.\n");
+        return;
+    }
+    HELPER_LOGD("Sunucu versiyonu: %s\n", serverVersion.c_str());
+    if (serverVersion == _firmwareVersion) {
+        HELPER_LOGI("Firmware guncel.\n");
+        // Sonraki kontroller If-None-Match ile 304 alabilsin
+        _config.setString("ota_etag", etag);
+        return;
+    }
+    if (size <= 0) {
+        HELPER_LOGW("Sunucu dosya boyutunu (Content-Length) bildirmedi. Guncelleme atlandi.\n");
+        return;
+    }
+    HELPER_LOGI("Yeni bir firmware versiyonu bulundu! Guncelleme baslatiliyor...\n");
+    if (!beginUrlImage(size, sha256, etag)) { return; }
+    _urlOtaRetries = 0;
+    requestUrlUpdate();
+}
+
+// İmaj baştan yazılmaya başlar: HEAD cevabıyla ya da dosya değiştiği için tamamı yeniden gönderildiğinde
+bool ESP32Helper::beginUrlImage(int size, const String& sha256, const String& etag) {
+    if (!_firmware.begin(size, sha256.c_str())) {
+        HELPER_LOGE("Guncelleme baslatilamadi: %s\n", _firmware.error());
+        return false;
+    }
+    _urlOtaEtag = etag;
+    _urlOtaTotal = size;
+    _urlOtaWritten = 0;
+    _urlOtaLastProgress = 0;
+    return true;
+}
+
+void ESP32Helper::requestUrlUpdate() {
+    if (!_urlOtaHttp) { _urlOtaHttp = new HTTPClient(); }
+    _urlOtaHttp->setConnectTimeout(URL_OTA_CONNECT_TIMEOUT_MS);
+    _urlOtaHttp->setTimeout(URL_OTA_TIMEOUT_MS);
+    _urlOtaHttp->begin(_config.getString("ota_url"));
+    const char* headerKeys[] = {"ETag", "x-firmware-sha256"};
+    _urlOtaHttp->collectHeaders(headerKeys, 2);
+    _urlOtaHttp->addHeader("x-firmware-base", _firmwareBase);
+    if (_urlOtaWritten > 0) {
+        _urlOtaHttp->addHeader("Range", "bytes=" + String((unsigned long)_urlOtaWritten) + "-");
+        if (_urlOtaEtag.length() > 0) { _urlOtaHttp->addHeader("If-Range", _urlOtaEtag); }
+    }
+    int httpCode = _urlOtaHttp->GET();
+    if (httpCode == HTTP_CODE_OK && _urlOtaWritten > 0) {
+        // If-Range eşleşmedi (dosya değişti) ya da sunucu Range desteklemiyor: tam dosya geliyor, yarım imaj
+        // atılır ve bu cevaptan baştan yazılır
+        HELPER_LOGW("Sunucu dosyanin tamamini gonderdi, indirme bastan basliyor.\n");
+        _firmware.abort();
+        int size = _urlOtaHttp->getSize();
+        if (size <= 0 || !beginUrlImage(size, _urlOtaHttp->header("x-firmware-sha256"), _urlOtaHttp->header("ETag"))) {
+            finishUrlUpdate(false, size <= 0 ? "Sunucu dosya boyutunu bildirmedi." : _firmware.error());
+            return;
+        }
+    }
+    if ((httpCode == HTTP_CODE_OK && _urlOtaWritten == 0) || (httpCode == HTTP_CODE_PARTIAL_CONTENT && _urlOtaWritten > 0)) {
+        if (_urlOtaWritten > 0) { HELPER_LOGD("Indirme %u. bayttan devam ediyor.\n", (unsigned)_urlOtaWritten); }
+        _urlOtaState = URL_OTA_DOWNLOAD;
+        _urlOtaStateSince = millis();
+        _urlOtaLastData = millis();
+        return;
+    }
+    HELPER_LOGW("Indirme istegi basarisiz, HTTP Kodu: %d\n", httpCode);
+    retryUrlUpdate();
+}
+
+void ESP32Helper::downloadUrlUpdate() {
+    WiFiClient* stream = _urlOtaHttp->getStreamPtr();
+    size_t available = stream ? stream->available() : 0;
+    if (available == 0) {
+        if (!_urlOtaHttp->connected() || millis() - _urlOtaLastData > URL_OTA_STALL_TIMEOUT_MS) {
+            HELPER_LOGW("Baglanti koptu (%u / %u bayt).\n", (unsigned)_urlOtaWritten, (unsigned)_urlOtaTotal);
+            retryUrlUpdate();
+        }
+        return;
+    }
+    uint8_t buffer[URL_OTA_CHUNK_SIZE];
+    size_t length = available < sizeof(buffer) ? available : sizeof(buffer);
+    if (length > _urlOtaTotal - _urlOtaWritten) { length = _urlOtaTotal - _urlOtaWritten; }
+    length = stream->readBytes(buffer, length);
+    if (!_firmware.write(buffer, length)) {
+        finishUrlUpdate(false, _firmware.error());
+        return;
+    }
+    _urlOtaWritten += length;
+    _urlOtaLastData = millis();
+    _urlOtaRetries = 0;
+    if (_urlOtaWritten >= _urlOtaTotal) {
+        finishUrlUpdate(true, nullptr);
+    } else if (millis() - _urlOtaLastProgress >= OTA_PROGRESS_INTERVAL_MS) {
+        _urlOtaLastProgress = millis();
+        publishProgress(PROGRESS_URL_OTA, PROGRESS_RUNNING, _urlOtaWritten, _urlOtaTotal);
+    }
+}
+
+void ESP32Helper::retryUrlUpdate() {
+    _urlOtaHttp->end();
+    if (++_urlOtaRetries > URL_OTA_MAX_RETRIES) {
+        finishUrlUpdate(false, "Deneme sayisi asildi.");
+        return;
+    }
+    HELPER_LOGW("%u. yeniden deneme %u ms sonra.\n", _urlOtaRetries, (unsigned)(URL_OTA_RETRY_DELAY_MS * _urlOtaRetries));
+    _urlOtaState = URL_OTA_RETRY;
+    _urlOtaStateSince = millis();
+}
+
+void ESP32Helper::finishUrlUpdate(bool success, const char* error) {
+    if (_urlOtaHttp) { _urlOtaHttp->end(); delete _urlOtaHttp; _urlOtaHttp = nullptr; }
+    _urlOtaState = URL_OTA_IDLE;
+    if (success && !_firmware.end()) {
+        success = false;
+        error = _firmware.error();
+    }
+    _otaResults[PROGRESS_URL_OTA][success ? 1 : 0]++;
+    if (!success) {
+        _firmware.abort();
+        HELPER_LOGE("URL OTA basarisiz: %s\n", error);
+        publishProgress(PROGRESS_URL_OTA, PROGRESS_FAILED, _urlOtaWritten, _urlOtaTotal);
+        return;
+    }
+    publishProgress(PROGRESS_URL_OTA, PROGRESS_DONE, _urlOtaWritten, _urlOtaTotal);
+    _config.setString("ota_etag", _urlOtaEtag);
+    HELPER_LOGI("Guncelleme tamamlandi: %u bayt indirildi, %u bayt imaj yazildi%s.\n", (unsigned)_firmware.inputBytes(),
+              (unsigned)_firmware.imageBytes(), _firmware.isDelta() ? " (delta)" : "");
+    HELPER_LOGI("Cihaz yeniden baslatiliyor.\n");
+    restartDevice(0);
+}
+#endif
+
+#if HELPER_FIRMWARE_UPDATE
+// OTA ilerlemesi: [FRAME_PROGRESS, tür, durum, yazılan (u32 LE), toplam (u32 LE), hız (u32 LE, bayt/sn)].
+// Hız, türün ilk RUNNING çerçevesinden bu yana ortalamadır; bitiş çerçevesinden sonra sıfırlanır.
+// Panel derlenmemişse çerçeveyi gösterecek kimse yoktur.
+void ESP32Helper::publishProgress(uint8_t kind, uint8_t status, uint32_t done, uint32_t total) {
+#if HELPER_FEATURE_PANEL
+    unsigned long now = millis();
+    if (_progressStart[kind] == 0) { _progressStart[kind] = now | 1; _progressBase[kind] = done; }
+    unsigned long elapsed = now - _progressStart[kind];
+    uint32_t rate = elapsed > 0 ? (uint32_t)((uint64_t)(done - _progressBase[kind]) * 1000 / elapsed) : 0;
+    if (status != PROGRESS_RUNNING) { _progressStart[kind] = 0; }
+    uint8_t frame[15] = {FRAME_PROGRESS, kind, status};
+    for (int i = 0; i < 4; i++) {
+        frame[3 + i] = (uint8_t)(done >> (8 * i));
+        frame[7 + i] = (uint8_t)(total >> (8 * i));
+        frame[11 + i] = (uint8_t)(rate >> (8 * i));
+    }
+    memcpy(_progressFrames[kind], frame, sizeof(frame));
+    for (PanelOutbox& outbox : _outboxes) { outbox.offerProgress(kind); }
+#else
+    (void)kind; (void)status; (void)done; (void)total;
+#endif
+}
+#endif
+
+#if HELPER_FEATURE_PANEL
+// Örnekler her turda özetlere boşaltılır; çerçeve yalnızca periyot dolunca ve panel bağlıyken üretilir.
+// Gönderilmemiş bir fark çerçevesinin yerini yenisi alırsa o istemci için anahtar çerçeve istenir.
+void ESP32Helper::updateTelemetry() {
+    if (_telemetry.size() == 0) { return; }
+    if (_wsClients == 0) { _telemetry.requestKeyframe(); } // İlk bağlanan panel mutlak değerlerle başlar
+    size_t len = _telemetry.poll(millis(), _telemetryFrame + 1);
+    if (len == 0 || _wsClients == 0) { return; }
+    _telemetryFrame[0] = FRAME_TELEMETRY;
+    _telemetryLength = len + 1;
+    bool keyframe = (_telemetryFrame[1] & Telemetry::FLAG_KEYFRAME) != 0;
+    bool needKeyframe = false;
+    for (PanelOutbox& outbox : _outboxes) {
+        if (outbox.offerTelemetry(keyframe)) { needKeyframe = true; }
+    }
+    if (needKeyframe) { _telemetry.requestKeyframe(); }
+}
+
+// Her istemciye soketinin beklemeden alacağı kadar çerçeve gönderilir: önce sıradaki durum değişiklikleri,
+// sonra ilerleme ve telemetri. Sığmayan çerçeve kutuda kalır; yavaş bir panel diğerlerini ve loop()'u bekletmez.
+void ESP32Helper::sendPanelFrames() {
+    static const uint8_t resync[] = {FRAME_STATE_RESYNC};
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        PanelOutbox& outbox = _outboxes[num];
+        if (!outbox.isOpen() || outbox.empty()) { continue; }
+        size_t room = webSocket.availableForWrite(num);
+        if (outbox.isPending(PanelOutbox::PENDING_RESYNC)) {
+            if (!sendPanelFrame(num, room, resync, sizeof(resync))) { continue; }
+            outbox.clearPending(PanelOutbox::PENDING_RESYNC);
+        }
+        const uint8_t* frame;
+        size_t length;
+        while ((length = outbox.front(&frame)) > 0 && sendPanelFrame(num, room, frame, length)) { outbox.pop(); }
+        if (outbox.depth() > 0) { continue; }
+#if HELPER_FIRMWARE_UPDATE
+        for (uint8_t kind = 0; kind < 2; kind++) {
+            uint8_t bit = (uint8_t)(PanelOutbox::PENDING_PROGRESS << kind);
+            if (!outbox.isPending(bit)) { continue; }
+            if (!sendPanelFrame(num, room, _progressFrames[kind], sizeof(_progressFrames[kind]))) { break; }
+            outbox.clearPending(bit);
+        }
+#endif
+        if (outbox.isPending(PanelOutbox::PENDING_TELEMETRY) && sendPanelFrame(num, room, _telemetryFrame, _telemetryLength)) {
+            outbox.clearPending(PanelOutbox::PENDING_TELEMETRY);
+        }
+    }
+}
+
+bool ESP32Helper::sendPanelFrame(uint8_t num, size_t& room, const uint8_t* frame, size_t length) {
+    if (length > room || !_outboxes[num].isOpen()) { return false; }
+    if (!webSocket.sendBIN(num, frame, length)) { return false; }
+    room -= length;
+    _wsFramesOut++;
+    _wsBytesOut += length;
+    return true;
+}
+#endif
+
+#if HELPER_FEATURE_METRICS
+// Prometheus metin biçimi; bölümler istemci okudukça tek tek üretilir, cevabın tamamı RAM'de tutulmaz
+void ESP32Helper::handleMetrics() {
+    server.sendHeader("Cache-Control", "no-store");
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+    size_t section = 0;
+    server.sendContent([this, section](String& out) mutable { return appendMetrics(out, section++); });
+}
+
+// section'ıncı bölümü (~1 KB) ekler; bölüm kalmadıysa false döner. Rota histogramları birer bölümdür.
+bool ESP32Helper::appendMetrics(String& out, size_t section) {
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    static const size_t FIRST_ROUTE_SECTION = 3; // Döngü histogramlarından sonra
+    if (section >= FIRST_ROUTE_SECTION && section < FIRST_ROUTE_SECTION + _routeCount) {
+        size_t i = section - FIRST_ROUTE_SECTION;
+        if (i == 0) { appendMetricHeader(out, "esp32helper_http_request_duration_seconds", "histogram", "Handler time per HTTP route (upload: per received chunk)."); }
+        char labels[64];
+        snprintf(labels, sizeof(labels), "route=\"%s\"", _routeMetrics[i].uri);
+        _routeMetrics[i].latency.appendTo(out, "esp32helper_http_request_duration_seconds", labels, mhz);
+        return true;
+    }
+    if (section >= FIRST_ROUTE_SECTION) { section -= _routeCount; }
+    switch (section) {
+        case 0:
+            appendMetricHeader(out, "esp32helper_loop_duration_seconds", "histogram", "Time spent inside ESP32Helper::loop().");
+            _loopDuration.appendTo(out, "esp32helper_loop_duration_seconds", "", mhz);
+            break;
+        case 1:
+            appendMetricHeader(out, "esp32helper_loop_interval_seconds", "histogram", "Time between consecutive loop() calls, including application code.");
+            _loopInterval.appendTo(out, "esp32helper_loop_interval_seconds", "", mhz);
+            break;
+        case 2:
+            if (_networkTaskHandle) {
+                appendMetricHeader(out, "esp32helper_network_loop_duration_seconds", "histogram", "Time spent in one network task iteration.");
+                _networkDuration.appendTo(out, "esp32helper_network_loop_duration_seconds", "", mhz);
+            }
+            break;
+        case 3: {
+#if HELPER_WEBSOCKET
+            appendMetricHeader(out, "esp32helper_ws_clients", "gauge", "Connected WebSocket clients.");
+            appendMetric(out, "esp32helper_ws_clients", "", _wsClients);
+            appendMetricHeader(out, "esp32helper_ws_frames_received_total", "counter", "WebSocket text/binary frames received.");
+            appendMetric(out, "esp32helper_ws_frames_received_total", "", _wsFramesIn);
+            appendMetricHeader(out, "esp32helper_ws_received_bytes_total", "counter", "WebSocket payload bytes received.");
+            appendMetric(out, "esp32helper_ws_received_bytes_total", "", _wsBytesIn);
+            appendMetricHeader(out, "esp32helper_ws_frames_sent_total", "counter", "WebSocket frames sent, counted per client.");
+#if HELPER_FEATURE_WEBSERIAL
+            appendMetric(out, "esp32helper_ws_frames_sent_total", "channel=\"log\"", WebSerial.framesSent());
+#endif
+            appendMetric(out, "esp32helper_ws_frames_sent_total", "channel=\"panel\"", _wsFramesOut);
+            appendMetricHeader(out, "esp32helper_ws_sent_bytes_total", "counter", "WebSocket payload bytes sent, counted per client.");
+#if HELPER_FEATURE_WEBSERIAL
+            appendMetric(out, "esp32helper_ws_sent_bytes_total", "channel=\"log\"", WebSerial.bytesSent());
+#endif
+            appendMetric(out, "esp32helper_ws_sent_bytes_total", "channel=\"panel\"", _wsBytesOut);
+#if HELPER_FEATURE_PANEL
+            uint32_t panelDropped = 0;
+            for (const PanelOutbox& outbox : _outboxes) { panelDropped += outbox.dropped(); }
+            appendMetricHeader(out, "esp32helper_ws_panel_frames_dropped_total", "counter", "Panel frames dropped or replaced by a newer one while the client's socket was full.");
+            appendMetric(out, "esp32helper_ws_panel_frames_dropped_total", "", panelDropped);
+#endif
+#endif
+            break;
+        }
+        case 4: {
+#if HELPER_FEATURE_WEBSERIAL
+            appendMetricHeader(out, "esp32helper_log_dropped_bytes_total", "counter", "Log bytes dropped because the buffer was full.");
+            appendMetric(out, "esp32helper_log_dropped_bytes_total", "", WebSerial.bytesDropped());
+            appendMetricHeader(out, "esp32helper_log_evictions_total", "counter", "Clients disconnected by the WEBSERIAL_DISCONNECT policy.");
+            appendMetric(out, "esp32helper_log_evictions_total", "", WebSerial.evictions());
+            // Yalnızca bağlı istemciler; etiket WebSocket istemci numarasıdır
+            static const char* const clientFamilies[][3] = {
+                {"esp32helper_log_client_queue_bytes", "gauge", "Log bytes waiting in the client's send queue."},
+                {"esp32helper_log_client_queue_peak_bytes", "gauge", "Highest queue depth since the client connected."},
+                {"esp32helper_log_client_dropped_bytes_total", "counter", "Log bytes dropped from the client's queue."},
+                {"esp32helper_log_client_stalls_total", "counter", "Times the socket was found full with data queued."},
+            };
+            WebSerialClientStats clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+            for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) { clients[num] = WebSerial.clientStats(num); }
+            for (size_t family = 0; family < 4; family++) {
+                appendMetricHeader(out, clientFamilies[family][0], clientFamilies[family][1], clientFamilies[family][2]);
+                for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+                    if (!clients[num].connected) { continue; }
+                    const WebSerialClientStats& stats = clients[num];
+                    double values[] = {(double)stats.depth, (double)stats.peakDepth, (double)stats.bytesDropped, (double)stats.stalls};
+                    char labels[16];
+                    snprintf(labels, sizeof(labels), "client=\"%u\"", num);
+                    appendMetric(out, clientFamilies[family][0], labels, values[family]);
                 }
-            } else {
-                webPrintln("Firmware guncel.");
             }
-        } else {
-            webPrintln("Sunucu versiyon bilgisi ('x-firmware-version' header) gondermedi. Guncelleme atlandi.");
+#endif
+            break;
         }
-    } else {
-        webPrintf("Guncelleme kontrolu basarisiz, HTTP Kodu: %d\n", httpCode);
+        case 5:
+#if HELPER_FEATURE_PANEL
+            appendMetricHeader(out, "esp32helper_events_dropped_total", "counter", "Panel events dropped because the event queue was full.");
+            appendMetric(out, "esp32helper_events_dropped_total", "", _events.dropped());
+            appendMetricHeader(out, "esp32helper_telemetry_samples_dropped_total", "counter", "Telemetry samples dropped because the sample queue was full.");
+            appendMetric(out, "esp32helper_telemetry_samples_dropped_total", "", _telemetry.dropped());
+#endif
+            break;
+        case 6:
+            appendMetricHeader(out, "esp32helper_heap_free_bytes", "gauge", "Free heap.");
+            appendMetric(out, "esp32helper_heap_free_bytes", "", ESP.getFreeHeap());
+            appendMetricHeader(out, "esp32helper_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+            appendMetric(out, "esp32helper_heap_min_free_bytes", "", ESP.getMinFreeHeap());
+            appendMetricHeader(out, "esp32helper_heap_largest_block_bytes", "gauge", "Largest allocatable heap block.");
+            appendMetric(out, "esp32helper_heap_largest_block_bytes", "", ESP.getMaxAllocHeap());
+            appendMetricHeader(out, "esp32helper_uptime_seconds", "gauge", "Seconds since boot.");
+            appendMetric(out, "esp32helper_uptime_seconds", "", millis() / 1000.0);
+            appendMetricHeader(out, "esp32helper_wifi_connected", "gauge", "1 while the station link has an IP address.");
+            appendMetric(out, "esp32helper_wifi_connected", "", _linkUp ? 1 : 0);
+            appendMetricHeader(out, "esp32helper_wifi_reconnect_attempts_total", "counter", "WiFi reconnect attempts.");
+            appendMetric(out, "esp32helper_wifi_reconnect_attempts_total", "", _wifiStats.reconnectAttempts);
+            appendMetricHeader(out, "esp32helper_wifi_fast_connects_total", "counter", "Connections made with the cached BSSID/channel/IP.");
+            appendMetric(out, "esp32helper_wifi_fast_connects_total", "", _wifiStats.fastConnects);
+            appendMetricHeader(out, "esp32helper_config_nvs_writes_total", "counter", "Keys written to NVS by the configuration store.");
+            appendMetric(out, "esp32helper_config_nvs_writes_total", "", _config.stats().nvsWrites);
+            appendMetricHeader(out, "esp32helper_config_nvs_ops_avoided_total", "counter", "Preferences begin/get/put/end calls saved by the RAM cache and batched commits.");
+            appendMetric(out, "esp32helper_config_nvs_ops_avoided_total", "", _config.stats().nvsOpsAvoided);
+            break;
+        case 7:
+#if HELPER_FEATURE_LOG_STORE
+            if (_logStore.isRunning()) {
+                const LogStoreStats& log = _logStore.stats();
+                appendMetricHeader(out, "esp32helper_logstore_written_bytes_total", "counter", "Log bytes written to flash segments.");
+                appendMetric(out, "esp32helper_logstore_written_bytes_total", "", log.bytesWritten);
+                appendMetricHeader(out, "esp32helper_logstore_dropped_bytes_total", "counter", "Log bytes dropped because the flash batch buffer was full.");
+                appendMetric(out, "esp32helper_logstore_dropped_bytes_total", "", log.bytesDropped);
+                appendMetricHeader(out, "esp32helper_logstore_syncs_total", "counter", "Segment file syncs (one LittleFS metadata commit each).");
+                appendMetric(out, "esp32helper_logstore_syncs_total", "", log.syncs);
+                appendMetricHeader(out, "esp32helper_logstore_rotations_total", "counter", "Segments started.");
+                appendMetric(out, "esp32helper_logstore_rotations_total", "", log.rotations);
+                appendMetricHeader(out, "esp32helper_logstore_flash_bytes_estimated_total", "counter", "Estimated bytes programmed, including partial block copies and metadata commits.");
+                appendMetric(out, "esp32helper_logstore_flash_bytes_estimated_total", "", log.flashBytes);
+                appendMetricHeader(out, "esp32helper_logstore_block_erases_estimated_total", "counter", "Estimated flash block erases.");
+                appendMetric(out, "esp32helper_logstore_block_erases_estimated_total", "", log.blockErases);
+                appendMetricHeader(out, "esp32helper_logstore_write_amplification", "gauge", "Estimated flash bytes per log byte written.");
+                appendMetric(out, "esp32helper_logstore_write_amplification", "", _logStore.writeAmplification());
+                appendMetricHeader(out, "esp32helper_logstore_lifetime_years_estimated", "gauge", "Years until the filesystem partition reaches LOG_STORE_ERASE_CYCLES at the current erase rate (0: no erases yet).");
+                appendMetric(out, "esp32helper_logstore_lifetime_years_estimated", "", _logStore.lifetimeYears(LittleFS.totalBytes(), millis() - _bootMs));
+            }
+#endif
+            break;
+        case 8:
+#if HELPER_FIRMWARE_UPDATE
+            appendMetricHeader(out, "esp32helper_ota_updates_total", "counter", "Completed OTA attempts by method and result.");
+            static const char* const methods[] = {"url", "web"};
+            for (int method = 0; method < 2; method++) {
+                for (int result = 0; result < 2; result++) {
+                    char labels[48];
+                    snprintf(labels, sizeof(labels), "method=\"%s\",result=\"%s\"", methods[method], result ? "success" : "failure");
+                    appendMetric(out, "esp32helper_ota_updates_total", labels, _otaResults[method][result]);
+                }
+            }
+#endif
+            break;
+        default:
+            return false;
     }
-    http.end();
+    return true;
 }
+#endif
 
 void ESP32Helper::handleNotFound() {
+    if (_apStarted && isCaptiveRequest()) {
+        server.sendHeader("Location", String("http://") + WiFi.softAPIP().toString() + "/setup");
+        server.send(302, "text/plain", "");
+        return;
+    }
     server.send(404, "text/plain", "404: Not found");
 }
 
+#if HELPER_FEATURE_LOG_STORE
+// Tek aralık: "bytes=a-b", "bytes=a-", "bytes=-n". 1: [start, end) ayarlandı, 0: başlık yok sayılır
+// (tamamı gönderilir), -1: aralık dosyanın dışında
+static int parseByteRange(const char* header, size_t size, size_t& start, size_t& end) {
+    if (strncmp(header, "bytes=", 6) != 0 || strchr(header, ',')) { return 0; }
+    const char* p = header + 6;
+    char* after = nullptr;
+    if (*p == '-') {
+        unsigned long suffix = strtoul(p + 1, &after, 10);
+        if (after == p + 1 || *after) { return 0; }
+        if (suffix == 0 || size == 0) { return -1; }
+        start = suffix >= size ? 0 : size - suffix;
+        end = size;
+        return 1;
+    }
+    unsigned long first = strtoul(p, &after, 10);
+    if (after == p || *after != '-') { return 0; }
+    p = after + 1;
+    unsigned long last = size > 0 ? size - 1 : 0;
+    if (*p) {
+        last = strtoul(p, &after, 10);
+        if (after == p || *after || last < first) { return 0; }
+        if (last >= size) { last = size - 1; }
+    }
+    if (first >= size) { return -1; }
+    start = first;
+    end = last + 1;
+    return 1;
+}
+
+// {"first":1,"last":3,"pending":120,"segments":[{"id":1,"size":16412},...]}; boyut dosyadakidir,
+// pending henüz flash'a yazılmamış baytlardır
+void ESP32Helper::handleLogList() {
+    String json;
+    json.reserve(64 + LOG_STORE_SEGMENTS * 32);
+    json += "{\"first\":"; json += _logStore.first();
+    json += ",\"last\":"; json += _logStore.last();
+    json += ",\"pending\":"; json += (unsigned)_logStore.pending();
+    json += ",\"segments\":[";
+    bool first = true;
+    for (uint32_t id = _logStore.first(); id <= _logStore.last(); id++) {
+        File file = _logStore.openSegment(id);
+        if (!file) { continue; }
+        if (!first) { json += ','; }
+        first = false;
+        json += "{\"id\":"; json += id;
+        json += ",\"size\":"; json += (unsigned)file.size();
+        json += '}';
+    }
+    json += "]}";
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", json);
+}
+
+// Segmenti okurken parça parça gönderir; Range ile son indirilen konumdan devam edilebilir
+void ESP32Helper::handleLogDownload() {
+    File file = _logStore.openSegment((uint32_t)server.arg("id").toInt());
+    if (!file) { server.send(404, "text/plain", "Segment bulunamadi"); return; }
+    size_t size = file.size();
+    size_t start = 0, end = size;
+    int code = 200;
+    char value[48];
+    String range = server.header("Range");
+    if (range.length() > 0) {
+        int result = parseByteRange(range.c_str(), size, start, end);
+        if (result < 0) {
+            snprintf(value, sizeof(value), "bytes */%u", (unsigned)size);
+            server.sendHeader("Content-Range", value);
+            server.send(416, "text/plain", "Aralik dosyanin disinda");
+            return;
+        }
+        if (result > 0) {
+            code = 206;
+            snprintf(value, sizeof(value), "bytes %u-%u/%u", (unsigned)start, (unsigned)(end - 1), (unsigned)size);
+            server.sendHeader("Content-Range", value);
+        }
+    }
+    server.sendHeader("Accept-Ranges", "bytes");
+    server.sendHeader("Cache-Control", "no-store");
+    server.setContentLength(end - start);
+    server.send(code, "text/plain; charset=utf-8", "");
+    if (start > 0) { file.seek(start); }
+    // Dosya istemci okudukça parça parça okunur; segmentin tamamı RAM'e alınmaz
+    size_t left = end - start;
+    server.sendContent([file, left](String& chunk) mutable {
+        char buffer[512];
+        size_t count = left > 0 ? file.read((uint8_t*)buffer, left < sizeof(buffer) ? left : sizeof(buffer)) : 0;
+        if (count == 0) { return false; }
+        chunk.concat(buffer, count);
+        left -= count;
+        return left > 0;
+    });
+}
+#endif
+
+#if HELPER_WEBSOCKET
+#if HELPER_FEATURE_PANEL
+// Bağlanan istemciye giden ilk metin çerçevesi
+static const char WELCOME_TEXT[] = "ESP32'ye Hosgeldiniz!";
+#endif
+
+// Panel derlenmemişse gelen çerçeveler yalnızca sayılır
 void ESP32Helper::webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
     switch (type) {
         case WStype_DISCONNECTED:
-            webPrintf("[%u] WebSocket baglantisi kesildi.\n", num);
+            if (_wsClients > 0) { _wsClients--; }
+#if HELPER_FEATURE_WEBSERIAL
+            WebSerial.detachClient(num);
+#endif
+#if HELPER_FEATURE_PANEL
+            if (num < WEBSOCKETS_SERVER_CLIENT_MAX) { _outboxes[num].close(); }
+#endif
+            HELPER_LOGD("[%u] WebSocket baglantisi kesildi.\n", num);
             break;
         case WStype_CONNECTED: {
+            _wsClients++;
             IPAddress ip = webSocket.remoteIP(num);
-            webPrintf("[%u] WebSocket baglantisi kuruldu: %s\n", num, ip.toString().c_str());
-            webSocket.sendTXT(num, "ESP32'ye Hosgeldiniz!");
-            break;
-        }
-        case WStype_TEXT: {
-            String msg = (char*)payload;
-            if (msg.startsWith("BTN_CLICK:")) {
-                int firstColon = msg.indexOf(':');
-                int secondColon = msg.indexOf(':', firstColon + 1);
-                String id = msg.substring(firstColon + 1, secondColon);
-                bool state = msg.substring(secondColon + 1).toInt() == 1;
-                for (auto& btn : _buttons) {
-                    if (btn.id == id) {
-                        btn.currentState = state;
-                        if (btn.callback) {
-                            btn.callback(state);
-                        }
-                        break;
-                    }
-                }
-            } 
-            else if (msg.startsWith("MSG:")) {
-                String userMessage = msg.substring(4);
-                if (_messageCallback) {
-                    _messageCallback(userMessage);
-                }
+            HELPER_LOGD("[%u] WebSocket baglantisi kuruldu: %s\n", num, ip.toString().c_str());
+#if HELPER_FEATURE_WEBSERIAL
+            WebSerial.attachClient(num);
+#endif
+#if HELPER_FEATURE_PANEL
+            if (num < WEBSOCKETS_SERVER_CLIENT_MAX) { _outboxes[num].open(); }
+            _telemetry.requestKeyframe();
+            // Diğer panel çerçeveleri gibi yalnızca soket beklemeden alacaksa gönderilir
+            if (webSocket.availableForWrite(num) >= sizeof(WELCOME_TEXT) - 1 && webSocket.sendTXT(num, WELCOME_TEXT, sizeof(WELCOME_TEXT) - 1)) {
+                _wsFramesOut++; _wsBytesOut += sizeof(WELCOME_TEXT) - 1;
             }
+#endif
             break;
         }
+        case WStype_TEXT:
+        case WStype_BIN:
+            _wsFramesIn++; _wsBytesIn += length;
+#if HELPER_FEATURE_PANEL
+            handleCommand(payload, length, type == WStype_BIN);
+#else
+            (void)payload;
+#endif
+            break;
+        default:
+            break;
     }
 }
+#endif
 
-String ESP32Helper::getDynamicPanelHtml() {
-    String html = R"rawliteral(
-<!DOCTYPE html><html lang="tr"><head><title>ESP32 Yonetim Paneli</title><meta name="viewport" content="width=device-width, initial-scale=1"><meta charset="UTF-8">
-<style>
-    :root { --nav-height: 50px; --gap: 20px; --primary-color: #007bff; --light-gray: #f0f2f5; }
-    html { height: 100%; }
-    body { font-family: -apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, "Helvetica Neue", Arial, sans-serif; background: var(--light-gray); margin: 0; color: #333; height: 100%; display: flex; flex-direction: column; }
-    .card { background: #fff; border-radius: 8px; box-shadow: 0 2px 5px rgba(0,0,0,0.08); padding: var(--gap); margin-bottom: var(--gap); }
-    h2 { color: #333; border-bottom: 2px solid #eee; padding-bottom: 10px; margin-top: 0; font-size: 1.25em; }
-    label { display: block; margin-bottom: 5px; font-weight: 500; color: #555; }
-    input[type=text],input[type=password],input[type=url]{width:100%;padding:10px;margin-bottom:15px;border:1px solid #ccc;border-radius:4px;box-sizing: border-box;}
-    input[type=submit], .btn { background:var(--primary-color);color:#fff;border:none;padding:12px 18px;border-radius:5px;cursor:pointer;font-size:16px;text-decoration:none;display:inline-block;width:100%;box-sizing:border-box;margin-bottom:10px;text-align:center;transition: background-color 0.2s ease;}
-    .btn-secondary { background: #6c757d; }
-    input[type=submit]:hover, .btn:hover { background-color: #0056b3; }
-    .navbar { height:var(--nav-height);background:#fff;box-shadow:0 2px 5px rgba(0,0,0,0.1);display:flex;align-items:center;justify-content:space-between;padding:0 var(--gap);z-index:1000; flex-shrink: 0; }
-    .nav-brand { font-weight: bold; font-size: 1.2em; }
-    .nav-actions .btn { margin-left: 10px; width: auto; }
-    .nav-status { display:flex;align-items:center;font-size:0.9em;color:#555;}
-    .status-indicator { display:inline-block;width:10px;height:10px;border-radius:50%;margin-right:8px;}
-    .status-indicator.connected { background-color:#28a745; }
-    .status-indicator.disconnected { background-color:#dc3545; }
-    .main-container { display: flex; padding: var(--gap); gap: var(--gap); align-items: stretch; flex-grow: 1; overflow: hidden; }
-    .left-column { flex: 1; max-width: 300px; }
-    .right-column { flex: 2; display: flex; flex-direction: column; min-height: 0; }
-    .log-card { flex-grow: 1; display: flex; flex-direction: column; min-height: 0; }
-    #log { flex-grow:1; background:#222; color:#0f0; font-family:monospace; overflow-y:auto; border-radius:4px;padding:10px;box-sizing:border-box;white-space:pre-wrap;}
-    .log-input-area { display: flex; gap: 10px; margin-top: 15px; flex-shrink: 0; }
-    .log-input-area input { flex-grow: 1; margin-bottom: 0; }
-    .log-input-area .btn { width: auto; margin-bottom: 0; }
-    .modal { display:none;position:fixed;z-index:2000;left:0;top:0;width:100%;height:100%;overflow:auto;background-color:rgba(0,0,0,0.5);justify-content:center;align-items:center;}
-    .modal-content { background-color:#fefefe;padding:0;border:none;width:90%;max-width:700px;border-radius:8px;position:relative;box-shadow: 0 5px 15px rgba(0,0,0,0.3); overflow:hidden;}
-    .modal-header { padding: var(--gap); border-bottom: 1px solid #e5e5e5; display: flex; justify-content: space-between; align-items: center; }
-    .modal-title-group { display: flex; align-items: baseline; gap: 10px; }
-    .modal-header h2 { margin: 0; border: none; }
-    .fw-version { font-size: 0.8em; color: #999; font-weight: 500; }
-    .close-btn { color:#aaa;font-size:28px;font-weight:bold;cursor:pointer; background: none; border: none; padding: 0;}
-    .modal-body { padding: var(--gap); }
-    .switch-container { display: flex; justify-content: space-between; align-items: center; margin-bottom: 15px; }
-    .switch { position: relative; display: inline-block; width: 60px; height: 34px; }
-    .switch input { opacity: 0; width: 0; height: 0; }
-    .slider { position: absolute; cursor: pointer; top: 0; left: 0; right: 0; bottom: 0; background-color: #ccc; transition: .4s; }
-    .slider:before { position: absolute; content: ""; height: 26px; width: 26px; left: 4px; bottom: 4px; background-color: white; transition: .4s; box-shadow: 0 1px 3px rgba(0,0,0,0.2); }
-    input:checked + .slider { background-color: #2196F3; }
-    input:checked + .slider:before { transform: translateX(26px); }
-    .slider.round { border-radius: 34px; } .slider.round:before { border-radius: 50%; }
-    .footer { text-align: center; padding: 15px; color: #666; font-size: 0.9em; background: #fff; border-top: 1px solid #eee; flex-shrink: 0; }
-    .tab-nav { border-bottom: 1px solid #dee2e6; }
-    .tab-nav .btn { background: none; border: none; color: #555; border-bottom: 3px solid transparent; margin-bottom: -1px; border-radius: 0; width: auto; font-size: 1em;}
-    .tab-nav .btn.active { color: var(--primary-color); border-bottom-color: var(--primary-color); }
-    .tab-content { display: none; } .tab-content.active { display: block; }
-    .ota-section { padding: 15px; border: 1px solid #eee; border-radius: 5px; margin-bottom: 15px; }
-    .ota-section p { margin-top: 0; font-weight: 500; }
-</style>
-</head><body>
-<div class="navbar">
-    <div class="nav-brand">)rawliteral";
-    html += _hostname;
-    html += R"rawliteral(</div><div class="nav-status">)rawliteral";
-    if (_sta_connected) { html += R"rawliteral(<span class="status-indicator connected"></span>Bağlı: )rawliteral"; html += WiFi.localIP().toString();
-    } else { html += R"rawliteral(<span class="status-indicator disconnected"></span>AP Modu: )rawliteral"; html += WiFi.softAPIP().toString(); }
-    html += R"rawliteral(</div><div class="nav-actions"><button class="btn btn-secondary" onclick="restartDevice()">Yeniden Başlat</button><button class="btn" onclick="openSettings()">Ayarlar</button></div></div>
-<div class="main-container">
-    <div class="left-column">
-        <div class="card">
-            <h2>Kontroller</h2>
-            <div id="buttons-container">)rawliteral";
-    for (const auto& btn : _buttons) {
-        if (btn.type == BTN_SWITCH) {
-            html += "<div class='switch-container'><span>" + btn.name + "</span><label class='switch'><input type='checkbox' id='" + btn.id + "' onchange=\"sendButtonPress('" + btn.id + "', this.checked)\"" + (btn.currentState ? " checked" : "") + "><span class='slider round'></span></label></div>";
-        } else {
-            html += "<button class='btn' onclick=\"sendButtonPress('" + btn.id + "', 1)\">" + btn.name + "</button>";
+#if HELPER_FEATURE_PANEL
+
+// Yükün sonunda '\0' olduğu varsayılmaz; tüm ayrıştırma payload/length üzerinde yerinde yapılır
+void ESP32Helper::handleCommand(const uint8_t* payload, size_t length, bool binary) {
+    if (binary) {
+        if (length >= 3 && payload[0] == CMD_BUTTON) { handleButton(payload[1], payload[2] != 0); }
+        else if (length >= 1 && payload[0] == CMD_MESSAGE) { handleMessage(payload + 1, length - 1); }
+        return;
+    }
+    static const char btnPrefix[] = "BTN_CLICK:";
+    static const char msgPrefix[] = "MSG:";
+    if (length >= sizeof(btnPrefix) - 1 && memcmp(payload, btnPrefix, sizeof(btnPrefix) - 1) == 0) {
+        // "BTN_CLICK:<btn_N|N>:<0|1>"
+        const uint8_t* p = payload + sizeof(btnPrefix) - 1;
+        const uint8_t* end = payload + length;
+        if (end - p >= 4 && memcmp(p, "btn_", 4) == 0) { p += 4; }
+        size_t index = 0;
+        const uint8_t* digits = p;
+        // Sınırı geçen dizin reddedilir; uzun rakam dizileri size_t'de taşıp geçerli bir dizine dönemez
+        while (p < end && *p >= '0' && *p <= '9') {
+            index = index * 10 + (*p - '0'); p++;
+            if (index >= _controls.capacity()) { return; }
         }
+        if (p == digits || p >= end || *p != ':') { return; }
+        p++;
+        handleButton(index, p < end && *p == '1');
+    } else if (length >= sizeof(msgPrefix) - 1 && memcmp(payload, msgPrefix, sizeof(msgPrefix) - 1) == 0) {
+        handleMessage(payload + sizeof(msgPrefix) - 1, length - (sizeof(msgPrefix) - 1));
+    }
+}
+
+void ESP32Helper::handleButton(size_t index, bool state) {
+    if (!_controls.contains(index)) { return; }
+    const Control& control = _controls[index];
+    _controls.setState(index, state);
+    if (control.type == BTN_SWITCH) {
+        char fields[32];
+        snprintf(fields, sizeof(fields), "\"buttons\":[[%u,%d]]", (unsigned)index, state ? 1 : 0);
+        publishState(fields);
+    }
+    PanelEvent event;
+    event.type = EVENT_BUTTON; event.index = index; event.state = state; event.length = 0;
+    if (control.callback && !_events.push(event)) { HELPER_LOGW("Olay kuyrugu dolu, buton olayi atlandi\n"); }
+}
+
+void ESP32Helper::handleMessage(const uint8_t* text, size_t length) {
+    if (!_messageCallback) { return; }
+    PanelEvent event;
+    event.type = EVENT_MESSAGE; event.index = 0; event.state = false;
+    if (length > sizeof(event.text)) { HELPER_LOGW("Mesaj %u bayta kirpildi\n", (unsigned)sizeof(event.text)); length = sizeof(event.text); }
+    memcpy(event.text, text, length); event.length = length;
+    if (!_events.push(event)) { HELPER_LOGW("Olay kuyrugu dolu, mesaj atlandi\n"); }
+}
+
+void ESP32Helper::appendNetworkFields(String& json) {
+    bool online = _linkUp;
+    json += "\"sta\":"; json += online ? "true" : "false";
+    json += ",\"ip\":\""; json += online ? WiFi.localIP().toString() : WiFi.softAPIP().toString(); json += '"';
+}
+
+void ESP32Helper::publishNetworkState() {
+    String fields;
+    appendNetworkFields(fields);
+    publishState(fields.c_str());
+}
+
+// Durum değişikliği sürümü artırır ve yalnızca değişen alanları her panelin kutusuna ekler; sendPanelFrames() gönderir
+void ESP32Helper::publishState(const char* fields) {
+    _stateVersion++;
+    char frame[128];
+    int len = snprintf(frame, sizeof(frame), "%c{\"v\":%u,%s}", FRAME_STATE_DELTA, (unsigned)_stateVersion, fields);
+    if (len < 0) { return; }
+    if ((size_t)len < sizeof(frame)) {
+        for (PanelOutbox& outbox : _outboxes) { outbox.push((const uint8_t*)frame, len); }
+        return;
+    }
+    // Uzun alanlar (ör. OTA URL'si) için tek seferlik yığın tamponu
+    String longFrame;
+    longFrame.reserve(len);
+    longFrame += (char)FRAME_STATE_DELTA;
+    longFrame += "{\"v\":"; longFrame += String(_stateVersion);
+    longFrame += ','; longFrame += fields; longFrame += '}';
+    for (PanelOutbox& outbox : _outboxes) { outbox.push((const uint8_t*)longFrame.c_str(), longFrame.length()); }
+}
+
+// Panelin cihaza özel kısmı: statik sayfa bu JSON ile doldurulur
+String ESP32Helper::getStateJson() {
+    String json;
+    json.reserve(160 + _controls.size() * 48);
+    json += "{\"v\":"; json += String(_stateVersion);
+    json += ",\"host\":"; appendJsonString(json, _hostname);
+    json += ','; appendNetworkFields(json);
+    json += ",\"fw\":"; appendJsonString(json, _firmwareVersion);
+    json += ",\"ota\":"; json += String(HELPER_FEATURE_ARDUINO_OTA * 1 + HELPER_FEATURE_WEB_OTA * 2 + HELPER_FEATURE_URL_OTA * 4);
+#if HELPER_FEATURE_URL_OTA
+    json += ",\"otaUrl\":"; appendJsonString(json, _config.getString("ota_url"));
+#endif
+#if HELPER_HTTP_ENGINE
+    json += ",\"ws\":\"" HTTP_ENGINE_WS_PATH "\""; // Panel WebSocket'i sayfanın portunda açar
+#else
+    json += ",\"ws\":\":81/\"";
+#endif
+    json += ",\"buttons\":[";
+    for (size_t i = 0; i < _controls.size(); i++) {
+        if (i > 0) { json += ','; }
+        json += "{\"name\":"; appendJsonString(json, _controls[i].name);
+        json += ",\"type\":"; json += _controls[i].type == BTN_SWITCH ? '1' : '0';
+        json += ",\"state\":"; json += _controls.state(i) ? "true" : "false";
+        json += '}';
+    }
+    json += "],\"telemetry\":{\"hz\":"; json += String(_telemetry.rate());
+    json += ",\"series\":[";
+    for (size_t i = 0; i < _telemetry.size(); i++) {
+        if (i > 0) { json += ','; }
+        json += "{\"name\":"; appendJsonString(json, _telemetry.name(i));
+        json += ",\"unit\":"; appendJsonString(json, _telemetry.unit(i));
+        json += ",\"dec\":"; json += String(_telemetry.decimals(i));
+        json += '}';
     }
-    html += R"rawliteral(</div></div></div>
-    <div class="right-column"><div class="card log-card"><h2>Canlı Log</h2><div id="log"></div>
-        <div class="log-input-area">
-            <input type="text" id="logInput" placeholder="Mesaj gönder..." onkeydown="if(event.keyCode==13) sendMessage()">
-            <button class="btn" onclick="sendMessage()">Gönder</button>
-        </div>
-    </div></div>
-</div>
-<div id="settingsModal" class="modal" onclick="if(event.target == this) closeSettings()">
-    <div class="modal-content">
-        <div class="modal-header">
-            <div class="modal-title-group">
-                <h2>Ayarlar</h2>
-                <span class="fw-version">v)rawliteral";
-    html += _firmwareVersion;
-    html += R"rawliteral(</span>
-            </div>
-            <button class="close-btn" onclick="closeSettings()">&times;</button>
-        </div>
-        <div class="tab-nav">
-            <button class="btn active" onclick="openTab(event, 'wifiSettings')">WiFi Ayarları</button>
-            <button class="btn" onclick="openTab(event, 'otaSettings')">Firmware Güncelleme</button>
-        </div>
-        <div class="modal-body">
-            <div id="wifiSettings" class="tab-content active">
-                <form action="/savewifi" method="POST">
-                    <label for="ssid">WiFi Adı (SSID)</label>
-                    <input type="text" id="ssid" name="ssid" required>
-                    <label for="password">WiFi Şifresi</label>
-                    <input type="password" id="password" name="password">
-                    <input type="submit" value="Kaydet ve Yeniden Başlat">
-                </form>
-            </div>
-            <div id="otaSettings" class="tab-content">
-)rawliteral";
-    preferences.begin("ota", true);
-    String savedUrl = preferences.getString("ota_url", "");
-    preferences.end();
-    if (_sta_connected) { html += "<div class='ota-section'><p>Arduino OTA</p><span>Aktif. Port: '" + _hostname + "'</span></div>"; }
-    else { html += "<div class='ota-section'><p>Arduino OTA</p><span>Pasif. Cihaz bir WiFi agina bagli degil.</span></div>"; }
-    html += R"rawliteral(
-                <div class="ota-section">
-                    <p>Web OTA (Dosya Yükle)</p>
-                    <form method="POST" action="/update" enctype="multipart/form-data">
-                        <input type="file" name="update" accept=".bin" style="margin-bottom:10px;">
-                        <input type="submit" value="Yükle ve Güncelle">
-                    </form>
-                </div>
-                <div class="ota-section">
-                    <p>URL OTA</p>
-                    <form method="POST" action="/urlupdate">
-                        <label for="ota_url">Firmware URL (Otomatik Güncelleme için)</label>
-                        <input type="url" id="ota_url" name="url" placeholder="http://example.com/firmware.bin" value=")rawliteral";
-    html += savedUrl;
-    html += R"rawliteral(" required>
-                        <input type="submit" value="Kaydet ve Güncellemeyi Kontrol Et">
-                    </form>
-                </div>
-            </div>
-        </div>
-    </div>
-</div>
-<footer class="footer">
-    <p>&copy; 2025 Telif Hakkı 1Seyler.com</p>
-</footer>
-<script>
-    function openSettings() { document.getElementById('settingsModal').style.display = 'flex'; }
-    function closeSettings() { document.getElementById('settingsModal').style.display = 'none'; }
-    function restartDevice() { if(confirm('Cihaz yeniden başlatılsın mı?')) { fetch('/restart').then(r => alert('Cihaz yeniden başlatılıyor...')); } }
-    function sendButtonPress(id, state) { websocket.send(`BTN_CLICK:${id}:${state ? 1 : 0}`); }
-    function sendMessage() {
-        const input = document.getElementById('logInput');
-        if (input.value.trim()) { websocket.send(`MSG:${input.value.trim()}`); input.value = ''; }
-    }
-    function openTab(evt, tabName) {
-        let i, tabcontent, tablinks;
-        tabcontent = document.getElementsByClassName("tab-content");
-        for (i = 0; i < tabcontent.length; i++) { tabcontent[i].classList.remove("active"); }
-        tablinks = document.querySelectorAll(".tab-nav .btn");
-        for (i = 0; i < tablinks.length; i++) { tablinks[i].classList.remove("active"); }
-        document.getElementById(tabName).classList.add("active");
-        evt.currentTarget.classList.add("active");
-    }
-
-    var gateway = `ws://${window.location.hostname}:81/`; var websocket;
-    window.addEventListener('load', ()=>{initWebSocket();});
-    function initWebSocket() {
-        websocket = new WebSocket(gateway);
-        websocket.onclose = (e)=>{setTimeout(initWebSocket, 2000);};
-        websocket.onmessage = (e)=>{ 
-            var log = document.getElementById('log'); 
-            var isScrolledToBottom = log.scrollHeight - log.clientHeight <= log.scrollTop + 1;
-            log.innerHTML += e.data; 
-            if(isScrolledToBottom) { log.scrollTop = log.scrollHeight; }
-        };
-    }
-</script>
-</body></html>)rawliteral";
-    return html;
+    json += "]}}";
+    return json;
 }
+#else
+// Durumu dinleyen panel yok
+void ESP32Helper::publishNetworkState() {}
+#endif
@@ -3,72 +3,663 @@
 #ifndef ESP32HELPER_H
 #define ESP32HELPER_H
 
+// Derlemeden çıkarılabilen alt sistemler (0: kapalı). Kapalı özelliğin kodu, başlıkları, global nesneleri
+// ve RAM alanları derlemeye girmez; WiFi bağlantısı, AP modu, /savewifi ve seri port logları her zaman vardır.
+#ifndef HELPER_FEATURE_PANEL
+#define HELPER_FEATURE_PANEL 1       // /panel, /api/state, butonlar, telemetri ve panel komutları
+#endif
+#ifndef HELPER_FEATURE_WEBSERIAL
+#define HELPER_FEATURE_WEBSERIAL 1   // Logların WebSocket istemcilerine ve geçmiş tamponuna gönderilmesi
+#endif
+#ifndef HELPER_FEATURE_ARDUINO_OTA
+#define HELPER_FEATURE_ARDUINO_OTA 1
+#endif
+#ifndef HELPER_FEATURE_WEB_OTA
+#define HELPER_FEATURE_WEB_OTA 1     // /update yüklemesi
+#endif
+#ifndef HELPER_FEATURE_URL_OTA
+#define HELPER_FEATURE_URL_OTA 1     // /urlupdate ve açılışta otomatik kontrol (HTTPClient)
+#endif
+#ifndef HELPER_FEATURE_METRICS
+#define HELPER_FEATURE_METRICS 1     // /metrics ve süre histogramları
+#endif
+#ifndef HELPER_FEATURE_LOG_STORE
+#define HELPER_FEATURE_LOG_STORE 1   // enableLogStore() ve /logs (LittleFS)
+#endif
+#ifndef HELPER_FEATURE_CAPTIVE_DNS
+#define HELPER_FEATURE_CAPTIVE_DNS 1 // AP modunda her adı AP'ye yönlendiren DNS (telefonda kurulum sayfası açılır)
+#endif
+// Türetilenler: WebSocket sunucusu yalnızca panel ya da WebSerial için, imaj yazıcısı yalnızca OTA için kurulur
+#define HELPER_WEBSOCKET (HELPER_FEATURE_PANEL || HELPER_FEATURE_WEBSERIAL)
+#define HELPER_FIRMWARE_UPDATE (HELPER_FEATURE_WEB_OTA || HELPER_FEATURE_URL_OTA)
+
 #include <Arduino.h>
-#include <WebSocketsServer.h> 
 #include <WebServer.h>
-#include <vector>
 #include <functional>
+#include "ConfigStore.h"
+#if HELPER_WEBSOCKET
+#include <WebSocketsServer.h>
+#endif
+#if HELPER_FIRMWARE_UPDATE
+#include "FirmwareWriter.h"
+#endif
+#if HELPER_FEATURE_WEB_OTA
+#include "FirmwarePipeline.h"
+#endif
+#if HELPER_FEATURE_PANEL
+#include "SpscQueue.h"
+#include "ControlRegistry.h"
+#include "Telemetry.h"
+#include "PanelOutbox.h"
+#endif
+#if HELPER_FEATURE_METRICS
+#include "Metrics.h"
+#endif
+#if HELPER_FEATURE_LOG_STORE
+#include "LogStore.h"
+#endif
+#if HELPER_FEATURE_CAPTIVE_DNS
+#include "CaptiveDns.h"
+#endif
+
+// 1: HTTP ve WebSocket tek portta (80, HTTP_ENGINE_WS_PATH) bloklamayan HttpEngine ile sunulur.
+// 0: Arduino WebServer (80) ve WebSocketsServer (81); bağlantılar tek tek işlenir.
+#ifndef HELPER_HTTP_ENGINE
+#define HELPER_HTTP_ENGINE 0
+#endif
+#if HELPER_HTTP_ENGINE
+#include "HttpEngine.h"
+typedef HttpEngine HelperWebServer;
+typedef HttpEngine HelperSocketServer;
+#else
+// HttpEngine'deki üreticili gönderimin WebServer karşılığı; WebServer soket dolunca zaten beklediği için
+// üretici hemen sonuna kadar çağrılır
+class HelperWebServer : public WebServer {
+public:
+    typedef std::function<bool(String& chunk)> TContentProducer;
+    using WebServer::WebServer;
+    using WebServer::sendContent;
+    void sendContent(TContentProducer producer);
+};
+#if HELPER_WEBSOCKET
+// lwIP select() soketi ancak TCP_SNDLOWAT (~2.8 KB) kadar yer varken yazılabilir sayar; yazılabilir bir
+// sokete bloklamadan gönderileceği varsayılan yük (çerçeve başlığı bu payın içinde kalır)
+#ifndef HELPER_SOCKET_WRITE_SIZE
+#define HELPER_SOCKET_WRITE_SIZE 1460
+#endif
+// links2004 sunucusunun gönderimi soket dolunca bekler; yazmadan önce yer olup olmadığı buradan sorulur
+class HelperSocketServer : public WebSocketsServer {
+public:
+    using WebSocketsServer::WebSocketsServer;
+    // Bu istemciye beklemeden gönderilebilecek yük (bayt); soket doluysa ya da istemci yoksa 0
+    size_t availableForWrite(uint8_t num);
+};
+#endif
+#endif
+
+// Sunucudan panele gönderilen ikili WebSocket çerçevelerinin ilk baytı
+enum PanelFrameType : uint8_t {
+    FRAME_STATE_DELTA = 0x01, // Ardından {"v":sürüm, ...değişen alanlar} JSON'u gelir
+    FRAME_PROGRESS = 0x02,    // [tür, durum, yazılan u32, toplam u32, hız u32 bayt/sn] (küçük uçlu)
+    FRAME_TELEMETRY = 0x03,   // Ardından Telemetry çerçevesi gelir (bkz. Telemetry.h)
+    FRAME_STATE_RESYNC = 0x04 // Yük yok; sığmadığı için atılan değişiklikler var, panel /api/state'i yeniden çeker
+};
+
+// FRAME_PROGRESS çerçevesindeki tür ve durum değerleri
+enum ProgressKind : uint8_t { PROGRESS_URL_OTA = 0, PROGRESS_WEB_OTA = 1 };
+enum ProgressStatus : uint8_t { PROGRESS_RUNNING = 0, PROGRESS_DONE = 1, PROGRESS_FAILED = 2 };
+
+// Panelden gelen ikili WebSocket komutlarının ilk baytı (metin komutları BTN_CLICK:/MSG: da desteklenir)
+enum PanelCommandType : uint8_t {
+    CMD_BUTTON = 0x01, // [0x01, buton indeksi, durum]
+    CMD_MESSAGE = 0x02 // [0x02, UTF-8 mesaj...]
+};
+
+// WebSerial birleştirme tamponunun boyutu ve bekleme süresi (derleme zamanında değiştirilebilir)
+#ifndef WEBSERIAL_BUFFER_SIZE
+#define WEBSERIAL_BUFFER_SIZE 1024
+#endif
+#ifndef WEBSERIAL_FLUSH_TIMEOUT_MS
+#define WEBSERIAL_FLUSH_TIMEOUT_MS 20
+#endif
+// Yeni bağlanan istemcilere tekrar gönderilen log geçmişinin boyutu (bayt)
+#ifndef WEBSERIAL_HISTORY_SIZE
+#define WEBSERIAL_HISTORY_SIZE 4096
+#endif
+// Ağ görevi modunda tampon doluyken başka görevlerden yazanların boşalmayı bekleyeceği en uzun süre
+#ifndef WEBSERIAL_WRITE_WAIT_MS
+#define WEBSERIAL_WRITE_WAIT_MS 50
+#endif
+
+// İstemci başına gönderim kuyruğunun boyutu (bayt); tüm istemcilerinki begin()'de bir kez ayrılır
+#ifndef WEBSERIAL_CLIENT_QUEUE_SIZE
+#define WEBSERIAL_CLIENT_QUEUE_SIZE 2048
+#endif
+// Bir boşaltma turunda istemci başına gönderilecek en fazla çerçeve
+#ifndef WEBSERIAL_CLIENT_FRAMES_PER_DRAIN
+#define WEBSERIAL_CLIENT_FRAMES_PER_DRAIN 4
+#endif
+// WEBSERIAL_DISCONNECT politikasında bağlantının kesileceği kuyruk doluluğu (bayt)
+#ifndef WEBSERIAL_DISCONNECT_THRESHOLD
+#define WEBSERIAL_DISCONNECT_THRESHOLD (WEBSERIAL_CLIENT_QUEUE_SIZE * 3 / 4)
+#endif
+#ifndef WEBSERIAL_CLIENT_POLICY
+#define WEBSERIAL_CLIENT_POLICY WEBSERIAL_DROP_OLDEST
+#endif
+
+// Log seviyeleri; HELPER_LOG_LEVEL'den ayrıntılı HELPER_LOGx çağrıları derlemeden tamamen çıkarılır
+enum HelperLogLevel : uint8_t {
+    HELPER_LOG_NONE,
+    HELPER_LOG_ERROR,
+    HELPER_LOG_WARN,
+    HELPER_LOG_INFO,   // webPrintf/webPrintln ve WebSerial.print bu seviyededir
+    HELPER_LOG_DEBUG,
+    HELPER_LOG_VERBOSE
+};
+
+// Eşiği ayrı ayarlanabilen log hedefleri
+enum LogSink : uint8_t {
+    LOG_SINK_SERIAL,
+    LOG_SINK_WEBSOCKET, // Bağlı paneller
+    LOG_SINK_HISTORY,   // Yeni bağlanan panele gönderilen geçmiş
+    LOG_SINK_FLASH,     // LittleFS segmentleri (enableLogStore())
+    LOG_SINK_COUNT
+};
+
+// Derlemede tutulan en ayrıntılı seviye; #if içinde değil, enum değeri olarak kullanılır
+#ifndef HELPER_LOG_LEVEL
+#define HELPER_LOG_LEVEL HELPER_LOG_INFO
+#endif
+// Hedeflerin başlangıç eşikleri (çalışırken WebSerial.setLevel() ile değiştirilebilir)
+#ifndef HELPER_LOG_SERIAL_LEVEL
+#define HELPER_LOG_SERIAL_LEVEL HELPER_LOG_LEVEL
+#endif
+#ifndef HELPER_LOG_WEBSOCKET_LEVEL
+#define HELPER_LOG_WEBSOCKET_LEVEL HELPER_LOG_LEVEL
+#endif
+#ifndef HELPER_LOG_HISTORY_LEVEL
+#define HELPER_LOG_HISTORY_LEVEL HELPER_LOG_LEVEL
+#endif
+#ifndef HELPER_LOG_FLASH_LEVEL
+#define HELPER_LOG_FLASH_LEVEL HELPER_LOG_LEVEL
+#endif
+// Bu seviyedeki ve daha ciddi satırlar flash'a toplu yazmayı beklemeden (sonraki loop()'ta) yazılır
+#ifndef HELPER_LOG_STORE_SYNC_LEVEL
+#define HELPER_LOG_STORE_SYNC_LEVEL HELPER_LOG_ERROR
+#endif
+// Tek log satırının en büyük boyutu (önek dahil); uzun satırlar "...\n" ile kırpılır
+#ifndef WEBSERIAL_LINE_SIZE
+#define WEBSERIAL_LINE_SIZE 256
+#endif
+// Satır başına "[saniye.ms] seviye " öneki
+#ifndef HELPER_LOG_TIMESTAMPS
+#define HELPER_LOG_TIMESTAMPS 1
+#endif
 
-// Buton türlerini tanımlayan enum yapısı
-enum ButtonType {
-    BTN_BUTTON, // Bas-bırak tarzı normal buton
-    BTN_SWITCH  // Açık/Kapalı durumuna sahip anahtar
+// İstemci kuyruğu dolduğunda uygulanacak politika
+enum WebSerialPolicy : uint8_t {
+    WEBSERIAL_DROP_OLDEST, // Yeni satırlara yer açılana kadar en eski satırlar atılır
+    WEBSERIAL_COALESCE,    // Birikmiş satırların tamamı tek bir "... N bayt atlandi" satırına indirilir
+    WEBSERIAL_DISCONNECT   // Kuyruk WEBSERIAL_DISCONNECT_THRESHOLD'u aşınca istemcinin bağlantısı kesilir
 };
 
-// Her bir butonun özelliklerini saklayacak yapı
-struct CustomButton {
-    String name;
-    String id;
-    ButtonType type;
-    bool currentState = false;
-    std::function<void(bool)> callback;
+// Bir istemcinin kuyruk durumu; yavaş istemcileri bulmak için /metrics'te de yayınlanır
+struct WebSerialClientStats {
+    bool connected = false;
+    WebSerialPolicy policy = WEBSERIAL_CLIENT_POLICY;
+    uint16_t depth = 0;     // Kuyrukta bekleyen bayt
+    uint16_t peakDepth = 0;
+    uint32_t framesSent = 0;
+    uint32_t bytesSent = 0;
+    uint32_t bytesDropped = 0;
+    uint32_t stalls = 0;    // Veri beklerken soketin dolu bulunduğu anlar (dolu kaldığı süre tek sayılır)
 };
 
+// Yazılanları sabit boyutlu bir tamponda biriktirir, tam satırlar halinde her istemcinin kuyruğuna ekler.
+// Kuyruklar sahip görevden sınırlı sayıda çerçeveyle boşaltılır; soketine yalnızca beklemeden sığacak kadar
+// yazılır ve gönderim kilit dışında yapılır, yavaş bir istemci ne loop()'u ne de log yazan görevleri bekletir.
+// HELPER_FEATURE_WEBSERIAL 0 iken yalnızca seri port ve flash hedefleri kalır; tampon, geçmiş ve kuyruklar yer kaplamaz.
 class WebSerial_ : public Print {
 public:
     WebSerial_();
-    void begin(WebSocketsServer* socket);
+#if HELPER_FEATURE_WEBSERIAL
+    void begin(HelperSocketServer* socket);
+    void loop();
+#endif
     virtual size_t write(uint8_t);
     virtual size_t write(const uint8_t *buffer, size_t size);
+    virtual void flush();
+    // Satırı bir kez biçimlendirip eşiği geçen hedeflere yazar; genellikle HELPER_LOGx makrolarıyla çağrılır
+    void logf(HelperLogLevel level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    void vlogf(HelperLogLevel level, const char* format, va_list args);
+    void setLevel(LogSink sink, HelperLogLevel level) { if (sink < LOG_SINK_COUNT) { _levels[sink] = level; } }
+    HelperLogLevel level(LogSink sink) const { return sink < LOG_SINK_COUNT ? _levels[sink] : HELPER_LOG_NONE; }
+#if HELPER_FEATURE_LOG_STORE
+    // LOG_SINK_FLASH eşiğini geçen satırlar bu depoya da eklenir
+    void setStore(LogStore* store) { _store = store; }
+#endif
+#if HELPER_FEATURE_WEBSERIAL
+    // Bağlanan istemcinin kuyruğunu sıfırlayıp log geçmişini ekler; kopan istemcinin kuyruğu boşaltılır
+    void attachClient(uint8_t num);
+    void detachClient(uint8_t num);
+    // Ayarlanırsa WebSocket'e yalnızca bu görev gönderir; diğer görevler sadece tampona yazar
+    void setOwner(TaskHandle_t owner) { _owner = owner; }
+    // Bağlı tüm istemcilere ve sonradan bağlanacaklara uygulanır
+    void setClientPolicy(WebSerialPolicy policy);
+    // Yalnızca bu istemci için; yeniden bağlanınca varsayılana döner
+    void setClientPolicy(uint8_t num, WebSerialPolicy policy);
+    WebSerialClientStats clientStats(uint8_t num) const;
+
+    uint32_t framesSent() const { return _framesSent; }
+    uint32_t bytesSent() const { return _bytesSent; }
+    uint32_t bytesLogged() const { return _bytesLogged; }
+    uint32_t bytesDropped() const { return _bytesDropped; }
+    uint32_t evictions() const { return _evictions; }
+#endif
+
 private:
-    WebSocketsServer* _socket = nullptr;
+    size_t append(const uint8_t* buffer, size_t size, HelperLogLevel level);
+#if HELPER_FEATURE_WEBSERIAL
+    struct ClientQueue {
+        uint8_t* data = nullptr; // _queues içindeki WEBSERIAL_CLIENT_QUEUE_SIZE baytlık dilim
+        size_t length = 0;
+        bool blocked = false; // Son bakışta soket doluydu
+        bool evict = false;
+        WebSerialClientStats stats;
+    };
+
+    void send(size_t length);
+    void record(const uint8_t* data, size_t length);
+    void replayHistory(ClientQueue& client);
+    void enqueue(ClientQueue& client, const uint8_t* data, size_t length, WebSerialPolicy policy);
+    void drain(uint8_t num, int maxFrames);
+    void drainClients(int maxFrames);
+    bool canSend() const { return _owner == nullptr || _owner == xTaskGetCurrentTaskHandle(); }
+    void lock() const { if (_lock) { xSemaphoreTake(_lock, portMAX_DELAY); } }
+    void unlock() const { if (_lock) { xSemaphoreGive(_lock); } }
+
+    HelperSocketServer* _socket = nullptr;
+    SemaphoreHandle_t _lock = nullptr; // Tampon ve geçmiş her görevden yazılabilir
+    TaskHandle_t _owner = nullptr;
+    uint8_t _buffer[WEBSERIAL_BUFFER_SIZE];
+    size_t _length = 0;
+    size_t _lineEnd = 0; // Tampondaki son '\n' karakterinden sonraki konum
+    unsigned long _pendingSince = 0;
+    uint32_t _framesSent = 0;
+    uint32_t _bytesSent = 0;
+    uint32_t _bytesLogged = 0;
+    uint32_t _bytesDropped = 0;
+    uint32_t _evictions = 0;
+    WebSerialPolicy _policy = WEBSERIAL_CLIENT_POLICY;
+    ClientQueue _clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+    uint8_t* _queues = nullptr; // begin()'de ayrılır, bırakılmaz
+    uint8_t _frame[WEBSERIAL_BUFFER_SIZE]; // Kuyruktan alınıp kilit dışında gönderilen çerçeve; yalnızca sahip görev kullanır
+
+    // Geçmiş eşiğini geçen logların halka tamponu; _historyHead bir sonraki yazma konumudur
+    uint8_t _history[WEBSERIAL_HISTORY_SIZE];
+    size_t _historyHead = 0;
+    bool _historyWrapped = false;
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    LogStore* _store = nullptr;
+#endif
+    HelperLogLevel _levels[LOG_SINK_COUNT] = {HELPER_LOG_SERIAL_LEVEL, HELPER_LOG_WEBSOCKET_LEVEL, HELPER_LOG_HISTORY_LEVEL, HELPER_LOG_FLASH_LEVEL};
 };
 extern WebSerial_ WebSerial;
 
+// Seviyeli log makroları; HELPER_LOG_LEVEL'i aşan çağrılar argümanlarıyla birlikte derlemeden çıkar
+#define HELPER_LOG(level, ...) do { if ((level) <= HELPER_LOG_LEVEL) { WebSerial.logf((level), __VA_ARGS__); } } while (0)
+#define HELPER_LOGE(...) HELPER_LOG(HELPER_LOG_ERROR, __VA_ARGS__)
+#define HELPER_LOGW(...) HELPER_LOG(HELPER_LOG_WARN, __VA_ARGS__)
+#define HELPER_LOGI(...) HELPER_LOG(HELPER_LOG_INFO, __VA_ARGS__)
+#define HELPER_LOGD(...) HELPER_LOG(HELPER_LOG_DEBUG, __VA_ARGS__)
+#define HELPER_LOGV(...) HELPER_LOG(HELPER_LOG_VERBOSE, __VA_ARGS__)
+
+// WiFi bağlantı durum makinesinin zamanlamaları (ms)
+#ifndef WIFI_CONNECT_TIMEOUT_MS
+#define WIFI_CONNECT_TIMEOUT_MS 10000
+#endif
+#ifndef WIFI_FAST_CONNECT_TIMEOUT_MS
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000
+#endif
+#ifndef WIFI_EVENT_GRACE_MS
+#define WIFI_EVENT_GRACE_MS 250
+#endif
+#ifndef WIFI_BACKOFF_MIN_MS
+#define WIFI_BACKOFF_MIN_MS 1000
+#endif
+#ifndef WIFI_BACKOFF_MAX_MS
+#define WIFI_BACKOFF_MAX_MS 60000
+#endif
+
+// Kurulum (AP) modu. Şifre boşsa AP açıktır; WPA2 için en az 8 karakter olmalıdır.
+#ifndef HELPER_AP_PASSWORD
+#define HELPER_AP_PASSWORD "12345678"
+#endif
+// /savewifi'den sonra STA bağlanınca AP bu kadar daha açık kalır; kurulum sayfası yeni IP'yi gösterebilsin
+#ifndef HELPER_AP_LINGER_MS
+#define HELPER_AP_LINGER_MS 15000
+#endif
+// /savewifi ile verilen ağa bu kadar başarısız denemeden sonra önceki çalışan ağa dönülür ve AP açılır
+#ifndef HELPER_PROVISION_MAX_FAILURES
+#define HELPER_PROVISION_MAX_FAILURES 3
+#endif
+// /api/scan sonucu bu süre önbellekten verilir; sonra yeni tarama arka planda başlatılır
+#ifndef HELPER_SCAN_CACHE_MS
+#define HELPER_SCAN_CACHE_MS 30000
+#endif
+// /api/scan'de en güçlü bu kadar ağ listelenir (aynı SSID bir kez)
+#ifndef HELPER_SCAN_MAX_RESULTS
+#define HELPER_SCAN_MAX_RESULTS 16
+#endif
+
+// URL OTA indirme ayarları
+#ifndef URL_OTA_TIMEOUT_MS
+#define URL_OTA_TIMEOUT_MS 5000
+#endif
+// HEAD ve GET bağlantısı loop() içinde kurulur; ulaşılamayan sunucu web/WebSocket'i bundan uzun bekletmez
+#ifndef URL_OTA_CONNECT_TIMEOUT_MS
+#define URL_OTA_CONNECT_TIMEOUT_MS 300
+#endif
+#ifndef URL_OTA_STALL_TIMEOUT_MS
+#define URL_OTA_STALL_TIMEOUT_MS 10000
+#endif
+#ifndef URL_OTA_RETRY_DELAY_MS
+#define URL_OTA_RETRY_DELAY_MS 2000
+#endif
+#ifndef URL_OTA_MAX_RETRIES
+#define URL_OTA_MAX_RETRIES 5
+#endif
+#ifndef URL_OTA_CHUNK_SIZE
+#define URL_OTA_CHUNK_SIZE 1460
+#endif
+#ifndef OTA_PROGRESS_INTERVAL_MS
+#define OTA_PROGRESS_INTERVAL_MS 250
+#endif
+
+// Ağ görevi ve uygulamaya aktarılan panel olayları
+#ifndef NETWORK_TASK_STACK_SIZE
+#define NETWORK_TASK_STACK_SIZE 8192
+#endif
+#ifndef NETWORK_TASK_PRIORITY
+#define NETWORK_TASK_PRIORITY 1
+#endif
+#ifndef HELPER_EVENT_QUEUE_SIZE
+#define HELPER_EVENT_QUEUE_SIZE 16 // İkinin kuvveti olmalı
+#endif
+#ifndef HELPER_EVENT_TEXT_SIZE
+#define HELPER_EVENT_TEXT_SIZE 128 // Daha uzun mesajlar kırpılır
+#endif
+// Panele eklenebilecek en fazla buton/anahtar (en çok 256; her biri ~16 bayt RAM)
+#ifndef HELPER_MAX_CONTROLS
+#define HELPER_MAX_CONTROLS 32
+#endif
+
+#if HELPER_FEATURE_URL_OTA
+class HTTPClient;
+#endif
+
+// Açılış ve yeniden bağlanma süreleri; eski bloklayan connectToWifi() ile karşılaştırma için
+struct WifiStats {
+    uint32_t bootToOnlineMs = 0;   // begin() çağrısından ilk IP alınana kadar
+    uint32_t lastReconnectMs = 0;  // Son kopma ile tekrar IP alınması arası
+    uint32_t reconnectAttempts = 0;
+    uint32_t fastConnects = 0;     // Kayıtlı BSSID/kanal/IP ile yapılan bağlantılar
+    uint32_t provisionToOnlineMs = 0; // Son /savewifi isteğinden IP alınana kadar (yeniden başlatmadan)
+};
+
 class ESP32Helper {
 public:
+    // messageCallback panelden gelen mesajlar içindir; HELPER_FEATURE_PANEL 0 iken yok sayılır
     ESP32Helper(const char* hostname = "esp32-helper", const char* firmwareVersion = "0.0.0", std::function<void(String)> messageCallback = nullptr);
+    // begin() öncesinde çağrılırsa HTTP, WebSocket, WiFi ve OTA işleri ayrı bir görevde çalışır
+    // (core < 0 ise loop()'un çalışmadığı çekirdek); loop() o zaman yalnızca olayları geri çağırır
+    void enableNetworkTask(int core = -1);
+#if HELPER_FEATURE_LOG_STORE
+    // begin() öncesinde çağrılırsa LittleFS bağlanır ve loglar yeniden başlatmadan sonra da okunabilecek
+    // segmentlere yazılır; /logs listeler, /logs?id=N (Range destekli) indirir
+    void enableLogStore() { _logStoreEnabled = true; }
+#endif
     void begin();
     void loop();
 
+    // webPrintln/webPrintf her görevden çağrılabilir; HELPER_LOG_INFO seviyesinde yazar
+    void webPrintln(const char* message);
     void webPrintln(const String& message);
-    void webPrintf(const char* format, ...);
+    void webPrintf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+#if HELPER_FEATURE_PANEL
+    // Butonlar begin() öncesinde eklenir; name flash'taki sabit metin olmalıdır (kopyalanmaz).
+    // Kimliği (0, 1, ...), liste doluysa ya da ağ görevi başlamışsa -1 döner.
+    int addButton(const char* name, ButtonType type, ControlCallback callback, void* context = nullptr);
+    int addButton(const char* name, ButtonType type, void (*callback)(bool));
+    bool buttonState(int id) const { return id >= 0 && _controls.contains(id) && _controls.state(id); }
+
+    // Panelde grafik olarak çizilen sayısal seri; begin() öncesinde eklenir, name/unit kopyalanmaz.
+    // Değerler 10^decimals ile tamsayıya çevrilerek gönderilir. Kimliği ya da -1 döner.
+    int addSeries(const char* name, const char* unit = "", uint8_t decimals = 2);
+    // Kuyruğa tek örnek atar (kilitsiz, ~birkaç düzine çevrim); tek bir görevden çağrılmalıdır.
+    // Bir periyottaki örneklerin ortalaması gönderilir; kuyruk doluysa false döner.
+    bool publish(int series, float value) { return _telemetry.publish(series, value); }
+    void setTelemetryRate(uint8_t hz) { _telemetry.setRate(hz); }
+    uint32_t droppedSamples() const { return _telemetry.dropped(); }
+    // Kuyruk dolu olduğu için kaybedilen buton/mesaj olayları
+    uint32_t droppedEvents() const { return _events.dropped(); }
+#endif
+
+    const WifiStats& wifiStats() const { return _wifiStats; }
+#if HELPER_FEATURE_CAPTIVE_DNS
+    // AP modunda çalışır; STA bağlanıp AP kapanınca durur
+    const CaptiveDns& captiveDns() const { return _dns; }
+#endif
 
-    void addButton(const String& name, ButtonType type, std::function<void(bool)> callback);
+    // Kullanıcı anahtarları begin() öncesinde config().addString(...) ile kaydedilebilir
+    ConfigStore& config() { return _config; }
+#if HELPER_FEATURE_LOG_STORE
+    LogStore& logStore() { return _logStore; }
+#endif
 
 private:
-    void connectToWifi();
+    enum WifiState { CONN_IDLE, CONN_CONNECTING, CONN_ONLINE, CONN_BACKOFF };
+
+    // Hızlı yeniden bağlanma için NVS'te saklanan ağ bilgileri
+    struct WifiCache {
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint8_t reserved;
+        uint32_t ip, gateway, subnet, dns;
+    };
+
+#if HELPER_FEATURE_PANEL
+    // Ağ tarafından kuyruğa atılan, uygulama tarafında geri çağrılan olay
+    enum PanelEventType : uint8_t { EVENT_BUTTON, EVENT_MESSAGE };
+    struct PanelEvent {
+        uint8_t type;
+        bool state;
+        uint16_t index;
+        uint16_t length;
+        char text[HELPER_EVENT_TEXT_SIZE];
+    };
+#endif
+
+#if HELPER_FEATURE_METRICS
+    // Süresi ölçülen HTTP yolu; uri kayıt sırasında verilen sabit metindir
+    struct RouteMetrics {
+        const char* uri;
+        CycleHistogram latency;
+    };
+#endif
+
+    static void networkTask(void* arg);
+    void networkLoop();
+
+    void connectToWifi(bool allowFastPath);
+    void updateWifi();
+    void onWifiConnected();
+    void saveWifiCache();
+    void migrateLegacyConfig();
+    void restartDevice(unsigned long delayMs);
+    void updateRestart();
     void startAPMode();
+    void stopAPMode();
+    void restorePreviousWifi();
+    void updateAPMode();
+    void startScan();
+    void cacheScanResults(int16_t count);
+    bool isCaptiveRequest();
     void startWebServer();
-    void handleRoot();
+    void on(const char* uri, HTTPMethod method, std::function<void()> handler);
+    // HELPER_FEATURE_METRICS 0 iken işleyiciyi olduğu gibi döndürür
+    std::function<void()> timed(const char* uri, std::function<void()> handler);
+    void handleSetup();
     void handleSaveWifi();
+    void handleWifiStatus();
+    void handleScan();
     void handleNotFound();
-    void setupOTA();
-    void handleUrlUpdate();
+    void publishNetworkState();
+#if HELPER_FEATURE_METRICS
+    void handleMetrics();
+    bool appendMetrics(String& out, size_t section);
+#endif
+#if HELPER_FEATURE_LOG_STORE
+    void handleLogList();
+    void handleLogDownload();
+#endif
+#if HELPER_WEBSOCKET
     void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length);
-    String getDynamicPanelHtml();
+#endif
+#if HELPER_FEATURE_PANEL
+    void dispatchEvents();
+    void handleRoot();
+    void handleState();
+    String getStateJson();
+    void appendNetworkFields(String& json);
+    void publishState(const char* fields);
+    void handleCommand(const uint8_t* payload, size_t length, bool binary);
+    void handleButton(size_t index, bool state);
+    void handleMessage(const uint8_t* text, size_t length);
+    void updateTelemetry();
+    void sendPanelFrames();
+    bool sendPanelFrame(uint8_t num, size_t& room, const uint8_t* frame, size_t length);
+#endif
+#if HELPER_FEATURE_ARDUINO_OTA
+    void setupOTA();
+#endif
+#if HELPER_FEATURE_WEB_OTA
     void handleFileUpload();
-    void autoUpdateCheck();
+    void handleUpdateResult();
+#endif
+#if HELPER_FEATURE_URL_OTA
+    enum UrlOtaState { URL_OTA_IDLE, URL_OTA_CHECK, URL_OTA_DOWNLOAD, URL_OTA_RETRY };
+    void handleUrlUpdate();
+    void startUrlUpdate();
+    void updateUrlOta();
+    void checkUrlUpdate();
+    bool beginUrlImage(int size, const String& sha256, const String& etag);
+    void requestUrlUpdate();
+    void downloadUrlUpdate();
+    void retryUrlUpdate();
+    void finishUrlUpdate(bool success, const char* error);
+#endif
+#if HELPER_FIRMWARE_UPDATE
+    void publishProgress(uint8_t kind, uint8_t status, uint32_t done, uint32_t total);
+#endif
 
     String _hostname;
     String _firmwareVersion;
-    bool _sta_connected = false;
+    bool _sta_connected = false; // STA en az bir kez bağlandı (OTA vb. kuruldu)
+    bool _linkUp = false;
+    bool _apStarted = false;
 
-    // YENİ: Yeniden bağlanma denemeleri arasındaki zamanı takip etmek için değişken
-    unsigned long _lastReconnectAttempt = 0;
+    WifiState _wifiState = CONN_IDLE;
+    bool _wifiFastPath = false;
+    volatile bool _wifiGotIp = false;        // WiFi olay görevinden set edilir
+    volatile bool _wifiDisconnected = false;
+    unsigned long _wifiStateSince = 0;
+    unsigned long _wifiBackoffMs = 0;
+    unsigned long _wifiDisconnectedAt = 0;
+    uint8_t _wifiFailures = 0;
+    unsigned long _bootMs = 0;
+    unsigned long _restartAt = 0; // 0 değilse bu zamanda yeniden başlatılır
+    WifiStats _wifiStats;
 
-    std::vector<CustomButton> _buttons;
+    unsigned long _provisionStart = 0; // 0 değilse /savewifi'den sonra ilk bağlantı bekleniyor
+    String _previousSsid;              // /savewifi anında çevrimiçi olunan ağ (yeni ağ başarısız olursa dönülür)
+    String _previousPassword;
+    unsigned long _apCloseAt = 0;      // 0 değilse AP bu zamanda kapatılır
+    bool _scanRunning = false;
+    unsigned long _scanAt = 0;         // Son tamamlanan tarama
+    String _scanJson;                  // Önbellekteki /api/scan ağ listesi (boş: henüz tarama yok)
+#if HELPER_FEATURE_CAPTIVE_DNS
+    CaptiveDns _dns;
+#endif
+
+#if HELPER_FIRMWARE_UPDATE
+    FirmwareWriter _firmware; // Web ve URL OTA'nın ortak, SHA-256 doğrulamalı yazma yolu
+    unsigned long _progressStart[2] = {0, 0}; // Hız hesabı için [ProgressKind] başına başlangıç
+    uint32_t _progressBase[2] = {0, 0};
+    uint32_t _otaResults[2][2] = {{0, 0}, {0, 0}}; // [ProgressKind][0: başarısız, 1: başarılı]
+#endif
+#if HELPER_FEATURE_WEB_OTA
+    FirmwarePipeline _upload; // Web OTA: alım ile flash yazımı ayrı görevlerde örtüşür
+    String _uploadError;      // Boş değilse /update bu hatayla yanıt verir
+    bool _uploadDone = false;
+    size_t _uploadTotal = 0;
+    unsigned long _uploadLastProgress = 0;
+#endif
+#if HELPER_FEATURE_URL_OTA
+    String _firmwareBase;     // Çalışan imajın ELF SHA-256 özeti (x-firmware-base)
+    UrlOtaState _urlOtaState = URL_OTA_IDLE;
+    HTTPClient* _urlOtaHttp = nullptr; // Yalnızca indirme sırasında ayrılır
+    String _urlOtaEtag;
+    size_t _urlOtaTotal = 0;
+    size_t _urlOtaWritten = 0;
+    uint8_t _urlOtaRetries = 0;
+    unsigned long _urlOtaStateSince = 0;
+    unsigned long _urlOtaLastData = 0;
+    unsigned long _urlOtaLastProgress = 0;
+#endif
+
+    int _networkCore = -1;
+    TaskHandle_t _networkTaskHandle = nullptr;
+    bool _networkTaskEnabled = false;
+
+#if HELPER_FEATURE_METRICS
+    // /metrics sayaçları; sıcak yolda yalnızca çevrim sayacı okunur ve tamsayı artırılır
+    CycleHistogram _loopDuration;    // loop() içinde geçen süre
+    CycleHistogram _loopInterval;    // Ardışık loop() çağrılarının başlangıçları arası (kullanıcı kodu dahil)
+    CycleHistogram _networkDuration; // Ağ görevi modunda bir networkLoop() turu
+    uint32_t _lastLoopStart = 0;
+    RouteMetrics _routeMetrics[METRICS_MAX_ROUTES];
+    size_t _routeCount = 0;
+#endif
+#if HELPER_WEBSOCKET
+    uint32_t _wsFramesIn = 0;
+    uint32_t _wsBytesIn = 0;
+    uint32_t _wsFramesOut = 0; // İstemci başına panel çerçeveleri (loglar WebSerial'da sayılır)
+    uint32_t _wsBytesOut = 0;
+    uint8_t _wsClients = 0;
+#endif
+
+#if HELPER_FEATURE_PANEL
+    uint32_t _stateVersion = 0; // /api/state ve WebSocket değişiklik çerçevelerinin ortak sürümü
+    SpscQueue<PanelEvent, HELPER_EVENT_QUEUE_SIZE> _events; // Üretici ağ, tüketici uygulama tarafı
+    ControlRegistry<HELPER_MAX_CONTROLS> _controls;
+    Telemetry _telemetry; // Örnekler uygulamadan gelir, çerçeveler ağ tarafında üretilir
+    // İkili panel çerçeveleri soketin beklemeden alacağı kadar gönderilir; geri kalanı istemcinin kutusunda bekler
+    PanelOutbox _outboxes[WEBSOCKETS_SERVER_CLIENT_MAX];
+    uint8_t _telemetryFrame[1 + Telemetry::maxFrameSize()]; // Son telemetri çerçevesi (tüm istemcilerin ortak kopyası)
+    size_t _telemetryLength = 0;
+#if HELPER_FIRMWARE_UPDATE
+    uint8_t _progressFrames[2][15]; // [ProgressKind] başına son ilerleme çerçevesi
+#endif
     std::function<void(String)> _messageCallback;
+#endif
+    ConfigStore _config;
+#if HELPER_FEATURE_LOG_STORE
+    bool _logStoreEnabled = false;
+    LogStore _logStore;
+#endif
 };
 
 #endif
@@ -0,0 +1,114 @@
+// lib/ESP32Helper/FirmwarePipeline.cpp
+
+#include "FirmwarePipeline.h"
+
+// Yazıcı paylaşılır: kendi yarım kalmış yüklemesi iptal edilir, başka bir güncellemenin süren yazımı bozulmaz
+bool FirmwarePipeline::begin(size_t size, const char* sha256Hex) {
+    abort();
+    _received = 0;
+    _waitMs = 0;
+    _failed = false;
+    _error = nullptr;
+    if (_writer.isRunning()) {
+        _error = "Baska bir guncelleme suruyor";
+        return false;
+    }
+    if (!_writer.begin(size, sha256Hex)) { return false; }
+    _buffers[0] = (uint8_t*)malloc(FIRMWARE_PIPELINE_BUFFER_SIZE);
+    _buffers[1] = (uint8_t*)malloc(FIRMWARE_PIPELINE_BUFFER_SIZE);
+    // Kuyruklar ilk yüklemede oluşturulur ve sonrakilerde yeniden kullanılır
+    if (!_free) { _free = xQueueCreate(2, sizeof(uint8_t)); }
+    if (!_full) { _full = xQueueCreate(3, sizeof(Block)); }
+    if (!_done) { _done = xQueueCreate(1, sizeof(uint8_t)); }
+    uint8_t index;
+    while (_free && xQueueReceive(_free, &index, 0) == pdTRUE) {}
+    if (_buffers[0] && _buffers[1] && _free && _full && _done &&
+        xTaskCreatePinnedToCore(writerTask, "ota_writer", FIRMWARE_PIPELINE_STACK_SIZE, this, FIRMWARE_PIPELINE_PRIORITY,
+                                &_task, FIRMWARE_PIPELINE_CORE) == pdPASS) {
+        for (index = 0; index < 2; index++) { xQueueSend(_free, &index, portMAX_DELAY); }
+        _current = -1;
+        return true;
+    }
+    _task = nullptr;
+    stop();
+    _writer.abort();
+    _error = "Yukleme tamponu ayrilamadi";
+    return false;
+}
+
+void FirmwarePipeline::writerTask(void* arg) {
+    FirmwarePipeline* self = (FirmwarePipeline*)arg;
+    Block block;
+    while (xQueueReceive(self->_full, &block, portMAX_DELAY) == pdTRUE && block.length > 0) {
+        // Hatadan sonra gelen tamponlar yazılmadan geri verilir; alıcı bekleyip kalmaz
+        if (!self->_failed && !self->_writer.write(self->_buffers[block.index], block.length)) { self->_failed = true; }
+        xQueueSend(self->_free, &block.index, portMAX_DELAY);
+    }
+    uint8_t done = 1;
+    xQueueSend(self->_done, &done, portMAX_DELAY);
+    vTaskDelete(nullptr);
+}
+
+bool FirmwarePipeline::write(const uint8_t* data, size_t length) {
+    if (!_task || _failed) { return false; }
+    _received += length;
+    while (length > 0) {
+        if (_current < 0) {
+            uint8_t index;
+            unsigned long start = millis();
+            xQueueReceive(_free, &index, portMAX_DELAY);
+            _waitMs += millis() - start;
+            _current = index;
+            _fill = 0;
+        }
+        size_t chunk = FIRMWARE_PIPELINE_BUFFER_SIZE - _fill;
+        if (chunk > length) { chunk = length; }
+        memcpy(_buffers[_current] + _fill, data, chunk);
+        _fill += chunk; data += chunk; length -= chunk;
+        if (_fill == FIRMWARE_PIPELINE_BUFFER_SIZE) { submit(); }
+    }
+    return !_failed;
+}
+
+void FirmwarePipeline::submit() {
+    Block block = {(uint8_t)_current, (uint16_t)_fill};
+    xQueueSend(_full, &block, portMAX_DELAY);
+    _current = -1;
+    _fill = 0;
+}
+
+bool FirmwarePipeline::end() {
+    if (!_task) { return false; }
+    if (_current >= 0 && _fill > 0) { submit(); }
+    stop();
+    if (_failed) { return false; }
+    return _writer.end();
+}
+
+void FirmwarePipeline::abort() {
+    if (!_task) { return; }
+    stop();
+    _writer.abort();
+}
+
+FirmwarePipeline::~FirmwarePipeline() {
+    abort();
+    if (_free) { vQueueDelete(_free); }
+    if (_full) { vQueueDelete(_full); }
+    if (_done) { vQueueDelete(_done); }
+}
+
+// Bekleyen tamponlar yazıldıktan sonra görev durur ve tamponlar bırakılır
+void FirmwarePipeline::stop() {
+    if (_task) {
+        Block block = {0, 0};
+        xQueueSend(_full, &block, portMAX_DELAY);
+        uint8_t done;
+        xQueueReceive(_done, &done, portMAX_DELAY);
+        _task = nullptr;
+    }
+    free(_buffers[0]); _buffers[0] = nullptr;
+    free(_buffers[1]); _buffers[1] = nullptr;
+    _current = -1;
+    _fill = 0;
+}
@@ -0,0 +1,71 @@
+// lib/ESP32Helper/FirmwarePipeline.h
+
+#ifndef FIRMWAREPIPELINE_H
+#define FIRMWAREPIPELINE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/queue.h>
+#include "FirmwareWriter.h"
+
+// Tampon boyutu flash sektörüne eşittir; Update de sektör doldukça siler ve yazar
+#ifndef FIRMWARE_PIPELINE_BUFFER_SIZE
+#define FIRMWARE_PIPELINE_BUFFER_SIZE 4096
+#endif
+// Yazıcı görevin yığını (delta kopyalama tamponu ve Update.write için)
+#ifndef FIRMWARE_PIPELINE_STACK_SIZE
+#define FIRMWARE_PIPELINE_STACK_SIZE 6144
+#endif
+#ifndef FIRMWARE_PIPELINE_PRIORITY
+#define FIRMWARE_PIPELINE_PRIORITY 2
+#endif
+#ifndef FIRMWARE_PIPELINE_CORE
+#define FIRMWARE_PIPELINE_CORE tskNO_AFFINITY
+#endif
+
+// Web OTA yüklemesi için çift tamponlu yazma hattı: bir tampon ağdan gelen parçalarla dolarken diğeri
+// ayrı bir görevde FirmwareWriter'a (gzip açma, delta, SHA-256, flash) verilir. İki tampon da
+// yazılmayı bekliyorsa write() ilki boşalana kadar bekler; böylece alıcı flash'ı hiçbir zaman geçemez.
+class FirmwarePipeline {
+public:
+    explicit FirmwarePipeline(FirmwareWriter& writer) : _writer(writer) {}
+    ~FirmwarePipeline();
+
+    bool begin(size_t size, const char* sha256Hex);
+    // Veri kopyalanır; yazma hatası bir sonraki çağrıda ya da end()'de görülür
+    bool write(const uint8_t* data, size_t length);
+    // Kalan veriyi yazar, görevi durdurur ve FirmwareWriter::end() sonucunu döndürür
+    bool end();
+    void abort();
+
+    bool isRunning() const { return _task != nullptr; }
+    size_t receivedBytes() const { return _received; }
+    // write() içinde boş tampon beklenen toplam süre (flash'ın ağdan yavaş kaldığı süre)
+    uint32_t waitMs() const { return _waitMs; }
+    const char* error() const { return _error ? _error : _writer.error(); }
+
+private:
+    struct Block {
+        uint8_t index;
+        uint16_t length; // 0: görevi durdur
+    };
+
+    static void writerTask(void* arg);
+    void submit();
+    void stop();
+
+    FirmwareWriter& _writer;
+    uint8_t* _buffers[2] = {nullptr, nullptr};
+    QueueHandle_t _free = nullptr;  // Doldurulmaya hazır tampon indeksleri
+    QueueHandle_t _full = nullptr;  // Yazılacak tamponlar
+    QueueHandle_t _done = nullptr;  // Görev durunca bir öğe gelir
+    TaskHandle_t _task = nullptr;
+    int _current = -1;
+    size_t _fill = 0;
+    size_t _received = 0;
+    uint32_t _waitMs = 0;
+    const char* _error = nullptr;
+    std::atomic<bool> _failed{false};
+};
+
+#endif
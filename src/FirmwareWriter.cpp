@@ -0,0 +1,302 @@
+// lib/ESP32Helper/FirmwareWriter.cpp
+
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+
+#include "FirmwareWriter.h"
+
+#if FIRMWARE_GZIP_SUPPORT
+#include <rom/miniz.h>
+
+// Açılan veri tinfl'in istediği 32 KB'lık dairesel sözlük tamponuna yazılır ve oradan işlenir
+struct FirmwareWriter::Inflater {
+    tinfl_decompressor decompressor;
+    size_t dictOffset;
+    uint8_t dict[TINFL_LZ_DICT_SIZE];
+};
+
+// RFC 1952 başlık bayrakları
+static const uint8_t GZIP_MAGIC[3] = {0x1f, 0x8b, 0x08};
+static const uint8_t GZIP_FLAG_HCRC = 0x02;
+static const uint8_t GZIP_FLAG_EXTRA = 0x04;
+static const uint8_t GZIP_FLAG_NAME = 0x08;
+static const uint8_t GZIP_FLAG_COMMENT = 0x10;
+static const uint8_t GZIP_FLAG_RESERVED = 0xE0;
+#endif
+
+static const uint8_t DELTA_OP_END = 0x00;
+static const uint8_t DELTA_OP_COPY = 0x01;
+static const uint8_t DELTA_OP_DATA = 0x02;
+
+static uint32_t readU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool parseHexDigest(const char* hex, uint8_t* out) {
+    if (!hex || strlen(hex) != 64) { return false; }
+    for (int i = 0; i < 32; i++) {
+        uint8_t value = 0;
+        for (int j = 0; j < 2; j++) {
+            char c = hex[i * 2 + j];
+            value <<= 4;
+            if (c >= '0' && c <= '9') { value |= c - '0'; }
+            else if (c >= 'a' && c <= 'f') { value |= c - 'a' + 10; }
+            else if (c >= 'A' && c <= 'F') { value |= c - 'A' + 10; }
+            else { return false; }
+        }
+        out[i] = value;
+    }
+    return true;
+}
+
+FirmwareWriter::FirmwareWriter() { mbedtls_sha256_init(&_sha); }
+FirmwareWriter::~FirmwareWriter() {
+    releaseInflater();
+    mbedtls_sha256_free(&_sha);
+}
+
+bool FirmwareWriter::begin(size_t size, const char* sha256Hex) {
+    if (_running) { abort(); }
+    _running = true;
+    _mode = MODE_DETECT;
+    _size = size;
+    _inputBytes = 0;
+    _imageBytes = 0;
+    _headerLength = 0;
+    _deltaState = DELTA_OP;
+    _gzipState = FIRMWARE_GZIP_SUPPORT ? GZIP_DETECT : GZIP_NONE;
+    _gzipHeaderLength = 0;
+    _gzipOutput = 0;
+    _error = "";
+    _hasExpected = false;
+    if (sha256Hex && sha256Hex[0] != '\0') {
+        if (!parseHexDigest(sha256Hex, _expected)) { return fail("Gecersiz SHA-256 ozeti"); }
+        _hasExpected = true;
+    }
+    mbedtls_sha256_starts(&_sha, 0);
+    return true;
+}
+
+bool FirmwareWriter::write(const uint8_t* data, size_t length) {
+    if (!_running) { return false; }
+    _inputBytes += length;
+#if FIRMWARE_GZIP_SUPPORT
+    if (_gzipState != GZIP_NONE) { return inflate(data, length); }
+#endif
+    return process(data, length);
+}
+
+// Açılmış (ya da hiç sıkıştırılmamış) veri
+bool FirmwareWriter::process(const uint8_t* data, size_t length) {
+    if (_mode == MODE_DETECT && !detect(data, length)) { return false; }
+    if (length == 0) { return true; }
+    return _mode == MODE_DELTA ? applyDelta(data, length) : emit(data, length);
+}
+
+#if FIRMWARE_GZIP_SUPPORT
+// gzip başlığı ve sonu parça sınırlarından bağımsız, bayt bayt çözülür. CRC32 denetlenmez:
+// bütünlük yazılan imajın SHA-256 özeti ve Update.end()'in imaj doğrulamasıyla sağlanır.
+bool FirmwareWriter::inflate(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        switch (_gzipState) {
+            case GZIP_DETECT: {
+                _gzipHeader[_gzipHeaderLength++] = *data++; length--;
+                size_t check = _gzipHeaderLength < sizeof(GZIP_MAGIC) ? _gzipHeaderLength : sizeof(GZIP_MAGIC);
+                if (memcmp(_gzipHeader, GZIP_MAGIC, check) != 0) {
+                    _gzipState = GZIP_NONE;
+                    if (!process(_gzipHeader, _gzipHeaderLength)) { return false; }
+                    return process(data, length);
+                }
+                if (_gzipHeaderLength < sizeof(_gzipHeader)) { break; }
+                if (_gzipHeader[3] & GZIP_FLAG_RESERVED) { return fail("Gecersiz gzip basligi"); }
+                _inflater = (Inflater*)malloc(sizeof(Inflater));
+                if (!_inflater) { return fail("Gzip acmak icin bellek yok"); }
+                tinfl_init(&_inflater->decompressor);
+                _inflater->dictOffset = 0;
+                _gzipState = nextGzipField();
+                break;
+            }
+            case GZIP_EXTRA_LENGTH:
+                _gzipSkip |= (size_t)*data++ << (8 * _gzipHeaderLength++); length--;
+                if (_gzipHeaderLength == 2) { _gzipState = _gzipSkip > 0 ? GZIP_EXTRA : nextGzipField(); }
+                break;
+            case GZIP_EXTRA:
+            case GZIP_HEADER_CRC: {
+                size_t chunk = length < _gzipSkip ? length : _gzipSkip;
+                data += chunk; length -= chunk; _gzipSkip -= chunk;
+                if (_gzipSkip == 0) { _gzipState = nextGzipField(); }
+                break;
+            }
+            case GZIP_NAME:
+            case GZIP_COMMENT:
+                length--;
+                if (*data++ == 0) { _gzipState = nextGzipField(); }
+                break;
+            case GZIP_BODY:
+                if (!inflateBody(data, length)) { return false; }
+                break;
+            case GZIP_TRAILER:
+                _gzipTrailer[_gzipTrailerLength++] = *data++; length--;
+                if (_gzipTrailerLength < sizeof(_gzipTrailer)) { break; }
+                if (readU32(_gzipTrailer + 4) != _gzipOutput) { return fail("Gzip boyutu uyusmuyor"); }
+                releaseInflater();
+                _gzipState = GZIP_DONE;
+                break;
+            case GZIP_DONE:
+                return fail("Gzip sonundan sonra fazla veri");
+            case GZIP_NONE:
+                return process(data, length);
+        }
+    }
+    return true;
+}
+
+// Başlıktaki isteğe bağlı alanlar RFC 1952'deki sırayla atlanır
+FirmwareWriter::GzipState FirmwareWriter::nextGzipField() {
+    uint8_t& flags = _gzipHeader[3];
+    if (flags & GZIP_FLAG_EXTRA) { flags &= ~GZIP_FLAG_EXTRA; _gzipHeaderLength = 0; _gzipSkip = 0; return GZIP_EXTRA_LENGTH; }
+    if (flags & GZIP_FLAG_NAME) { flags &= ~GZIP_FLAG_NAME; return GZIP_NAME; }
+    if (flags & GZIP_FLAG_COMMENT) { flags &= ~GZIP_FLAG_COMMENT; return GZIP_COMMENT; }
+    if (flags & GZIP_FLAG_HCRC) { flags &= ~GZIP_FLAG_HCRC; _gzipSkip = 2; return GZIP_HEADER_CRC; }
+    _gzipTrailerLength = 0;
+    return GZIP_BODY;
+}
+
+bool FirmwareWriter::inflateBody(const uint8_t*& data, size_t& length) {
+    Inflater& inflater = *_inflater;
+    while (_gzipState == GZIP_BODY) {
+        size_t inBytes = length;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - inflater.dictOffset;
+        tinfl_status status = tinfl_decompress(&inflater.decompressor, data, &inBytes, inflater.dict,
+                                               inflater.dict + inflater.dictOffset, &outBytes, TINFL_FLAG_HAS_MORE_INPUT);
+        data += inBytes; length -= inBytes;
+        if (outBytes > 0) {
+            _gzipOutput += outBytes;
+            if (!process(inflater.dict + inflater.dictOffset, outBytes)) { return false; }
+            inflater.dictOffset = (inflater.dictOffset + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        if (status == TINFL_STATUS_DONE) { _gzipState = GZIP_TRAILER; break; }
+        if (status < 0 || (inBytes == 0 && outBytes == 0 && length > 0)) { return fail("Gzip verisi bozuk"); }
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && length == 0) { break; }
+    }
+    return true;
+}
+
+void FirmwareWriter::releaseInflater() {
+    free(_inflater);
+    _inflater = nullptr;
+}
+#else
+bool FirmwareWriter::inflate(const uint8_t* data, size_t length) { return process(data, length); }
+void FirmwareWriter::releaseInflater() {}
+#endif
+
+// İlk baytlar biriktirilir; delta sihirli sayısı yoksa veri ham imaj olarak yazılır
+bool FirmwareWriter::detect(const uint8_t*& data, size_t& length) {
+    while (length > 0 && _headerLength < DELTA_HEADER_SIZE) {
+        _header[_headerLength++] = *data++; length--;
+        size_t check = _headerLength < sizeof(DELTA_MAGIC) ? _headerLength : sizeof(DELTA_MAGIC);
+        if (memcmp(_header, DELTA_MAGIC, check) != 0) {
+            _mode = MODE_RAW;
+            // Verilen boyut aktarılan bayt sayısıdır; gzip ise açılmış imajın boyutu bilinmez
+            if (!startUpdate(isCompressed() ? UPDATE_SIZE_UNKNOWN : _size)) { return false; }
+            return emit(_header, _headerLength);
+        }
+    }
+    if (_headerLength < DELTA_HEADER_SIZE) { return true; }
+    _mode = MODE_DELTA;
+    _targetSize = readU32(_header + 4);
+    memcpy(_targetSha, _header + 8, sizeof(_targetSha));
+    return startUpdate(_targetSize);
+}
+
+bool FirmwareWriter::startUpdate(size_t size) {
+    if (!Update.begin(size)) { return fail(Update.errorString()); }
+    return true;
+}
+
+// Yama işlemleri parça sınırlarından bağımsız, bayt bayt ilerleyen bir durum makinesiyle çözülür
+bool FirmwareWriter::applyDelta(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        switch (_deltaState) {
+            case DELTA_OP:
+                _op = *data++; length--;
+                _argsLength = 0;
+                if (_op == DELTA_OP_COPY) { _argsNeeded = 8; _deltaState = DELTA_ARGS; }
+                else if (_op == DELTA_OP_DATA) { _argsNeeded = 4; _deltaState = DELTA_ARGS; }
+                else if (_op == DELTA_OP_END) { _deltaState = DELTA_DONE; }
+                else { return fail("Gecersiz delta islemi"); }
+                break;
+            case DELTA_ARGS:
+                _args[_argsLength++] = *data++; length--;
+                if (_argsLength < _argsNeeded) { break; }
+                if (_op == DELTA_OP_COPY) {
+                    if (!copyFromRunning(readU32(_args), readU32(_args + 4))) { return false; }
+                    _deltaState = DELTA_OP;
+                } else {
+                    _dataRemaining = readU32(_args);
+                    _deltaState = _dataRemaining > 0 ? DELTA_DATA : DELTA_OP;
+                }
+                break;
+            case DELTA_DATA: {
+                size_t chunk = length < _dataRemaining ? length : _dataRemaining;
+                if (!emit(data, chunk)) { return false; }
+                data += chunk; length -= chunk; _dataRemaining -= chunk;
+                if (_dataRemaining == 0) { _deltaState = DELTA_OP; }
+                break;
+            }
+            case DELTA_DONE:
+                return fail("Delta sonundan sonra fazla veri");
+        }
+    }
+    return true;
+}
+
+bool FirmwareWriter::copyFromRunning(uint32_t offset, uint32_t length) {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (!running || offset > running->size || length > running->size - offset) { return fail("Delta kaynak araligi gecersiz"); }
+    uint8_t buffer[FIRMWARE_COPY_BUFFER_SIZE];
+    while (length > 0) {
+        size_t chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+        if (esp_partition_read(running, offset, buffer, chunk) != ESP_OK) { return fail("Calisan bolum okunamadi"); }
+        if (!emit(buffer, chunk)) { return false; }
+        offset += chunk; length -= chunk;
+    }
+    return true;
+}
+
+bool FirmwareWriter::emit(const uint8_t* data, size_t length) {
+    if (_mode == MODE_DELTA && length > _targetSize - _imageBytes) { return fail("Delta hedef boyutu asildi"); }
+    mbedtls_sha256_update(&_sha, data, length);
+    if (Update.write(const_cast<uint8_t*>(data), length) != length) { return fail(Update.errorString()); }
+    _imageBytes += length;
+    return true;
+}
+
+// Özet yazılan imaj üzerinden hesaplanır; uyuşmazsa Update.end() çağrılmadan iptal edilir
+bool FirmwareWriter::end() {
+    if (!_running) { return false; }
+    if (isCompressed() && _gzipState != GZIP_DONE) { return fail("Gzip verisi eksik"); }
+    if (_mode == MODE_DETECT) { return fail("Eksik firmware verisi"); }
+    if (_mode == MODE_DELTA && (_deltaState != DELTA_DONE || _imageBytes != _targetSize)) { return fail("Delta yamasi eksik"); }
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&_sha, digest);
+    if (_hasExpected && memcmp(digest, _expected, sizeof(digest)) != 0) { return fail("SHA-256 ozeti uyusmuyor"); }
+    if (_mode == MODE_DELTA && memcmp(digest, _targetSha, sizeof(digest)) != 0) { return fail("Delta hedef ozeti uyusmuyor"); }
+    if (!Update.end(true)) { return fail(Update.errorString()); }
+    _running = false;
+    return true;
+}
+
+void FirmwareWriter::abort() {
+    if (_running && _mode != MODE_DETECT) { Update.abort(); }
+    releaseInflater();
+    _running = false;
+}
+
+bool FirmwareWriter::fail(const char* error) {
+    _error = error;
+    abort();
+    return false;
+}
@@ -0,0 +1,101 @@
+// lib/ESP32Helper/FirmwareWriter.h
+
+#ifndef FIRMWAREWRITER_H
+#define FIRMWAREWRITER_H
+
+#include <Arduino.h>
+#include <mbedtls/sha256.h>
+
+// Delta yamasında çalışan bölümden kopyalama için kullanılan okuma tamponu
+#ifndef FIRMWARE_COPY_BUFFER_SIZE
+#define FIRMWARE_COPY_BUFFER_SIZE 512
+#endif
+
+// gzip ile sıkıştırılmış yüklemeler (ham imaj ya da delta yaması) yazılırken açılır. Açıcı ROM'daki
+// tinfl'dir; yalnızca gzip akışı geldiğinde ~43 KB (durum + 32 KB sözlük) ayrılır. 0 ile tamamen kapatılır.
+#ifndef FIRMWARE_GZIP_SUPPORT
+#define FIRMWARE_GZIP_SUPPORT 1
+#endif
+
+// Delta yaması biçimi (küçük uçlu):
+//   "EDP1" | hedef boyut (u32) | hedef imajın SHA-256 özeti (32 bayt) | işlemler...
+//   0x01 COPY: kaynak ofseti (u32), uzunluk (u32) -> çalışan bölümden kopyala
+//   0x02 DATA: uzunluk (u32), ardından o kadar bayt -> olduğu gibi yaz
+//   0x00 END
+// Yamalar tools/make_delta.py ile üretilir.
+static const uint8_t DELTA_MAGIC[4] = {'E', 'D', 'P', '1'};
+static const size_t DELTA_HEADER_SIZE = 4 + 4 + 32;
+
+// Web ve URL OTA'nın ortak yazma yolu: gelen veri parça parça işlenir, gzip ise açılır, delta yamaları
+// çalışan bölüme karşı uygulanır ve yazılan imajın SHA-256 özeti Update.end() öncesinde doğrulanır.
+class FirmwareWriter {
+public:
+    FirmwareWriter();
+    ~FirmwareWriter();
+
+    // size aktarılacak bayt sayısı (Content-Length), bilinmiyorsa UPDATE_SIZE_UNKNOWN; yalnızca sıkıştırılmamış
+    // ham imajda Update.begin'e verilir. sha256Hex boş/NULL ise yalnızca delta başlığındaki özet kontrol edilir
+    bool begin(size_t size, const char* sha256Hex);
+    bool write(const uint8_t* data, size_t length);
+    bool end();
+    void abort();
+
+    bool isRunning() const { return _running; }
+    bool isDelta() const { return _mode == MODE_DELTA; }
+    bool isCompressed() const { return _gzipState != GZIP_NONE && _gzipState != GZIP_DETECT; }
+    size_t inputBytes() const { return _inputBytes; }
+    size_t imageBytes() const { return _imageBytes; }
+    const char* error() const { return _error; }
+
+private:
+    enum Mode { MODE_DETECT, MODE_RAW, MODE_DELTA };
+    enum DeltaState { DELTA_OP, DELTA_ARGS, DELTA_DATA, DELTA_DONE };
+    enum GzipState { GZIP_DETECT, GZIP_NONE, GZIP_EXTRA_LENGTH, GZIP_EXTRA, GZIP_NAME, GZIP_COMMENT, GZIP_HEADER_CRC, GZIP_BODY, GZIP_TRAILER, GZIP_DONE };
+    struct Inflater;
+
+    bool process(const uint8_t* data, size_t length);
+    bool inflate(const uint8_t* data, size_t length);
+    bool inflateBody(const uint8_t*& data, size_t& length);
+    GzipState nextGzipField();
+    void releaseInflater();
+    bool detect(const uint8_t*& data, size_t& length);
+    bool startUpdate(size_t size);
+    bool applyDelta(const uint8_t* data, size_t length);
+    bool copyFromRunning(uint32_t offset, uint32_t length);
+    bool emit(const uint8_t* data, size_t length);
+    bool fail(const char* error);
+
+    bool _running = false;
+    Mode _mode = MODE_DETECT;
+    size_t _size = 0;
+    size_t _inputBytes = 0;
+    size_t _imageBytes = 0;
+    const char* _error = "";
+
+    bool _hasExpected = false;
+    uint8_t _expected[32];
+    mbedtls_sha256_context _sha;
+
+    uint8_t _header[DELTA_HEADER_SIZE];
+    size_t _headerLength = 0;
+    uint32_t _targetSize = 0;
+    uint8_t _targetSha[32];
+
+    DeltaState _deltaState = DELTA_OP;
+    uint8_t _op = 0;
+    uint8_t _args[8];
+    size_t _argsLength = 0;
+    size_t _argsNeeded = 0;
+    uint32_t _dataRemaining = 0;
+
+    GzipState _gzipState = GZIP_DETECT;
+    uint8_t _gzipHeader[10];
+    size_t _gzipHeaderLength = 0;
+    size_t _gzipSkip = 0;       // GZIP_EXTRA/GZIP_HEADER_CRC: atlanacak kalan bayt
+    uint8_t _gzipTrailer[8];
+    size_t _gzipTrailerLength = 0;
+    uint32_t _gzipOutput = 0;   // Açılan bayt sayısı (gzip ISIZE ile karşılaştırılır)
+    Inflater* _inflater = nullptr;
+};
+
+#endif
@@ -0,0 +1,969 @@
+// lib/ESP32Helper/HttpEngine.cpp
+
+// lwIP uyumluluk makroları (send, write, close...) sınıf üyeleriyle çakışmasın diye
+// soket çağrısı sınıf başlığından önce tanımlanır
+#include <lwip/sockets.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// Gönderilen bayt sayısını, soket doluysa 0, bağlantı bozulduysa -1 döner; hiçbir zaman beklemez
+static int socketSend(int fd, const void* data, size_t length) {
+    if (fd < 0) { return -1; }
+    int sent = (int)send(fd, data, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (sent >= 0) { return sent; }
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+}
+
+#undef send
+#undef write
+#undef read
+#undef close
+#undef accept
+
+#include <mbedtls/sha1.h>
+#include <strings.h>
+#include "HttpEngine.h"
+
+static const char* reasonPhrase(int code) {
+    switch (code) {
+        case 100: return "Continue";
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 301: return "Moved Permanently";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static const char* findBytes(const char* data, size_t length, const char* needle, size_t needleLength) {
+    if (needleLength == 0 || length < needleLength) { return nullptr; }
+    const char* last = data + length - needleLength;
+    for (const char* p = data; p <= last; p++) {
+        p = (const char*)memchr(p, needle[0], last - p + 1);
+        if (!p) { return nullptr; }
+        if (memcmp(p, needle, needleLength) == 0) { return p; }
+    }
+    return nullptr;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+    if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+}
+
+// Yerinde çözer; sonuç girişten hiçbir zaman uzun değildir
+static void urlDecode(char* text) {
+    char* out = text;
+    for (char* in = text; *in; in++) {
+        if (*in == '+') { *out++ = ' '; }
+        else if (*in == '%' && hexValue(in[1]) >= 0 && hexValue(in[2]) >= 0) { *out++ = (char)(hexValue(in[1]) * 16 + hexValue(in[2])); in += 2; }
+        else { *out++ = *in; }
+    }
+    *out = '\0';
+}
+
+// Virgülle ayrılmış başlık değerinde (ör. "keep-alive, Upgrade") belirteci arar
+static bool hasToken(const char* value, const char* token) {
+    size_t length = strlen(token);
+    while (*value) {
+        while (*value == ' ' || *value == ',') { value++; }
+        if (strncasecmp(value, token, length) == 0 && (value[length] == '\0' || value[length] == ',' || value[length] == ' ')) { return true; }
+        while (*value && *value != ',') { value++; }
+    }
+    return false;
+}
+
+static void base64(const uint8_t* data, size_t length, char* out) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = (uint32_t)data[i] << 16;
+        if (i + 1 < length) { chunk |= (uint32_t)data[i + 1] << 8; }
+        if (i + 2 < length) { chunk |= data[i + 2]; }
+        *out++ = table[(chunk >> 18) & 63];
+        *out++ = table[(chunk >> 12) & 63];
+        *out++ = i + 1 < length ? table[(chunk >> 6) & 63] : '=';
+        *out++ = i + 2 < length ? table[chunk & 63] : '=';
+    }
+    *out = '\0';
+}
+
+HttpEngine::~HttpEngine() {
+    for (Connection& c : _connections) { free(c.out); }
+}
+
+void HttpEngine::begin() {
+    _listener.setNoDelay(true);
+    _listener.begin();
+}
+
+void HttpEngine::close() {
+    for (uint8_t num = 0; num < HTTP_ENGINE_MAX_CLIENTS; num++) {
+        if (_connections[num].state != STATE_FREE) { closeConnection(num); }
+    }
+    _listener.end();
+}
+
+void HttpEngine::on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler) {
+    _routes.push_back(Route{uri, method, handler, uploadHandler});
+}
+
+void HttpEngine::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+    for (size_t i = 0; i < 4; i++) { _collect[i] = i < headerKeysCount ? headerKeys[i] : nullptr; }
+}
+
+void HttpEngine::handleClient() {
+    if (!_listener) { return; }
+    accept();
+    for (uint8_t num = 0; num < HTTP_ENGINE_MAX_CLIENTS; num++) {
+        if (_connections[num].state != STATE_FREE) { service(num); }
+    }
+    flushStage();
+}
+
+// Yuva yoksa en uzun süredir boşta bekleyen keep-alive bağlantısı yeni gelene bırakılır
+void HttpEngine::accept() {
+    while (_listener.hasClient()) {
+        int slot = -1;
+        int idle = -1;
+        for (uint8_t num = 0; num < HTTP_ENGINE_MAX_CLIENTS && slot < 0; num++) {
+            const Connection& c = _connections[num];
+            if (c.state == STATE_FREE) { slot = num; }
+            else if (c.state == STATE_HEAD && c.served && c.length == 0 && (idle < 0 || (int32_t)(c.lastActivity - _connections[idle].lastActivity) < 0)) { idle = num; }
+        }
+        if (slot < 0 && idle >= 0) { closeConnection((uint8_t)idle); slot = idle; }
+        if (slot < 0) { return; } // Bağlantı dinleme kuyruğunda bekler
+        Connection& c = _connections[slot];
+        c.client = _listener.available();
+        if (c.client.fd() < 0) { continue; }
+        c.client.setNoDelay(true);
+        c.length = 0;
+        c.closing = false;
+        c.failed = false;
+        c.served = false;
+        c.lastActivity = millis();
+        resetRequest(c);
+    }
+}
+
+void HttpEngine::service(uint8_t num) {
+    Connection& c = _connections[num];
+    if (!flush(c) || c.failed) { closeConnection(num); return; }
+    if (c.closing || c.state == STATE_RESPONSE) {
+        if (c.outOffset < c.outLength || c.staticLength > 0) {
+            if (millis() - c.lastActivity > HTTP_ENGINE_REQUEST_TIMEOUT_MS) { closeConnection(num); }
+            return;
+        }
+        if (c.producer) { produce(c); return; }
+        if (c.closing) { closeConnection(num); return; }
+        c.served = true;
+        resetRequest(c); // keep-alive: sıradaki istek aynı bağlantıdan okunur
+    }
+
+    if (c.state == STATE_HEAD) {
+        if (readInto(c, sizeof(c.buffer) - 1) < 0) { closeConnection(num); return; }
+        const char* end = c.length >= 4 ? findBytes(c.buffer, c.length, "\r\n\r\n", 4) : nullptr;
+        if (end) {
+            if (!parseHead(c, end - c.buffer + 4)) { respond(c, 400, "Gecersiz istek"); return; }
+            startRequest(num);
+        } else if (c.length >= sizeof(c.buffer) - 1) {
+            respond(c, 431, "Istek basliklari cok buyuk");
+        } else if (c.length == 0 && millis() - c.lastActivity > HTTP_ENGINE_IDLE_TIMEOUT_MS) {
+            closeConnection(num);
+        } else if (c.length > 0 && millis() - c.lastActivity > HTTP_ENGINE_REQUEST_TIMEOUT_MS) {
+            respond(c, 408, "Istek zaman asimina ugradi");
+        }
+    } else if (c.state == STATE_BODY) {
+        if (readInto(c, c.headLength + c.bodyLength) < 0) { closeConnection(num); return; }
+        if (c.length >= c.headLength + c.bodyLength) { dispatch(c); }
+        else if (millis() - c.lastActivity > HTTP_ENGINE_REQUEST_TIMEOUT_MS) { respond(c, 408, "Istek zaman asimina ugradi"); }
+    } else if (c.state == STATE_MULTIPART) {
+        serviceUpload(num);
+    } else if (c.state == STATE_WEBSOCKET) {
+        int read = readInto(c, sizeof(c.buffer) - 1);
+        if (read < 0) { closeConnection(num); return; }
+        if (read > 0) { processFrames(num); }
+    }
+}
+
+// Okunan bayt sayısını, bağlantı kapandıysa -1 döner; buffer'ı limit'e kadar doldurur
+int HttpEngine::readInto(Connection& c, size_t limit) {
+    int available = c.client.available();
+    if (available <= 0) { return c.client.connected() ? 0 : -1; }
+    if (c.length >= limit) { return 0; }
+    size_t want = limit - c.length;
+    if ((size_t)available < want) { want = (size_t)available; }
+    int read = c.client.read((uint8_t*)c.buffer + c.length, want);
+    if (read <= 0) { return 0; }
+    c.length += (size_t)read;
+    c.lastActivity = millis();
+    return read;
+}
+
+// İstek satırı ve başlıkları yerinde ayrıştırır; değerler buffer'ı gösterir
+bool HttpEngine::parseHead(Connection& c, size_t headLength) {
+    c.headLength = headLength;
+    c.buffer[headLength - 2] = '\0';
+    char* line = c.buffer;
+    char* next = strstr(line, "\r\n");
+    if (next) { *next = '\0'; next += 2; }
+
+    char* target = strchr(line, ' ');
+    char* version = target ? strchr(target + 1, ' ') : nullptr;
+    if (!version) { return false; }
+    *target++ = '\0';
+    *version++ = '\0';
+    static const char* const methods[] = {"", "GET", "HEAD", "POST", "PUT", "PATCH", "DELETE", "OPTIONS"};
+    int method = 0;
+    for (int i = 1; i < 8; i++) {
+        if (strcmp(line, methods[i]) == 0) { method = i; break; }
+    }
+    if (method == 0 || strncmp(version, "HTTP/1.", 7) != 0) { return false; }
+    c.method = (HTTPMethod)method;
+    c.http11 = version[7] != '0';
+    c.keepAlive = c.http11;
+    char* query = strchr(target, '?');
+    if (query) { *query++ = '\0'; }
+    urlDecode(target);
+    c.uri = target;
+    if (query) { parseArgs(c, query); }
+
+    while (next && *next) {
+        line = next;
+        next = strstr(line, "\r\n");
+        if (next) { *next = '\0'; next += 2; }
+        char* colon = strchr(line, ':');
+        if (!colon) { continue; }
+        *colon = '\0';
+        char* value = colon + 1;
+        while (*value == ' ' || *value == '\t') { value++; }
+        for (char* end = value + strlen(value); end > value && (end[-1] == ' ' || end[-1] == '\t'); end--) { end[-1] = '\0'; }
+
+        if (strcasecmp(line, "Content-Length") == 0) { c.bodyLength = strtoul(value, nullptr, 10); }
+        else if (strcasecmp(line, "Content-Type") == 0) { c.contentType = value; }
+        else if (strcasecmp(line, "Connection") == 0) {
+            if (hasToken(value, "close")) { c.keepAlive = false; }
+            else if (hasToken(value, "keep-alive")) { c.keepAlive = true; }
+        }
+        else if (strcasecmp(line, "Upgrade") == 0) { c.upgrade = strcasecmp(value, "websocket") == 0; }
+        else if (strcasecmp(line, "Sec-WebSocket-Key") == 0) { c.wsKey = value; }
+        else if (strcasecmp(line, "Expect") == 0) { c.expectContinue = strcasecmp(value, "100-continue") == 0; }
+        for (size_t i = 0; i < 4 && _collect[i]; i++) {
+            if (strcasecmp(line, _collect[i]) == 0) { c.headers[i] = value; }
+        }
+    }
+    return true;
+}
+
+// "a=1&b=2" biçimindeki metni yerinde böler ve çözer
+void HttpEngine::parseArgs(Connection& c, char* text) {
+    while (text && *text && c.argCount < HTTP_ENGINE_MAX_ARGS) {
+        char* next = strchr(text, '&');
+        if (next) { *next++ = '\0'; }
+        char* value = strchr(text, '=');
+        if (value) { *value++ = '\0'; } else { value = text + strlen(text); }
+        urlDecode(text);
+        urlDecode(value);
+        c.args[c.argCount].name = text;
+        c.args[c.argCount].value = value;
+        c.argCount++;
+        text = next;
+    }
+}
+
+const HttpEngine::Route* HttpEngine::findRoute(const Connection& c) const {
+    for (const Route& route : _routes) {
+        if (route.uri == c.uri && (route.method == HTTP_ANY || route.method == c.method)) { return &route; }
+    }
+    return nullptr;
+}
+
+void HttpEngine::startRequest(uint8_t num) {
+    Connection& c = _connections[num];
+    c.route = findRoute(c);
+    if (c.upgrade && c.wsKey && strcmp(c.uri, HTTP_ENGINE_WS_PATH) == 0) { upgradeWebSocket(num); return; }
+    if (c.bodyLength == 0) { dispatch(c); return; }
+
+    size_t space = sizeof(c.buffer) - 1 - c.headLength;
+    if (strncasecmp(c.contentType, "multipart/form-data", 19) == 0) {
+        const char* boundary = strstr(c.contentType, "boundary=");
+        size_t length = boundary ? strcspn(boundary + 9, "; ") : 0;
+        if (length == 0 || length > sizeof(c.boundary) - 4) { respond(c, 400, "Gecersiz cok parcali istek"); return; }
+        if (_uploader) { respond(c, 503, "Baska bir yukleme suruyor"); return; }
+        if (space < 256 + 2 * length) { respond(c, 431, "Istek basliklari cok buyuk"); return; }
+        memcpy(c.boundary, "\r\n--", 4);
+        memcpy(c.boundary + 4, boundary + 9, length);
+        c.boundaryLength = (uint8_t)(length + 4);
+        c.part = PART_PREAMBLE;
+        c.filePart = false;
+        c.keepAlive = false; // Yüklemeden sonra bağlantı kapanır; fazladan gelen gövde okunmaz
+        c.bodyRead = c.length - c.headLength;
+        if (c.bodyRead > c.bodyLength) { c.bodyRead = c.bodyLength; c.length = c.headLength + c.bodyLength; }
+        _uploader = &c;
+        _upload.totalSize = 0;
+        _upload.currentSize = 0;
+        c.state = STATE_MULTIPART;
+    } else if (c.bodyLength > space) {
+        respond(c, 413, "Istek govdesi cok buyuk");
+        return;
+    } else {
+        c.state = STATE_BODY;
+    }
+    if (c.expectContinue && c.length == c.headLength) {
+        static const char continueLine[] = "HTTP/1.1 100 Continue\r\n\r\n";
+        write(c, continueLine, sizeof(continueLine) - 1);
+        flushStage();
+    }
+    service(num);
+}
+
+void HttpEngine::beginResponse(Connection& c) {
+    _current = &c;
+    _headersLength = 0;
+    _contentLength = 0;
+    _lengthSet = false;
+    _closeRequested = false;
+    _headSent = false;
+    c.chunked = false;
+    c.finished = false;
+    c.producer = nullptr;
+    c.state = STATE_RESPONSE;
+}
+
+void HttpEngine::endResponse(Connection& c) {
+    if (!_headSent) { c.closing = true; } // İşleyici cevap vermedi; WebServer'daki gibi bağlantı kapanır
+    else if (c.chunked && !c.finished && !c.producer) { write(c, "0\r\n\r\n", 5); }
+    flushStage();
+    c.finished = !c.producer;
+    _current = nullptr;
+    _requestsServed++;
+}
+
+// Üreticiden soket aldıkça parça ister; alınmayan parça çıkışta bekler ve sıradaki bir sonraki tura kalır
+void HttpEngine::produce(Connection& c) {
+    bool more = true;
+    do {
+        String chunk;
+        more = c.producer(chunk);
+        if (chunk.length() > 0) { writeContent(c, chunk.c_str(), chunk.length()); }
+        if (!more) {
+            c.producer = nullptr;
+            if (c.chunked && !c.finished) { writeContent(c, "", 0); }
+            c.finished = true;
+        }
+        flushStage();
+    } while (more && !c.failed && c.outOffset == c.outLength);
+    c.lastActivity = millis();
+}
+
+void HttpEngine::dispatch(Connection& c) {
+    char* bodyEnd = nullptr;
+    char saved = 0;
+    if (c.state == STATE_BODY) {
+        // Gövdeden sonra aynı bağlantıdan gelmiş bir sonraki isteğin ilk baytı geçici olarak saklanır
+        bodyEnd = c.buffer + c.headLength + c.bodyLength;
+        saved = *bodyEnd;
+        *bodyEnd = '\0';
+        char* body = c.buffer + c.headLength;
+        if (strncasecmp(c.contentType, "application/x-www-form-urlencoded", 33) == 0) { parseArgs(c, body); }
+        else if (c.argCount < HTTP_ENGINE_MAX_ARGS) { c.args[c.argCount].name = "plain"; c.args[c.argCount].value = body; c.argCount++; }
+    }
+    beginResponse(c);
+    if (c.route) { c.route->handler(); }
+    else if (_notFound) { _notFound(); }
+    else { send(404, "text/plain", "Not found"); }
+    endResponse(c);
+    if (bodyEnd) { *bodyEnd = saved; }
+}
+
+// Hata cevabı; bağlantı cevaptan sonra kapanır
+void HttpEngine::respond(Connection& c, int code, const char* message) {
+    beginResponse(c);
+    _closeRequested = true;
+    send(code, "text/plain", message);
+    endResponse(c);
+}
+
+void HttpEngine::resetRequest(Connection& c) {
+    size_t end = c.headLength + c.bodyLength;
+    if (c.headLength > 0 && c.length > end) {
+        memmove(c.buffer, c.buffer + end, c.length - end);
+        c.length -= end;
+    } else {
+        c.length = 0;
+    }
+    c.state = STATE_HEAD;
+    c.headLength = 0;
+    c.bodyLength = 0;
+    c.bodyRead = 0;
+    c.uri = "";
+    c.contentType = "";
+    c.wsKey = nullptr;
+    c.upgrade = false;
+    c.expectContinue = false;
+    for (const char*& header : c.headers) { header = nullptr; }
+    c.argCount = 0;
+    c.route = nullptr;
+}
+
+// --- İstek arayüzü ---
+
+String HttpEngine::uri() const { return _current ? String(_current->uri) : String(); }
+HTTPMethod HttpEngine::method() const { return _current ? _current->method : HTTP_GET; }
+int HttpEngine::args() const { return _current ? _current->argCount : 0; }
+size_t HttpEngine::clientContentLength() const { return _current ? _current->bodyLength : 0; }
+
+String HttpEngine::arg(const String& name) const {
+    if (!_current) { return String(); }
+    for (uint8_t i = 0; i < _current->argCount; i++) {
+        if (name == _current->args[i].name) { return String(_current->args[i].value); }
+    }
+    return String();
+}
+
+bool HttpEngine::hasArg(const String& name) const {
+    if (!_current) { return false; }
+    for (uint8_t i = 0; i < _current->argCount; i++) {
+        if (name == _current->args[i].name) { return true; }
+    }
+    return false;
+}
+
+String HttpEngine::header(const String& name) const {
+    for (size_t i = 0; _current && i < 4 && _collect[i]; i++) {
+        if (strcasecmp(name.c_str(), _collect[i]) == 0) { return _current->headers[i] ? String(_current->headers[i]) : String(); }
+    }
+    return String();
+}
+
+bool HttpEngine::hasHeader(const String& name) const {
+    for (size_t i = 0; _current && i < 4 && _collect[i]; i++) {
+        if (strcasecmp(name.c_str(), _collect[i]) == 0) { return _current->headers[i] != nullptr; }
+    }
+    return false;
+}
+
+// --- Cevap ---
+
+// "Connection: close" saklanmaz, cevabın bağlantı başlığını belirler; sığmayan başlık düşer
+void HttpEngine::sendHeader(const String& name, const String& value, bool first) {
+    if (strcasecmp(name.c_str(), "Connection") == 0) {
+        if (strcasecmp(value.c_str(), "close") == 0) { _closeRequested = true; }
+        return;
+    }
+    size_t length = name.length() + value.length() + 4;
+    if (_headersLength + length > sizeof(_headers)) { return; }
+    char* at = _headers + _headersLength;
+    if (first) {
+        memmove(_headers + length, _headers, _headersLength);
+        at = _headers;
+    }
+    memcpy(at, name.c_str(), name.length());
+    at += name.length();
+    *at++ = ':'; *at++ = ' ';
+    memcpy(at, value.c_str(), value.length());
+    at += value.length();
+    *at++ = '\r'; *at++ = '\n';
+    _headersLength += length;
+}
+
+void HttpEngine::writeHead(int code, const char* contentType, size_t contentLength) {
+    Connection& c = *_current;
+    char line[96];
+    int length = snprintf(line, sizeof(line), "HTTP/1.%c %d %s\r\n", c.http11 ? '1' : '0', code, reasonPhrase(code));
+    write(c, line, length);
+    if (contentType && *contentType) {
+        length = snprintf(line, sizeof(line), "Content-Type: %s\r\n", contentType);
+        if (length > 0 && (size_t)length < sizeof(line)) { write(c, line, length); }
+    }
+    if (contentLength == CONTENT_LENGTH_UNKNOWN) {
+        // HTTP/1.0'da uzunluk bilinmiyorsa cevabın sonu bağlantının kapanmasıdır
+        if (c.http11) { c.chunked = true; write(c, "Transfer-Encoding: chunked\r\n", 28); }
+        else { c.keepAlive = false; }
+    } else {
+        length = snprintf(line, sizeof(line), "Content-Length: %u\r\n", (unsigned)contentLength);
+        write(c, line, length);
+    }
+    if (!c.keepAlive || _closeRequested) {
+        c.closing = true;
+        write(c, "Connection: close\r\n", 19);
+    } else {
+        write(c, "Connection: keep-alive\r\n", 24);
+    }
+    write(c, _headers, _headersLength);
+    write(c, "\r\n", 2);
+    _headSent = true;
+}
+
+void HttpEngine::send(int code, const char* contentType, const String& content) {
+    if (!_current || _headSent) { return; }
+    Connection& c = *_current;
+    writeHead(code, contentType, _lengthSet ? _contentLength : content.length());
+    if (content.length() == 0 || c.method == HTTP_HEAD) { return; }
+    if (c.chunked) { sendContent(content.c_str(), content.length()); }
+    else { write(c, content.c_str(), content.length()); }
+}
+
+// Flash'taki veri kopyalanmaz; soketin almadığı kısım oradan gönderilmeye devam eder
+void HttpEngine::send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength) {
+    if (!_current || _headSent) { return; }
+    Connection& c = *_current;
+    writeHead(code, contentType, contentLength);
+    if (c.method == HTTP_HEAD || contentLength == 0) { return; }
+    if (_stageLength + contentLength <= sizeof(_stage)) { write(c, content, contentLength); return; }
+    flushStage();
+    size_t sent = 0;
+    if (c.outOffset == c.outLength) {
+        int result = socketSend(c.client.fd(), content, contentLength);
+        if (result < 0) { c.failed = true; return; }
+        sent = (size_t)result;
+    }
+    c.staticData = (const uint8_t*)content + sent;
+    c.staticLength = contentLength - sent;
+}
+
+void HttpEngine::sendContent(const char* content, size_t length) {
+    if (!_current || !_headSent || _current->finished || _current->producer || _current->method == HTTP_HEAD) { return; }
+    writeContent(*_current, content, length);
+}
+
+void HttpEngine::sendContent(TContentProducer producer) {
+    if (!_current || !_headSent || _current->finished || _current->method == HTTP_HEAD) { return; }
+    _current->producer = producer;
+}
+
+// Chunked cevapta parça çerçevelenir; boş parça gövdeyi bitirir
+void HttpEngine::writeContent(Connection& c, const char* content, size_t length) {
+    if (!c.chunked) { write(c, content, length); return; }
+    if (length == 0) {
+        write(c, "0\r\n\r\n", 5);
+        c.finished = true;
+        return;
+    }
+    char size[12];
+    int sizeLength = snprintf(size, sizeof(size), "%x\r\n", (unsigned)length);
+    write(c, size, sizeLength);
+    write(c, content, length);
+    write(c, "\r\n", 2);
+}
+
+// Küçük yazmalar biriktirilir; tampon dolunca veya cevap bitince sokete tek seferde verilir
+void HttpEngine::write(Connection& c, const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    if (_staged != &c) { flushStage(); _staged = &c; }
+    while (length > 0) {
+        if (_stageLength == 0 && length >= sizeof(_stage)) { output(c, bytes, length); return; }
+        size_t take = sizeof(_stage) - _stageLength;
+        if (take > length) { take = length; }
+        memcpy(_stage + _stageLength, bytes, take);
+        _stageLength += take;
+        bytes += take;
+        length -= take;
+        if (_stageLength == sizeof(_stage)) { output(c, _stage, _stageLength); _stageLength = 0; }
+    }
+}
+
+void HttpEngine::flushStage() {
+    if (_staged && _stageLength > 0) { output(*_staged, _stage, _stageLength); }
+    _stageLength = 0;
+    _staged = nullptr;
+}
+
+// Önce doğrudan sokete yazar; alınmayan kısım bağlantının çıkış tamponuna eklenir
+void HttpEngine::output(Connection& c, const void* data, size_t length) {
+    if (length == 0 || c.failed) { return; }
+    const uint8_t* bytes = (const uint8_t*)data;
+    if (c.staticLength > 0) {
+        // Sıra korunmalı: flash'tan bekleyen veri önce tampona alınır
+        const uint8_t* pending = c.staticData;
+        size_t pendingLength = c.staticLength;
+        c.staticData = nullptr;
+        c.staticLength = 0;
+        output(c, pending, pendingLength);
+    }
+    if (c.outOffset == c.outLength) {
+        c.outOffset = c.outLength = 0;
+        int sent = socketSend(c.client.fd(), bytes, length);
+        if (sent < 0) { c.failed = true; return; }
+        bytes += sent;
+        length -= (size_t)sent;
+        if (length == 0) { return; }
+    }
+    if (c.outOffset > 0) {
+        memmove(c.out, c.out + c.outOffset, c.outLength - c.outOffset);
+        c.outLength -= c.outOffset;
+        c.outOffset = 0;
+    }
+    // WebSocket çerçeveleri sendFrame()'de sınırlanır; okumayan HTTP istemcisinin cevabı burada kesilir
+    size_t limit = c.state == STATE_WEBSOCKET ? HTTP_ENGINE_WS_PENDING_MAX : HTTP_ENGINE_RESPONSE_PENDING_MAX;
+    if (c.state != STATE_WEBSOCKET && c.outLength + length > limit) { c.failed = true; return; }
+    if (c.outLength + length > c.outCapacity) {
+        size_t capacity = c.outCapacity ? c.outCapacity * 2 : 512;
+        while (capacity < c.outLength + length) { capacity *= 2; }
+        if (capacity > limit && c.outLength + length <= limit) { capacity = limit; } // İki katına çıkarken sınır aşılmaz
+        uint8_t* grown = (uint8_t*)realloc(c.out, capacity);
+        if (!grown) { c.failed = true; return; }
+        c.out = grown;
+        _outputBytes += capacity - c.outCapacity;
+        if (_outputBytes > _outputPeak) { _outputPeak = _outputBytes; }
+        c.outCapacity = capacity;
+    }
+    memcpy(c.out + c.outLength, bytes, length);
+    c.outLength += length;
+}
+
+// Bekleyen çıkışı soket aldığı kadar gönderir; bağlantı bozulduysa false döner
+bool HttpEngine::flush(Connection& c) {
+    while (c.outOffset < c.outLength) {
+        int sent = socketSend(c.client.fd(), c.out + c.outOffset, c.outLength - c.outOffset);
+        if (sent < 0) { return false; }
+        if (sent == 0) { return true; }
+        c.outOffset += (size_t)sent;
+        c.lastActivity = millis();
+    }
+    if (c.out) {
+        free(c.out); // Tampon yalnızca tıkanma süresince tutulur
+        _outputBytes -= c.outCapacity;
+        c.out = nullptr;
+        c.outOffset = c.outLength = c.outCapacity = 0;
+    }
+    while (c.staticLength > 0) {
+        int sent = socketSend(c.client.fd(), c.staticData, c.staticLength);
+        if (sent < 0) { return false; }
+        if (sent == 0) { return true; }
+        c.staticData += sent;
+        c.staticLength -= (size_t)sent;
+        c.lastActivity = millis();
+    }
+    return true;
+}
+
+void HttpEngine::closeConnection(uint8_t num) {
+    Connection& c = _connections[num];
+    if (_staged == &c) { _stageLength = 0; _staged = nullptr; }
+    if (&c == _uploader) {
+        if (c.filePart) { c.filePart = false; uploadEvent(c, UPLOAD_FILE_ABORTED); }
+        _uploader = nullptr;
+    }
+    bool wasSocket = c.state == STATE_WEBSOCKET;
+    c.client.stop();
+    free(c.out);
+    _outputBytes -= c.outCapacity;
+    c.out = nullptr;
+    c.outOffset = c.outLength = c.outCapacity = 0;
+    c.staticData = nullptr;
+    c.staticLength = 0;
+    c.producer = nullptr;
+    c.length = 0;
+    c.headLength = 0;
+    c.bodyLength = 0;
+    c.closing = false;
+    c.failed = false;
+    c.state = STATE_FREE;
+    if (wasSocket && _event) { _event(num, WStype_DISCONNECTED, nullptr, 0); }
+}
+
+uint8_t HttpEngine::openConnections() const {
+    uint8_t count = 0;
+    for (const Connection& c : _connections) { count += c.state != STATE_FREE; }
+    return count;
+}
+
+// --- Çok parçalı yükleme ---
+
+void HttpEngine::serviceUpload(uint8_t num) {
+    Connection& c = _connections[num];
+    // Yükleme hızı döngü sıklığına bağlı kalmasın diye turda birkaç okuma yapılır
+    for (int round = 0; round < 8 && c.state == STATE_MULTIPART; round++) {
+        size_t limit = c.length + (c.bodyLength - c.bodyRead);
+        if (limit > sizeof(c.buffer) - 1) { limit = sizeof(c.buffer) - 1; }
+        int read = readInto(c, limit);
+        if (read < 0) { closeConnection(num); return; }
+        c.bodyRead += (size_t)read;
+        if (!processMultipart(c)) { abortUpload(c); respond(c, 400, "Gecersiz cok parcali istek"); return; }
+        if (c.part == PART_DONE) {
+            _uploader = nullptr;
+            c.length = c.headLength;
+            dispatch(c);
+            return;
+        }
+        if (c.bodyRead >= c.bodyLength) { abortUpload(c); respond(c, 400, "Yukleme eksik"); return; }
+        if (read == 0) { break; }
+    }
+    if (c.state == STATE_MULTIPART && millis() - c.lastActivity > HTTP_ENGINE_REQUEST_TIMEOUT_MS) { closeConnection(num); }
+}
+
+void HttpEngine::abortUpload(Connection& c) {
+    if (c.filePart) { c.filePart = false; uploadEvent(c, UPLOAD_FILE_ABORTED); }
+    if (_uploader == &c) { _uploader = nullptr; }
+}
+
+// Gövdeyi başlıklardan sonraki çalışma alanında işler; tüketilen bayt atılır. Sınır iki okumaya
+// bölünebileceği için sınırdan kısa bir kuyruk bir sonraki okumaya bırakılır.
+bool HttpEngine::processMultipart(Connection& c) {
+    char* work = c.buffer + c.headLength;
+    size_t length = c.length - c.headLength;
+    size_t used = 0;
+    bool progress = true;
+    while (progress && c.part != PART_DONE) {
+        progress = false;
+        char* p = work + used;
+        size_t left = length - used;
+        if (c.part == PART_PREAMBLE) {
+            // İlk sınırın önünde CRLF yoktur
+            const char* hit = findBytes(p, left, c.boundary + 2, c.boundaryLength - 2);
+            if (hit) { used += (hit - p) + c.boundaryLength - 2; c.part = PART_DELIMITER; progress = true; }
+            else if (left >= c.boundaryLength) { used += left - (c.boundaryLength - 3); }
+        } else if (c.part == PART_DELIMITER) {
+            if (left < 2) { break; }
+            if (p[0] == '-' && p[1] == '-') { used = length; c.part = PART_DONE; }
+            else if (p[0] == '\r' && p[1] == '\n') { used += 2; c.part = PART_HEADERS; progress = true; }
+            else { return false; }
+        } else if (c.part == PART_HEADERS) {
+            const char* end = findBytes(p, left, "\r\n\r\n", 4);
+            if (!end) {
+                if (c.length >= sizeof(c.buffer) - 1 && used == 0) { return false; }
+                break;
+            }
+            beginPart(c, p, end - p);
+            used += (end - p) + 4;
+            c.part = PART_DATA;
+            progress = true;
+        } else if (c.part == PART_DATA) {
+            const char* hit = findBytes(p, left, c.boundary, c.boundaryLength);
+            if (hit) {
+                uploadData(c, (const uint8_t*)p, hit - p);
+                if (c.filePart) {
+                    if (_upload.currentSize > 0) { uploadEvent(c, UPLOAD_FILE_WRITE); }
+                    c.filePart = false;
+                    uploadEvent(c, UPLOAD_FILE_END);
+                }
+                used += (hit - p) + c.boundaryLength;
+                c.part = PART_DELIMITER;
+                progress = true;
+            } else if (left >= c.boundaryLength) {
+                size_t safe = left - (c.boundaryLength - 1);
+                uploadData(c, (const uint8_t*)p, safe);
+                used += safe;
+            }
+        }
+    }
+    memmove(work, work + used, length - used);
+    c.length -= used;
+    return true;
+}
+
+// Parça başlıklarından dosya adını ve türünü alır; dosya olmayan form alanları atlanır
+void HttpEngine::beginPart(Connection& c, char* headers, size_t length) {
+    headers[length] = '\0';
+    String name, filename, type;
+    for (char* line = headers; line && *line;) {
+        char* next = strstr(line, "\r\n");
+        if (next) { *next = '\0'; next += 2; }
+        if (strncasecmp(line, "Content-Disposition:", 20) == 0) {
+            const char* field = strstr(line, " name=\"");
+            if (field) { field += 7; name = String(field).substring(0, strcspn(field, "\"")); }
+            field = strstr(line, "filename=\"");
+            if (field) { field += 10; filename = String(field).substring(0, strcspn(field, "\"")); }
+            c.filePart = field != nullptr;
+        } else if (strncasecmp(line, "Content-Type:", 13) == 0) {
+            const char* value = line + 13;
+            while (*value == ' ') { value++; }
+            type = value;
+        }
+        line = next;
+    }
+    if (!c.filePart) { return; }
+    _upload.filename = filename;
+    _upload.name = name;
+    _upload.type = type;
+    _upload.totalSize = 0;
+    _upload.currentSize = 0;
+    uploadEvent(c, UPLOAD_FILE_START);
+}
+
+void HttpEngine::uploadData(Connection& c, const uint8_t* data, size_t length) {
+    if (!c.filePart) { return; }
+    while (length > 0) {
+        size_t take = HTTP_UPLOAD_BUFLEN - _upload.currentSize;
+        if (take > length) { take = length; }
+        memcpy(_upload.buf + _upload.currentSize, data, take);
+        _upload.currentSize += take;
+        data += take;
+        length -= take;
+        if (_upload.currentSize == HTTP_UPLOAD_BUFLEN) { uploadEvent(c, UPLOAD_FILE_WRITE); }
+    }
+}
+
+// WebServer'daki sırayla: önce genel yükleme işleyicisi, sonra rotanınki
+void HttpEngine::uploadEvent(Connection& c, HTTPUploadStatus status) {
+    _upload.status = status;
+    if (status == UPLOAD_FILE_WRITE) { _upload.totalSize += _upload.currentSize; }
+    Connection* previous = _current;
+    _current = &c;
+    if (_fileUpload) { _fileUpload(); }
+    if (c.route && c.route->uploadHandler) { c.route->uploadHandler(); }
+    _current = previous;
+    if (status == UPLOAD_FILE_WRITE) { _upload.currentSize = 0; }
+}
+
+// --- WebSocket ---
+
+void HttpEngine::upgradeWebSocket(uint8_t num) {
+    Connection& c = _connections[num];
+    // WebSerial kuyrukları istemci numarasıyla tutulur; son yuva HTTP isteklerine bırakılır
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || connectedClients() + 1 >= HTTP_ENGINE_MAX_CLIENTS) {
+        respond(c, 503, "WebSocket icin yer yok");
+        return;
+    }
+    static const char guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    char key[64 + sizeof(guid)];
+    size_t keyLength = strlen(c.wsKey);
+    if (keyLength > 64) { respond(c, 400, "Gecersiz WebSocket anahtari"); return; }
+    memcpy(key, c.wsKey, keyLength);
+    memcpy(key + keyLength, guid, sizeof(guid) - 1);
+    uint8_t digest[20];
+    mbedtls_sha1((const unsigned char*)key, keyLength + sizeof(guid) - 1, digest);
+    char accept[32];
+    base64(digest, sizeof(digest), accept);
+
+    static const char head[] = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: ";
+    write(c, head, sizeof(head) - 1);
+    write(c, accept, strlen(accept));
+    write(c, "\r\n\r\n", 4);
+    c.state = STATE_WEBSOCKET;
+    _requestsServed++;
+    if (_event) { _event(num, WStype_CONNECTED, (uint8_t*)c.uri, strlen(c.uri)); }
+    flushStage();
+    if (c.state != STATE_WEBSOCKET) { return; }
+    // El sıkışmanın hemen ardından gelmiş çerçeveler korunur
+    c.length -= c.headLength;
+    memmove(c.buffer, c.buffer + c.headLength, c.length);
+    c.headLength = 0;
+    if (c.length > 0) { processFrames(num); }
+}
+
+// İstemci çerçeveleri maskelidir; parçalı (FIN'siz) mesajlar desteklenmez
+void HttpEngine::processFrames(uint8_t num) {
+    Connection& c = _connections[num];
+    while (c.state == STATE_WEBSOCKET && !c.closing && c.length >= 2) {
+        uint8_t* data = (uint8_t*)c.buffer;
+        uint8_t opcode = data[0] & 0x0f;
+        size_t length = data[1] & 0x7f;
+        size_t header = 2;
+        if (!(data[1] & 0x80)) { closeSocket(c, 1002); return; }
+        if (length == 126) {
+            if (c.length < 4) { return; }
+            length = ((size_t)data[2] << 8) | data[3];
+            header = 4;
+        } else if (length == 127) {
+            closeSocket(c, 1009);
+            return;
+        }
+        header += 4;
+        if (header + length >= sizeof(c.buffer)) { closeSocket(c, 1009); return; }
+        if (c.length < header + length) { return; }
+        if (!(data[0] & 0x80) || opcode == 0x0) { closeSocket(c, 1003); return; }
+
+        uint8_t* payload = data + header;
+        const uint8_t* mask = payload - 4;
+        for (size_t i = 0; i < length; i++) { payload[i] ^= mask[i & 3]; }
+        size_t frameEnd = header + length;
+        uint8_t saved = data[frameEnd];
+        data[frameEnd] = '\0'; // links2004'teki gibi yük '\0' ile biter
+        if (opcode == 0x1 || opcode == 0x2) {
+            if (_event) { _event(num, opcode == 0x1 ? WStype_TEXT : WStype_BIN, payload, length); }
+        } else if (opcode == 0x8) {
+            uint16_t code = length >= 2 ? (uint16_t)((payload[0] << 8) | payload[1]) : 1000;
+            closeSocket(c, code);
+        } else if (opcode == 0x9) {
+            sendFrame(num, 0xA, payload, length);
+        }
+        if (c.state != STATE_WEBSOCKET) { return; }
+        data[frameEnd] = saved;
+        c.length -= frameEnd;
+        memmove(data, data + frameEnd, c.length);
+    }
+}
+
+// Kapatma çerçevesi gönderilir, bağlantı çıkış boşalınca kapanır
+void HttpEngine::closeSocket(Connection& c, uint16_t code) {
+    uint8_t frame[4] = {0x88, 2, (uint8_t)(code >> 8), (uint8_t)code};
+    write(c, frame, sizeof(frame));
+    flushStage();
+    c.closing = true;
+}
+
+bool HttpEngine::sendFrame(uint8_t num, uint8_t opcode, const uint8_t* payload, size_t length) {
+    if (num >= HTTP_ENGINE_MAX_CLIENTS) { return false; }
+    Connection& c = _connections[num];
+    if (c.state != STATE_WEBSOCKET || c.closing || c.failed) { return false; }
+    if (c.outLength - c.outOffset + length > HTTP_ENGINE_WS_PENDING_MAX) {
+        // İstemci okumuyor; bekleyen veri sınırsız büyümesin diye bağlantı bırakılır
+        c.failed = true;
+        return false;
+    }
+    uint8_t header[10];
+    size_t headerLength = 0;
+    header[headerLength++] = (uint8_t)(0x80 | opcode);
+    if (length < 126) {
+        header[headerLength++] = (uint8_t)length;
+    } else if (length < 65536) {
+        header[headerLength++] = 126;
+        header[headerLength++] = (uint8_t)(length >> 8);
+        header[headerLength++] = (uint8_t)length;
+    } else {
+        header[headerLength++] = 127;
+        for (int i = 7; i >= 0; i--) { header[headerLength++] = (uint8_t)((uint64_t)length >> (8 * i)); }
+    }
+    write(c, header, headerLength);
+    write(c, payload, length);
+    flushStage();
+    return !c.failed;
+}
+
+size_t HttpEngine::availableForWrite(uint8_t num) {
+    if (!clientIsConnected(num)) { return 0; }
+    const Connection& c = _connections[num];
+    size_t pending = c.outLength - c.outOffset + 10; // En uzun çerçeve başlığı
+    if (c.closing || c.failed || pending >= HTTP_ENGINE_WS_PENDING_MAX) { return 0; }
+    return HTTP_ENGINE_WS_PENDING_MAX - pending;
+}
+
+bool HttpEngine::broadcast(uint8_t opcode, const uint8_t* payload, size_t length) {
+    bool ok = true;
+    for (uint8_t num = 0; num < HTTP_ENGINE_MAX_CLIENTS; num++) {
+        if (_connections[num].state == STATE_WEBSOCKET && !sendFrame(num, opcode, payload, length)) { ok = false; }
+    }
+    return ok;
+}
+
+void HttpEngine::disconnect(uint8_t num) {
+    if (clientIsConnected(num) && !_connections[num].closing) { closeSocket(_connections[num], 1000); }
+}
+
+IPAddress HttpEngine::remoteIP(uint8_t num) {
+    return num < HTTP_ENGINE_MAX_CLIENTS && _connections[num].state != STATE_FREE ? _connections[num].client.remoteIP() : IPAddress();
+}
+
+uint8_t HttpEngine::connectedClients(bool ping) {
+    (void)ping;
+    uint8_t count = 0;
+    for (const Connection& c : _connections) { count += c.state == STATE_WEBSOCKET; }
+    return count;
+}
@@ -0,0 +1,250 @@
+// lib/ESP32Helper/HttpEngine.h
+
+#ifndef HTTPENGINE_H
+#define HTTPENGINE_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebServer.h>        // HTTPMethod, HTTPUpload, CONTENT_LENGTH_UNKNOWN
+#include <WebSocketsServer.h> // WStype_t
+#include <functional>
+#include <vector>
+
+// Aynı anda açık tutulabilecek bağlantı (HTTP + WebSocket); her biri HTTP_ENGINE_REQUEST_SIZE bayt tutar
+#ifndef HTTP_ENGINE_MAX_CLIENTS
+#define HTTP_ENGINE_MAX_CLIENTS 5
+#endif
+// İstek satırı ve başlıklar (ve form gövdesi) bu tampona sığmalıdır; WebSocket çerçeveleri de burada birleşir
+#ifndef HTTP_ENGINE_REQUEST_SIZE
+#define HTTP_ENGINE_REQUEST_SIZE 1536
+#endif
+#ifndef HTTP_ENGINE_MAX_ARGS
+#define HTTP_ENGINE_MAX_ARGS 8
+#endif
+// sendHeader() ile eklenen başlıkların toplam boyutu
+#ifndef HTTP_ENGINE_HEADER_SIZE
+#define HTTP_ENGINE_HEADER_SIZE 384
+#endif
+// Boşta bekleyen keep-alive bağlantı bu sürede kapatılır
+#ifndef HTTP_ENGINE_IDLE_TIMEOUT_MS
+#define HTTP_ENGINE_IDLE_TIMEOUT_MS 15000
+#endif
+// Yarım kalmış istek veya ilerlemeyen cevap bu sürede bırakılır
+#ifndef HTTP_ENGINE_REQUEST_TIMEOUT_MS
+#define HTTP_ENGINE_REQUEST_TIMEOUT_MS 5000
+#endif
+// WebSocket istemcisine gönderilemeyip bekleyen bayt bunu aşarsa bağlantı kesilir
+#ifndef HTTP_ENGINE_WS_PENDING_MAX
+#define HTTP_ENGINE_WS_PENDING_MAX 16384
+#endif
+// Sokete sığmayıp bağlantıda bekleyen HTTP cevabı bunu aşarsa bağlantı kesilir. Büyük gövdeler üreticiyle
+// (sendContent(TContentProducer)) gönderildiğinde bağlantı başına yalnızca bir parça bekler.
+#ifndef HTTP_ENGINE_RESPONSE_PENDING_MAX
+#define HTTP_ENGINE_RESPONSE_PENDING_MAX 8192
+#endif
+// Bir cevabın küçük parçaları (başlıklar, chunk boyutları) sokete tek yazmada gitsin diye biriktirilir
+#ifndef HTTP_ENGINE_STAGE_SIZE
+#define HTTP_ENGINE_STAGE_SIZE 1460
+#endif
+#ifndef HTTP_ENGINE_WS_PATH
+#define HTTP_ENGINE_WS_PATH "/ws"
+#endif
+
+// Tek portta, bloklamadan birden çok bağlantıya hizmet eden HTTP/1.1 sunucusu.
+// WebServer'ın kütüphanede kullanılan arayüzünü (on, arg, send, send_P, sendContent, upload...) ve
+// WebSocketsServer'ınkini (onEvent, sendTXT, broadcastBIN...) birlikte sunar; HELPER_HTTP_ENGINE=1 ile
+// iki global de bu sınıfa döner ve işleyiciler değişmeden çalışır.
+//
+// - handleClient() her bağlantıya sırayla bakar, hazır veriyi okur ve soket kabul ettiği kadar yazar;
+//   yavaş bir istemci diğerlerini bekletmez.
+// - Cevaplar Content-Length veya (HTTP/1.1'de) chunked kodlamayla gider; bağlantı keep-alive ile açık kalır.
+// - Sığmayan cevap parçası bağlantının çıkış tamponunda bekler (en çok HTTP_ENGINE_RESPONSE_PENDING_MAX);
+//   send_P() ile verilen flash verisi kopyalanmaz, üreticiye verilen gövde çıkış boşaldıkça istenir.
+// - HTTP_ENGINE_WS_PATH'e gelen yükseltme isteği bağlantıyı WebSocket'e çevirir; istemci numarası yuvadır.
+// - Çok parçalı yüklemeler akış halinde HTTP_UPLOAD_BUFLEN'lik parçalarla işleyicilere verilir (aynı anda bir tane).
+class HttpEngine {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+    typedef std::function<void(uint8_t num, WStype_t type, uint8_t* payload, size_t length)> WebSocketServerEvent;
+    // Gövdenin sıradaki parçasını chunk'a ekler; false dönerse gövde biter
+    typedef std::function<bool(String& chunk)> TContentProducer;
+
+    explicit HttpEngine(uint16_t port = 80) : _listener(port, HTTP_ENGINE_MAX_CLIENTS) {}
+    ~HttpEngine();
+
+    void begin();
+    void close();
+    void handleClient();
+    // WebSocketsServer uyumu; işin tamamı handleClient()'ta yapılır
+    void loop() {}
+
+    // --- WebServer arayüzü ---
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler) { on(uri, method, handler, nullptr); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler);
+    void onNotFound(THandlerFunction handler) { _notFound = handler; }
+    void onFileUpload(THandlerFunction handler) { _fileUpload = handler; }
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+
+    String uri() const;
+    HTTPMethod method() const;
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    int args() const;
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    HTTPUpload& upload() { return _upload; }
+    size_t clientContentLength() const;
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t length) { _contentLength = length; _lengthSet = true; }
+    void send(int code, const char* contentType = nullptr, const String& content = String(""));
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+    // Boş içerik chunked cevabı bitirir; işleyici bitirmezse motor bitirir
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t length);
+    // send() sonrası gövdenin geri kalanı: işleyici döndükten sonra, önceki parça sokete verildikçe üreticiden
+    // istenir; okumayan istemcinin cevabı RAM'de birikmez. Chunked cevap üretici bitince sonlandırılır.
+    void sendContent(TContentProducer producer);
+
+    // --- WebSocketsServer arayüzü ---
+    void onEvent(WebSocketServerEvent event) { _event = event; }
+    bool sendTXT(uint8_t num, const uint8_t* payload, size_t length = 0) { return sendFrame(num, 0x1, payload, length ? length : strlen((const char*)payload)); }
+    bool sendTXT(uint8_t num, const char* payload, size_t length = 0) { return sendTXT(num, (const uint8_t*)payload, length); }
+    bool sendTXT(uint8_t num, String& payload) { return sendFrame(num, 0x1, (const uint8_t*)payload.c_str(), payload.length()); }
+    bool sendBIN(uint8_t num, const uint8_t* payload, size_t length) { return sendFrame(num, 0x2, payload, length); }
+    bool broadcastTXT(const char* payload, size_t length = 0) { return broadcast(0x1, (const uint8_t*)payload, length ? length : strlen(payload)); }
+    bool broadcastTXT(String& payload) { return broadcast(0x1, (const uint8_t*)payload.c_str(), payload.length()); }
+    bool broadcastBIN(const uint8_t* payload, size_t length) { return broadcast(0x2, payload, length); }
+    void disconnect(uint8_t num);
+    IPAddress remoteIP(uint8_t num);
+    uint8_t connectedClients(bool ping = false);
+    bool clientIsConnected(uint8_t num) { return num < HTTP_ENGINE_MAX_CLIENTS && _connections[num].state == STATE_WEBSOCKET; }
+    // Bağlantıyı kesmeden kuyruğa eklenebilecek yük (bayt); gönderim hiç bloklamaz, sınır HTTP_ENGINE_WS_PENDING_MAX'tır
+    size_t availableForWrite(uint8_t num);
+
+    // Açık bağlantı (HTTP + WebSocket) ve toplam cevaplanan istek sayısı
+    uint8_t openConnections() const;
+    uint32_t requestsServed() const { return _requestsServed; }
+    // Bağlantıların çıkış tamponlarının aynı anda tuttuğu en yüksek bellek (bayt)
+    size_t outputPeak() const { return _outputPeak; }
+
+private:
+    enum State : uint8_t { STATE_FREE, STATE_HEAD, STATE_BODY, STATE_MULTIPART, STATE_RESPONSE, STATE_WEBSOCKET };
+    enum PartState : uint8_t { PART_PREAMBLE, PART_DELIMITER, PART_HEADERS, PART_DATA, PART_DONE };
+
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+        THandlerFunction uploadHandler;
+    };
+    struct Arg {
+        const char* name;
+        const char* value;
+    };
+    struct Connection {
+        WiFiClient client;
+        State state = STATE_FREE;
+        HTTPMethod method = HTTP_GET;
+        bool http11 = false;
+        bool keepAlive = false;
+        bool upgrade = false;
+        bool chunked = false;  // Cevap chunked gidiyor
+        bool finished = false; // Cevabın tamamı çıkışa verildi
+        bool closing = false;  // Çıkış boşalınca kapat
+        bool failed = false;   // Soket hatası; sonraki turda bırakılır
+        bool expectContinue = false;
+        bool served = false;   // En az bir cevap verildi; boşta kalırsa yeni bağlantıya yer açılabilir
+        uint32_t lastActivity = 0;
+
+        char buffer[HTTP_ENGINE_REQUEST_SIZE];
+        size_t length = 0;     // buffer'daki bayt
+        size_t headLength = 0; // İstek satırı + başlıklar
+        size_t bodyLength = 0; // Content-Length
+        size_t bodyRead = 0;
+        const char* uri = "";
+        const char* contentType = "";
+        const char* wsKey = nullptr;
+        const char* headers[4] = {nullptr}; // collectHeaders() sırasıyla
+        Arg args[HTTP_ENGINE_MAX_ARGS];
+        uint8_t argCount = 0;
+        const Route* route = nullptr;
+
+        // Soketin almadığı çıkış; yalnızca tıkanınca ayrılır
+        uint8_t* out = nullptr;
+        size_t outLength = 0;
+        size_t outOffset = 0;
+        size_t outCapacity = 0;
+        const uint8_t* staticData = nullptr; // send_P() verisinin kalanı
+        size_t staticLength = 0;
+        TContentProducer producer; // Gövdenin henüz üretilmemiş kısmı
+
+        char boundary[76]; // "\r\n--" + sınır
+        uint8_t boundaryLength = 0;
+        PartState part = PART_PREAMBLE;
+        bool filePart = false;
+    };
+
+    void accept();
+    void service(uint8_t num);
+    int readInto(Connection& c, size_t limit);
+    bool parseHead(Connection& c, size_t headLength);
+    void parseArgs(Connection& c, char* text);
+    const Route* findRoute(const Connection& c) const;
+    void startRequest(uint8_t num);
+    void beginResponse(Connection& c);
+    void endResponse(Connection& c);
+    void dispatch(Connection& c);
+    void respond(Connection& c, int code, const char* message);
+    void produce(Connection& c);
+    void writeContent(Connection& c, const char* content, size_t length);
+    void resetRequest(Connection& c);
+    void serviceUpload(uint8_t num);
+    void abortUpload(Connection& c);
+    bool processMultipart(Connection& c);
+    void beginPart(Connection& c, char* headers, size_t length);
+    void uploadData(Connection& c, const uint8_t* data, size_t length);
+    void uploadEvent(Connection& c, HTTPUploadStatus status);
+    void upgradeWebSocket(uint8_t num);
+    void processFrames(uint8_t num);
+    void closeSocket(Connection& c, uint16_t code);
+    bool sendFrame(uint8_t num, uint8_t opcode, const uint8_t* payload, size_t length);
+    bool broadcast(uint8_t opcode, const uint8_t* payload, size_t length);
+    void writeHead(int code, const char* contentType, size_t contentLength);
+    void write(Connection& c, const void* data, size_t length);
+    void flushStage();
+    void output(Connection& c, const void* data, size_t length);
+    bool flush(Connection& c);
+    void closeConnection(uint8_t num);
+
+    WiFiServer _listener;
+    Connection _connections[HTTP_ENGINE_MAX_CLIENTS];
+    Connection* _current = nullptr; // İşleyicisi çalışan istek
+    Connection* _uploader = nullptr;
+
+    std::vector<Route> _routes;
+    THandlerFunction _notFound;
+    THandlerFunction _fileUpload;
+    const char* _collect[4] = {nullptr};
+    WebSocketServerEvent _event;
+
+    // İşlenen isteğin cevabı
+    char _headers[HTTP_ENGINE_HEADER_SIZE];
+    size_t _headersLength = 0;
+    size_t _contentLength = 0;
+    bool _lengthSet = false;
+    bool _closeRequested = false;
+    bool _headSent = false;
+    HTTPUpload _upload;
+    uint32_t _requestsServed = 0;
+    size_t _outputBytes = 0; // Çıkış tamponlarına ayrılmış toplam
+    size_t _outputPeak = 0;
+
+    uint8_t _stage[HTTP_ENGINE_STAGE_SIZE];
+    size_t _stageLength = 0;
+    Connection* _staged = nullptr; // Biriktirilen verinin bağlantısı
+};
+
+#endif
@@ -0,0 +1,216 @@
+// lib/ESP32Helper/LogStore.cpp
+
+#include "LogStore.h"
+
+LogStore::~LogStore() {
+    _file.close();
+    free(_batch[0]);
+    free(_batch[1]);
+    if (_lock) { vSemaphoreDelete(_lock); }
+}
+
+bool LogStore::begin(fs::FS& fs) {
+    if (_fs) { return true; }
+    if (!_batch[0]) { _batch[0] = (uint8_t*)malloc(LOG_STORE_BATCH_SIZE); }
+    if (!_batch[1]) { _batch[1] = (uint8_t*)malloc(LOG_STORE_BATCH_SIZE); }
+    if (!_batch[0] || !_batch[1]) { return false; }
+    if (!fs.exists(LOG_STORE_DIR)) { fs.mkdir(LOG_STORE_DIR); }
+    fs::File dir = fs.open(LOG_STORE_DIR);
+    if (!dir || !dir.isDirectory()) { return false; }
+
+    // Bazı çekirdek sürümleri name() ile tam yol döner
+    uint32_t lowest = UINT32_MAX, highest = 0;
+    for (fs::File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+        const char* name = strrchr(entry.name(), '/');
+        name = name ? name + 1 : entry.name();
+        char* end = nullptr;
+        unsigned long id = strtoul(name, &end, 10);
+        if (end == name || strcmp(end, ".log") != 0 || id == 0) { continue; }
+        if (id < lowest) { lowest = id; }
+        if (id > highest) { highest = id; }
+    }
+    dir.close();
+
+    _fs = &fs;
+    if (highest == 0) {
+        _first = 1;
+        _last = 1;
+    } else {
+        _first = lowest;
+        _last = highest;
+        while (_last - _first + 1 > LOG_STORE_SEGMENTS) {
+            char path[32];
+            segmentPath(_first++, path, sizeof(path));
+            _fs->remove(path);
+        }
+    }
+    if (!_lock) { _lock = xSemaphoreCreateMutex(); }
+    if (!openLast()) { _fs = nullptr; return false; }
+    if (_fileSize >= LOG_STORE_SEGMENT_SIZE) { rotate(); }
+    static const char marker[] = "--- acilis ---\n";
+    append((const uint8_t*)marker, sizeof(marker) - 1, false);
+    return true;
+}
+
+void LogStore::segmentPath(uint32_t id, char* out, size_t size) const {
+    snprintf(out, size, LOG_STORE_DIR "/%lu.log", (unsigned long)id);
+}
+
+bool LogStore::openLast() {
+    char path[32];
+    segmentPath(_last, path, sizeof(path));
+    _file = _fs->open(path, FILE_APPEND);
+    _fileSize = _file ? _file.size() : 0;
+    _unsynced = false;
+    return (bool)_file;
+}
+
+// Yeni segment açılır, sınırı aşan en eski segment silinir (her biri bir metadata commit'i)
+void LogStore::rotate() {
+    sync();
+    _file.close();
+    _last++;
+    char path[32];
+    segmentPath(_last, path, sizeof(path));
+    _file = _fs->open(path, FILE_WRITE);
+    _fileSize = 0;
+    _unsynced = false;
+    if (!_file) { _stats.writeErrors++; }
+    commitMeta();
+    while (_last - _first + 1 > LOG_STORE_SEGMENTS) {
+        segmentPath(_first++, path, sizeof(path));
+        _fs->remove(path);
+        commitMeta();
+    }
+    _stats.rotations++;
+}
+
+// Etkin tampon dolunca yazılmak üzere ayrılır ve diğerine geçilir; ikisi de doluysa satır bütünüyle
+// atılır (dosyada yarım satır kalmaz)
+void LogStore::append(const uint8_t* data, size_t length, bool urgent) {
+    if (!_fs || length == 0) { return; }
+    lock();
+    _stats.bytesLogged += length;
+    if (length > LOG_STORE_BATCH_SIZE - _fill && !_ready && _fill > 0) { seal(); }
+    if (length > LOG_STORE_BATCH_SIZE - _fill) {
+        _stats.bytesDropped += length;
+    } else {
+        if (!_dirty) { _dirty = true; _dirtySince = millis(); }
+        memcpy(_batch[_active] + _fill, data, length);
+        _fill += length;
+        if (urgent) { _urgent = true; }
+    }
+    unlock();
+}
+
+// Çağıran kilidi tutar; ayrılan tamponun yazılması bitene kadar yenisi ayrılmaz
+void LogStore::seal() {
+    _ready = true;
+    _readyLength = _fill;
+    _active ^= 1;
+    _fill = 0;
+}
+
+// Dolan tampon senkronsuz eklenir; acil satır ya da LOG_STORE_FLUSH_MS'den eski veri varsa her şey
+// yazılıp senkronlanır
+void LogStore::loop() {
+    if (!_fs) { return; }
+    lock();
+    bool due = _dirty && (_urgent || millis() - _dirtySince >= LOG_STORE_FLUSH_MS);
+    bool ready = _ready;
+    unlock();
+    if (due) { flush(); }
+    else if (ready) { writeReady(); }
+}
+
+void LogStore::flush() {
+    if (!_fs) { return; }
+    lock();
+    bool ready = _ready;
+    unlock();
+    if (ready) { writeReady(); }
+    lock();
+    if (_fill > 0) { seal(); }
+    ready = _ready;
+    _urgent = false;
+    unlock();
+    if (ready) { writeReady(); }
+    sync();
+}
+
+// Yazma kilit dışındadır; bu sırada append() etkin tampona devam eder
+void LogStore::writeReady() {
+    write(_batch[_active ^ 1], _readyLength);
+    lock();
+    _ready = false;
+    unlock();
+}
+
+// Yalnızca loop()/flush() çağıran görevden. Toplu yazma bölünmeden segmente gider, segment dolunca
+// yenisine geçilir
+void LogStore::write(const uint8_t* data, size_t length) {
+    if (!_file && !openLast()) { _stats.writeErrors++; return; }
+    size_t written = _file.write(data, length);
+    if (written != length) { _stats.writeErrors++; }
+    if (written == 0) { return; }
+
+    // Aşınma modeli: senkrondan sonraki ilk yazma yarım son bloğu veriyle birlikte yeni (silinmiş) bir
+    // bloğa programlar; senkronsuz devam eden yazma açık bloğa eklenir
+    size_t offset = _fileSize % LOG_STORE_BLOCK_SIZE;
+    bool copy = !_unsynced && offset > 0;
+    size_t blocks = (offset + written + LOG_STORE_BLOCK_SIZE - 1) / LOG_STORE_BLOCK_SIZE;
+    if (!copy && offset > 0) { blocks--; }
+    _stats.flashBytes += written + (copy ? offset : 0);
+    _stats.blockErases += blocks;
+    _unsynced = true;
+
+    _fileSize += written;
+    _stats.bytesWritten += written;
+    if (_fileSize >= LOG_STORE_SEGMENT_SIZE) { rotate(); }
+}
+
+// Dosyayı senkronlar: son yarım program birimi doldurularak yazılır ve metadata'ya commit eklenir
+void LogStore::sync() {
+    if (_unsynced) {
+        _file.flush();
+        _unsynced = false;
+        size_t tail = _fileSize % LOG_STORE_PROG_SIZE;
+        if (tail > 0) { _stats.flashBytes += LOG_STORE_PROG_SIZE - tail; }
+        commitMeta();
+        _stats.syncs++;
+    }
+    lock();
+    _dirty = _fill > 0 || _ready;
+    _dirtySince = millis();
+    unlock();
+}
+
+// Metadata çiftine bir commit; blok dolunca çiftin diğer bloğu silinip sıkıştırılır
+void LogStore::commitMeta() {
+    _stats.flashBytes += LOG_STORE_PROG_SIZE;
+    if (++_metaCommits * LOG_STORE_PROG_SIZE >= LOG_STORE_BLOCK_SIZE) {
+        _metaCommits = 0;
+        _stats.blockErases++;
+    }
+}
+
+fs::File LogStore::openSegment(uint32_t id) {
+    if (!_fs || id < _first || id > _last) { return fs::File(); }
+    char path[32];
+    segmentPath(id, path, sizeof(path));
+    return _fs->open(path, FILE_READ);
+}
+
+size_t LogStore::pending() const {
+    lock();
+    size_t pending = _fill + (_ready ? _readyLength : 0);
+    unlock();
+    return pending;
+}
+
+float LogStore::lifetimeYears(size_t partitionBytes, uint32_t elapsedMs) const {
+    if (_stats.blockErases == 0 || elapsedMs == 0) { return 0; }
+    double budget = (double)(partitionBytes / LOG_STORE_BLOCK_SIZE) * LOG_STORE_ERASE_CYCLES;
+    double perYear = (double)_stats.blockErases / elapsedMs * (365.0 * 24 * 3600 * 1000);
+    return (float)(budget / perYear);
+}
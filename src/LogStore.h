@@ -0,0 +1,120 @@
+// lib/ESP32Helper/LogStore.h
+
+#ifndef LOGSTORE_H
+#define LOGSTORE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Segment dosyalarının bulunduğu dizin; dosyalar <sıra>.log adını taşır
+#ifndef LOG_STORE_DIR
+#define LOG_STORE_DIR "/logs"
+#endif
+// Segment bu boyutu geçince yenisine geçilir (satırlar bölünmez, en fazla bir toplu yazma kadar aşabilir)
+#ifndef LOG_STORE_SEGMENT_SIZE
+#define LOG_STORE_SEGMENT_SIZE 16384
+#endif
+// Saklanan segment sayısı; yenisi açılınca en eskisi silinir
+#ifndef LOG_STORE_SEGMENTS
+#define LOG_STORE_SEGMENTS 8
+#endif
+// RAM'de biriktirme tamponu (iki tane ayrılır: biri yazılırken diğeri dolar)
+#ifndef LOG_STORE_BATCH_SIZE
+#define LOG_STORE_BATCH_SIZE 2048
+#endif
+// Dolan tampon senkronsuz yazılır; bu süreden eski veri ise yazılıp senkronlanır (kalıcı olur)
+#ifndef LOG_STORE_FLUSH_MS
+#define LOG_STORE_FLUSH_MS 30000
+#endif
+
+// Aşınma tahmini için LittleFS geometrisi (esp_littlefs varsayılanları) ve NOR flash dayanımı
+#ifndef LOG_STORE_BLOCK_SIZE
+#define LOG_STORE_BLOCK_SIZE 4096
+#endif
+#ifndef LOG_STORE_PROG_SIZE
+#define LOG_STORE_PROG_SIZE 128
+#endif
+#ifndef LOG_STORE_ERASE_CYCLES
+#define LOG_STORE_ERASE_CYCLES 100000
+#endif
+
+struct LogStoreStats {
+    uint32_t bytesLogged = 0;   // append() ile kabul edilen
+    uint32_t bytesDropped = 0;  // Tampon dolu olduğu için atılan
+    uint32_t bytesWritten = 0;  // Dosyalara yazılan
+    uint32_t syncs = 0;         // Dosya senkronları (her biri bir LittleFS metadata commit'i)
+    uint32_t rotations = 0;
+    uint32_t writeErrors = 0;
+    // Tahmini fiziksel etki: senkrondan sonraki ilk yazma dosyanın yarım son bloğunu yeni bir bloğa
+    // kopyalar; senkronsuz ardışık yazmalar bloğa eklenir
+    uint32_t flashBytes = 0;
+    uint32_t blockErases = 0;
+};
+
+// Logları LittleFS'te sabit boyutlu, dönen segment dosyalarına yazar.
+// append() her görevden çağrılabilir ve yalnızca RAM tamponuna kopyalar; dosyaya yazma loop() içinde yapılır.
+// İki tampon vardır: dolan tampon yazılırken gelen satırlar diğerinde birikir.
+// LittleFS'te her senkron, sonraki yazmada yarım bloğun kopyalanması demektir; bu yüzden dolan tamponlar
+// senkronsuz eklenir, senkron yalnızca veri LOG_STORE_FLUSH_MS'den eskiyse, acil satırda, segment
+// değişiminde ve flush()'ta yapılır.
+class LogStore {
+public:
+    ~LogStore();
+
+    // Dosya sistemi bağlanmış olmalıdır; mevcut segmentleri bulur ve sonuncusuna eklemeye devam eder
+    bool begin(fs::FS& fs);
+    bool isRunning() const { return _fs != nullptr; }
+
+    // urgent: sonraki loop()'ta beklemeden yazılır ve senkronlanır
+    void append(const uint8_t* data, size_t length, bool urgent);
+    void loop();
+    // Bekleyen her şeyi yazar ve senkronlar (yeniden başlatma öncesi)
+    void flush();
+
+    // Saklanan segmentler first()..last() aralığındadır; sonuncusuna yazılır
+    uint32_t first() const { return _first; }
+    uint32_t last() const { return _last; }
+    fs::File openSegment(uint32_t id);
+    // Henüz dosyaya yazılmamış bayt
+    size_t pending() const;
+
+    const LogStoreStats& stats() const { return _stats; }
+    // Yazılan başına fiziksel yazma (1.0 ideal)
+    float writeAmplification() const { return _stats.bytesWritten ? (float)_stats.flashBytes / _stats.bytesWritten : 0; }
+    // Ölçülen silme hızıyla, aşınma dengelemesi bölüme yayarsa bölümün dayanacağı yıl
+    float lifetimeYears(size_t partitionBytes, uint32_t elapsedMs) const;
+
+private:
+    void segmentPath(uint32_t id, char* out, size_t size) const;
+    bool openLast();
+    void rotate();
+    void seal();
+    void writeReady();
+    void write(const uint8_t* data, size_t length);
+    void sync();
+    void commitMeta();
+    void lock() const { if (_lock) { xSemaphoreTake(_lock, portMAX_DELAY); } }
+    void unlock() const { if (_lock) { xSemaphoreGive(_lock); } }
+
+    fs::FS* _fs = nullptr;
+    fs::File _file;
+    size_t _fileSize = 0;
+    bool _unsynced = false; // Son senkrondan sonra yazıldı (sonraki yazma blok kopyalamaz)
+    uint32_t _first = 1;
+    uint32_t _last = 0;
+    uint32_t _metaCommits = 0;
+    SemaphoreHandle_t _lock = nullptr;
+
+    // append() etkin tampona yazar; _ready iken diğer tampon (_readyLength bayt) dosyaya yazılmayı bekler
+    uint8_t* _batch[2] = {nullptr, nullptr};
+    size_t _fill = 0;
+    uint8_t _active = 0;
+    bool _ready = false;
+    size_t _readyLength = 0;
+    bool _dirty = false; // Kalıcı olmayan veri var; en eskisi _dirtySince zamanında geldi
+    unsigned long _dirtySince = 0;
+    bool _urgent = false;
+    LogStoreStats _stats;
+};
+
+#endif
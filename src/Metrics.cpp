@@ -0,0 +1,37 @@
+// lib/ESP32Helper/Metrics.cpp
+
+#include "Metrics.h"
+
+void appendMetricHeader(String& out, const char* name, const char* type, const char* help) {
+    out += "# HELP "; out += name; out += ' '; out += help;
+    out += "\n# TYPE "; out += name; out += ' '; out += type; out += '\n';
+}
+
+void appendMetric(String& out, const char* name, const char* labels, double value) {
+    char line[160];
+    int len = snprintf(line, sizeof(line), "%s%s%s%s %.10g\n", name, labels[0] ? "{" : "", labels, labels[0] ? "}" : "", value);
+    if (len > 0 && (size_t)len < sizeof(line)) { out += line; }
+}
+
+// Kovalar saklanırken ayrıktır, Prometheus'un beklediği birikimli değerlere burada çevrilir
+void CycleHistogram::appendTo(String& out, const char* name, const char* labels, uint32_t cpuMHz) const {
+    double cyclesPerSecond = (double)cpuMHz * 1e6;
+    char line[192];
+    uint32_t cumulative = 0;
+    for (uint32_t i = 0; i <= METRICS_HISTOGRAM_BUCKETS; i++) {
+        cumulative += _buckets[i];
+        int len;
+        if (i < METRICS_HISTOGRAM_BUCKETS) {
+            double bound = (double)(1ull << (METRICS_HISTOGRAM_MIN_SHIFT + i)) / cyclesPerSecond;
+            len = snprintf(line, sizeof(line), "%s_bucket{%s%sle=\"%.3g\"} %u\n", name, labels, labels[0] ? "," : "", bound, (unsigned)cumulative);
+        } else {
+            len = snprintf(line, sizeof(line), "%s_bucket{%s%sle=\"+Inf\"} %u\n", name, labels, labels[0] ? "," : "", (unsigned)cumulative);
+        }
+        if (len > 0 && (size_t)len < sizeof(line)) { out += line; }
+    }
+    char suffixed[96];
+    snprintf(suffixed, sizeof(suffixed), "%s_sum", name);
+    appendMetric(out, suffixed, labels, (double)_sum / cyclesPerSecond);
+    snprintf(suffixed, sizeof(suffixed), "%s_count", name);
+    appendMetric(out, suffixed, labels, _count);
+}
@@ -0,0 +1,47 @@
+// lib/ESP32Helper/Metrics.h
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// Histogram kovaları ikinin kuvveti CPU çevrimleridir: ilk sınır 2^METRICS_HISTOGRAM_MIN_SHIFT çevrim
+// (240 MHz'de ~34 µs), her kova bir öncekinin iki katı; son kovadan büyükler +Inf'e düşer
+#ifndef METRICS_HISTOGRAM_BUCKETS
+#define METRICS_HISTOGRAM_BUCKETS 16
+#endif
+#ifndef METRICS_HISTOGRAM_MIN_SHIFT
+#define METRICS_HISTOGRAM_MIN_SHIFT 13
+#endif
+// Süresi ölçülen en fazla HTTP yolu (fazlası ölçülmeden kaydedilir)
+#ifndef METRICS_MAX_ROUTES
+#define METRICS_MAX_ROUTES 12
+#endif
+
+// Gecikme histogramı; observe() bir clz ve üç toplamadan ibarettir, bölme ya da zaman dönüşümü yapmaz.
+// Tek yazar içindir; okuma (render) başka görevden yapılırsa değerler birkaç gözlem geride olabilir.
+class CycleHistogram {
+public:
+    void observe(uint32_t cycles) {
+        uint32_t index = cycles <= (1u << METRICS_HISTOGRAM_MIN_SHIFT) ? 0 : (32 - __builtin_clz(cycles - 1)) - METRICS_HISTOGRAM_MIN_SHIFT;
+        if (index > METRICS_HISTOGRAM_BUCKETS) { index = METRICS_HISTOGRAM_BUCKETS; }
+        _buckets[index]++;
+        _count++;
+        _sum += cycles;
+    }
+
+    uint32_t count() const { return _count; }
+    // name_bucket/_sum/_count satırlarını saniye cinsinden ekler; labels boş ya da `route="/panel"` biçimindedir
+    void appendTo(String& out, const char* name, const char* labels, uint32_t cpuMHz) const;
+
+private:
+    uint32_t _buckets[METRICS_HISTOGRAM_BUCKETS + 1] = {0};
+    uint32_t _count = 0;
+    uint64_t _sum = 0;
+};
+
+// Prometheus metin biçimi (0.0.4) yardımcıları
+void appendMetricHeader(String& out, const char* name, const char* type, const char* help);
+void appendMetric(String& out, const char* name, const char* labels, double value);
+
+#endif
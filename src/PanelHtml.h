@@ -0,0 +1,401 @@
+// lib/ESP32Helper/PanelHtml.h
+// Bu dosya tools/embed_html.py tarafindan uretilmistir, elle duzenlemeyin.
+
+#ifndef PANELHTML_H
+#define PANELHTML_H
+
+#include <Arduino.h>
+
+// html/panel.html: 19299 bayt -> gzip 6102 bayt
+static const char PANEL_HTML_ETAG[] = "\"59574e2bd5d2ea68\"";
+static const uint8_t PANEL_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0xdb, 0x76, 0xdb, 0xb6, 0xb2, 0xef, 0xfd, 0x0a,
+    0x54, 0xc9, 0x8e, 0xc8, 0x46, 0x77, 0xc7, 0x4e, 0x22, 0x59, 0xee, 0xca, 0xb5, 0xc9, 0x69, 0x6e, 0xab, 0x76, 0x77, 0x4f,
+    0x57, 0x96, 0x4f, 0x03, 0x91, 0x90, 0x84, 0x9a, 0x22, 0xb5, 0x49, 0xc8, 0xb2, 0xe2, 0xfa, 0x57, 0x4e, 0x1f, 0xfb, 0x9c,
+    0x97, 0x3e, 0xe5, 0xcd, 0xe9, 0x7f, 0x9d, 0x19, 0x5c, 0x48, 0x80, 0xa4, 0xec, 0xa4, 0x5d, 0xeb, 0xe4, 0x62, 0x91, 0xc4,
+    0x60, 0x30, 0x98, 0xfb, 0x0c, 0x28, 0xef, 0x7f, 0xfd, 0xf8, 0xf5, 0xa3, 0xa3, 0x9f, 0xdf, 0x3c, 0x21, 0x73, 0xb1, 0x88,
+    0x0e, 0xf6, 0xf1, 0x27, 0x89, 0x68, 0x3c, 0x1b, 0x37, 0x44, 0xda, 0x80, 0x7b, 0x46, 0xc3, 0x83, 0x7d, 0xc1, 0x45, 0xc4,
+    0x0e, 0x9e, 0x1c, 0xbe, 0xd9, 0x19, 0x90, 0x9f, 0x93, 0x98, 0x09, 0xbe, 0x20, 0x6f, 0x68, 0xcc, 0x22, 0xbe, 0xdf, 0x55,
+    0x63, 0xfb, 0x0b, 0x26, 0x28, 0x89, 0xe9, 0x82, 0x8d, 0x1b, 0xa7, 0x9c, 0xad, 0x97, 0x49, 0x2a, 0x1a, 0x24, 0x48, 0x62,
+    0xc1, 0x62, 0x31, 0x6e, 0xac, 0x79, 0x28, 0xe6, 0xe3, 0x90, 0x9d, 0xf2, 0x80, 0xb5, 0xe5, 0x4d, 0x8b, 0xf0, 0x98, 0x0b,
+    0x4e, 0xa3, 0x76, 0x16, 0xd0, 0x88, 0x8d, 0xfb, 0x0d, 0x8d, 0x23, 0x98, 0xd3, 0x34, 0x63, 0x30, 0xe7, 0xc7, 0xa3, 0xa7,
+    0xed, 0x7b, 0x8d, 0x83, 0xaf, 0xf6, 0x33, 0xb1, 0x81, 0x15, 0xbe, 0x22, 0xf0, 0x67, 0x98, 0x26, 0x89, 0x20, 0xe7, 0xa4,
+    0xdd, 0x8e, 0xe9, 0x69, 0x7b, 0xce, 0xf8, 0x6c, 0x2e, 0x86, 0x64, 0xb7, 0xb7, 0x3c, 0x1b, 0xc1, 0xb3, 0x19, 0x5d, 0x0e,
+    0xc9, 0x40, 0xdf, 0x2c, 0x53, 0xbe, 0xa0, 0xe9, 0xa6, 0x1d, 0x24, 0x51, 0x92, 0x0e, 0xc9, 0x8d, 0x5e, 0xef, 0xee, 0x64,
+    0x3a, 0xc5, 0x91, 0x08, 0x67, 0xb5, 0x67, 0x29, 0xdd, 0xc0, 0xe3, 0x69, 0x6f, 0x3a, 0x98, 0xee, 0x8e, 0xc8, 0x85, 0xc4,
+    0x2f, 0xb7, 0x7f, 0x4e, 0x0c, 0xe2, 0x7e, 0xaf, 0xf7, 0x2f, 0x33, 0x34, 0x49, 0xc2, 0x0d, 0x0c, 0x4d, 0x61, 0x4b, 0xed,
+    0x29, 0x5d, 0xf0, 0x08, 0x66, 0xb7, 0xe9, 0x72, 0x19, 0xb1, 0x76, 0xb6, 0xc9, 0x04, 0x5b, 0xb4, 0xc8, 0xc3, 0x88, 0xc7,
+    0x27, 0x2f, 0x69, 0x70, 0x28, 0xef, 0x9f, 0x02, 0x64, 0x8b, 0x34, 0x0e, 0xd9, 0x2c, 0x61, 0xe4, 0xc7, 0xe7, 0x8d, 0x16,
+    0xf9, 0x21, 0x99, 0x24, 0x22, 0x81, 0x67, 0xcf, 0x58, 0x74, 0x0a, 0x4c, 0x0c, 0x28, 0x79, 0xc5, 0x56, 0x0c, 0x46, 0x1e,
+    0xa4, 0xc0, 0x89, 0x16, 0xc9, 0x68, 0x9c, 0xb5, 0x33, 0x96, 0x72, 0xa0, 0x73, 0x42, 0x83, 0x93, 0x59, 0x9a, 0xac, 0xe2,
+    0x70, 0x48, 0x4e, 0x69, 0xea, 0xd9, 0x74, 0xfb, 0x23, 0x02, 0x7b, 0x9b, 0xf1, 0x78, 0x48, 0x7a, 0x23, 0x62, 0x76, 0xb8,
+    0xb3, 0xb3, 0x33, 0x2a, 0x91, 0x1e, 0xf2, 0x6c, 0x19, 0xe1, 0x3e, 0xa7, 0x11, 0x03, 0xae, 0xe0, 0xcf, 0x76, 0xc8, 0x53,
+    0x16, 0x08, 0x9e, 0xc0, 0x64, 0x98, 0xb9, 0x5a, 0xc4, 0x66, 0x87, 0x9d, 0x80, 0xa6, 0x21, 0x6c, 0xd1, 0x5e, 0xf9, 0xc6,
+    0x14, 0x79, 0x36, 0x49, 0xd2, 0x90, 0xa5, 0xed, 0x94, 0x86, 0x7c, 0x95, 0x0d, 0xc9, 0x3d, 0xe4, 0xf0, 0x24, 0x39, 0x6b,
+    0x67, 0x73, 0x1a, 0x26, 0x6b, 0x20, 0x82, 0x0c, 0x96, 0x67, 0x64, 0x17, 0xfe, 0xa7, 0xb3, 0x09, 0xf5, 0x7a, 0x2d, 0xf9,
+    0xb7, 0xd3, 0xbb, 0x07, 0x84, 0x2e, 0x69, 0x18, 0xf2, 0x78, 0x66, 0x36, 0x01, 0x32, 0xca, 0xa9, 0x6f, 0x03, 0x3b, 0x44,
+    0xb2, 0x70, 0x87, 0xb4, 0x20, 0x06, 0x40, 0x88, 0xb3, 0x31, 0x4d, 0x83, 0x99, 0x82, 0x0b, 0x66, 0x49, 0xc4, 0x43, 0x72,
+    0x83, 0x31, 0x96, 0x2f, 0x93, 0x8f, 0xf7, 0xa5, 0x1a, 0xe8, 0x75, 0x44, 0xb2, 0x94, 0x9c, 0x92, 0xc2, 0xcb, 0xf8, 0x7b,
+    0x06, 0xe3, 0x9d, 0xc1, 0x2e, 0x5b, 0x98, 0xe5, 0x22, 0x3a, 0x61, 0x28, 0xf8, 0x9c, 0x5f, 0x93, 0x28, 0x09, 0x4e, 0x2a,
+    0x74, 0xee, 0x22, 0x4e, 0x89, 0x64, 0x9d, 0xab, 0x9e, 0x25, 0x80, 0xdd, 0xdd, 0x5c, 0x91, 0x78, 0xbc, 0x5c, 0x89, 0xb7,
+    0x62, 0xb3, 0x64, 0x63, 0xc1, 0xce, 0xc4, 0x71, 0xcb, 0x7a, 0xb0, 0xa4, 0x59, 0xb6, 0x86, 0xdd, 0x38, 0x0f, 0x57, 0x69,
+    0x74, 0x7c, 0x2e, 0x2d, 0x63, 0x28, 0x45, 0x67, 0xd8, 0x26, 0xf7, 0xe1, 0x92, 0xd1, 0x47, 0x32, 0x14, 0x3b, 0x86, 0xfd,
+    0x82, 0x0d, 0x41, 0x10, 0x8c, 0x5c, 0x41, 0xdd, 0x91, 0x70, 0x67, 0xb8, 0x63, 0x29, 0x81, 0x9c, 0x85, 0x67, 0xa3, 0x0a,
+    0x95, 0xd9, 0x6a, 0xb2, 0xe0, 0x40, 0x27, 0xe9, 0x4c, 0x44, 0xec, 0x2a, 0x81, 0x92, 0x8e, 0x63, 0x4f, 0xfe, 0x48, 0xed,
+    0x59, 0xaa, 0x87, 0x26, 0x25, 0x06, 0xc7, 0x50, 0x90, 0x8d, 0xf2, 0xe9, 0xdf, 0xcb, 0x09, 0x35, 0x24, 0x21, 0xe9, 0xc1,
+    0x2a, 0xcd, 0x60, 0xee, 0x32, 0xe1, 0xe0, 0x1d, 0xd2, 0x51, 0x21, 0x94, 0xfe, 0x1e, 0x8c, 0x22, 0xbb, 0xda, 0x21, 0x0b,
+    0x92, 0x94, 0x4a, 0x25, 0x95, 0x68, 0x8d, 0x5c, 0x78, 0x0c, 0x26, 0xc6, 0xda, 0x4a, 0x3a, 0x16, 0xb7, 0xac, 0x5d, 0x5a,
+    0x9b, 0x2c, 0xb1, 0xad, 0x67, 0xb0, 0x53, 0xb0, 0xa4, 0x78, 0x18, 0x30, 0xb9, 0xbc, 0x48, 0xc1, 0xe8, 0xb8, 0xb2, 0x87,
+    0x62, 0xd3, 0x6a, 0x9b, 0xa4, 0xd7, 0x19, 0x64, 0x84, 0xd1, 0x8c, 0x69, 0x86, 0x21, 0x73, 0xc0, 0x40, 0xc1, 0xaf, 0x85,
+    0xc0, 0x8b, 0xb2, 0xad, 0xec, 0x05, 0x77, 0x77, 0xef, 0x86, 0x35, 0x2a, 0xa0, 0x99, 0x3b, 0x9c, 0x27, 0xa7, 0x2c, 0x55,
+    0x2c, 0x56, 0xd7, 0x0e, 0x06, 0xcb, 0x55, 0xed, 0xee, 0x4d, 0x76, 0x72, 0xb3, 0x04, 0x57, 0x37, 0xa1, 0x69, 0xe1, 0x96,
+    0x94, 0x3c, 0x0a, 0x07, 0xe8, 0x8f, 0x2c, 0x2a, 0xb4, 0x44, 0x72, 0xdb, 0xdc, 0x62, 0x9a, 0x7d, 0x3f, 0xe7, 0xa9, 0x74,
+    0x0d, 0x92, 0x25, 0x6d, 0x0e, 0x6e, 0x2b, 0x33, 0x8c, 0xf9, 0x75, 0x95, 0x09, 0x3e, 0x45, 0x81, 0x4b, 0x27, 0x3e, 0xcc,
+    0x96, 0x14, 0x9c, 0xf7, 0x84, 0x89, 0x35, 0x63, 0x71, 0x2e, 0xe8, 0x9e, 0x6d, 0xbc, 0xef, 0xdb, 0x3c, 0x0e, 0xd9, 0x19,
+    0xca, 0xa4, 0xa7, 0xbd, 0x4d, 0x36, 0x4f, 0xc1, 0x29, 0x4a, 0xeb, 0x2b, 0xb6, 0xd3, 0x9e, 0x00, 0xd3, 0x43, 0xe3, 0x4d,
+    0x8d, 0x2d, 0x4d, 0x92, 0x28, 0x2c, 0xdb, 0x68, 0x61, 0xa2, 0x72, 0x1e, 0x95, 0x8e, 0x2b, 0x33, 0x4a, 0xaa, 0x05, 0x1c,
+    0xb1, 0xa9, 0x30, 0x16, 0xaf, 0x94, 0x82, 0xd0, 0x95, 0x48, 0x9c, 0x99, 0x99, 0xa0, 0x62, 0x95, 0x59, 0x26, 0xbe, 0x6d,
+    0xdb, 0xc5, 0xfa, 0xbd, 0xce, 0x7d, 0x58, 0x5e, 0x2b, 0x3a, 0xda, 0xb6, 0x46, 0xa7, 0x50, 0xe1, 0x56, 0xc1, 0x83, 0x8b,
+    0x24, 0xb5, 0x90, 0xd6, 0xea, 0x27, 0x90, 0xa5, 0x25, 0x27, 0xaf, 0x4b, 0x06, 0x01, 0xda, 0xab, 0xb7, 0x91, 0x4a, 0x18,
+    0xb4, 0x99, 0x2d, 0x0b, 0x75, 0x40, 0x14, 0x31, 0xf8, 0x6e, 0x16, 0xd6, 0xe9, 0xcd, 0x8d, 0xc1, 0x3d, 0x7a, 0xf7, 0x4e,
+    0xee, 0x81, 0xaa, 0xb3, 0x81, 0xc8, 0xab, 0x11, 0x84, 0xc1, 0xce, 0xae, 0x85, 0x00, 0xd9, 0xb6, 0x4c, 0x93, 0x59, 0xca,
+    0xb2, 0xac, 0xc2, 0xec, 0xc1, 0x95, 0xae, 0xb0, 0xd6, 0x65, 0x18, 0xbc, 0x0b, 0x0a, 0x68, 0x50, 0xab, 0xe0, 0x93, 0xd9,
+    0xdc, 0xd3, 0x51, 0xaa, 0x36, 0x62, 0xc8, 0xd8, 0x6e, 0x3f, 0xb0, 0x45, 0x47, 0x32, 0x91, 0x32, 0x11, 0xcc, 0xb5, 0xce,
+    0xc1, 0xae, 0x20, 0x28, 0xf5, 0x47, 0x04, 0x4d, 0x6c, 0x1a, 0xe1, 0xcd, 0x9c, 0x87, 0x21, 0x2b, 0x22, 0x1d, 0x6e, 0xa2,
+    0xad, 0xa2, 0x1f, 0x6a, 0x21, 0x4c, 0x92, 0xf0, 0x0b, 0x7a, 0xd6, 0xd6, 0x0a, 0xb4, 0xd3, 0x93, 0xea, 0xa4, 0xe1, 0xa5,
+    0x68, 0xca, 0x13, 0x06, 0x9f, 0x1d, 0x5f, 0x17, 0xb0, 0x61, 0x13, 0x98, 0x0b, 0x43, 0x88, 0x92, 0x59, 0x5b, 0x87, 0x5c,
+    0x97, 0xec, 0x7f, 0x82, 0xf5, 0x06, 0x60, 0x75, 0x10, 0xf6, 0x9d, 0x54, 0xe2, 0xc6, 0x60, 0x30, 0x30, 0x52, 0xba, 0xd1,
+    0x9b, 0x9a, 0x98, 0xa8, 0x13, 0x9a, 0x45, 0x12, 0x27, 0xd2, 0xcc, 0x0b, 0xd6, 0xb5, 0x37, 0x43, 0x65, 0x4b, 0xd5, 0xd0,
+    0xe2, 0x84, 0xa8, 0x7a, 0x0f, 0xbc, 0x9e, 0x83, 0x80, 0xda, 0x12, 0xe5, 0x70, 0x99, 0x42, 0xea, 0x97, 0xd2, 0xe5, 0xc8,
+    0xda, 0xbe, 0xf4, 0x91, 0x6d, 0x9a, 0x32, 0x5a, 0x55, 0x03, 0x29, 0xf1, 0x6a, 0x18, 0xef, 0xab, 0x20, 0x5c, 0xef, 0x5b,
+    0x4a, 0x38, 0xe5, 0x65, 0x85, 0xbd, 0xa5, 0xa0, 0xbe, 0x75, 0xb6, 0x76, 0x32, 0x8e, 0x47, 0xd9, 0x3a, 0x77, 0x91, 0x84,
+    0xd4, 0xce, 0x20, 0x54, 0x34, 0x4c, 0x74, 0x64, 0x99, 0xf2, 0x33, 0x16, 0xe6, 0xee, 0x71, 0x80, 0xee, 0x51, 0xda, 0x51,
+    0x6f, 0x84, 0x7b, 0xea, 0xd9, 0xa1, 0x2c, 0x77, 0x15, 0x70, 0x9d, 0xeb, 0xaf, 0x5c, 0xbc, 0x62, 0xb0, 0x8e, 0x47, 0xdf,
+    0xf5, 0x2b, 0x1e, 0x5b, 0x7b, 0xb4, 0x1a, 0x27, 0x67, 0x13, 0x6d, 0xc0, 0x6b, 0x5d, 0xc2, 0x94, 0xe1, 0xdf, 0xc2, 0xdb,
+    0x3b, 0xc1, 0x5e, 0x51, 0x7d, 0x5f, 0x7a, 0x30, 0x63, 0x38, 0x77, 0x7b, 0x55, 0x1f, 0x87, 0x2e, 0x2d, 0x67, 0x45, 0xca,
+    0x22, 0x08, 0xec, 0xa7, 0x6c, 0xe4, 0x26, 0x90, 0x18, 0xa1, 0xfa, 0x95, 0x30, 0xb5, 0xe3, 0x5b, 0x46, 0xac, 0x6d, 0xd8,
+    0xa1, 0x1d, 0xeb, 0x13, 0xe9, 0x43, 0x6a, 0x9d, 0x46, 0x29, 0x67, 0xb4, 0x92, 0x25, 0xb6, 0x8b, 0x7f, 0x2b, 0xa6, 0x56,
+    0xe6, 0x20, 0x71, 0x83, 0x9e, 0xeb, 0x74, 0x34, 0x2f, 0x1d, 0x0d, 0x68, 0xcb, 0x72, 0x08, 0x75, 0x6d, 0xb5, 0xac, 0xaa,
+    0xb4, 0x33, 0x7d, 0x02, 0x69, 0x05, 0x46, 0x0b, 0x47, 0xd3, 0xeb, 0x36, 0x27, 0x73, 0x61, 0x2b, 0xdf, 0xd7, 0x22, 0x20,
+    0x52, 0x06, 0x66, 0xc6, 0x74, 0xdd, 0x06, 0x3e, 0x65, 0xc0, 0x61, 0x13, 0x56, 0x55, 0x0c, 0xed, 0x75, 0xee, 0x61, 0x0c,
+    0x35, 0xa9, 0xc5, 0xfd, 0xfb, 0xf7, 0xeb, 0xdc, 0xb6, 0x29, 0x00, 0xa2, 0x24, 0x83, 0xdd, 0x4a, 0xb5, 0xd7, 0x0a, 0x40,
+    0x29, 0xb5, 0x42, 0xe2, 0x00, 0x45, 0x69, 0x4f, 0x97, 0x31, 0xbb, 0x94, 0xd0, 0x39, 0x49, 0x91, 0x22, 0xd2, 0x25, 0x39,
+    0x97, 0x55, 0xcf, 0x15, 0xa6, 0x2e, 0xb1, 0x6a, 0x45, 0x69, 0x82, 0xda, 0x9a, 0x83, 0x9f, 0xbf, 0x2a, 0x7a, 0xfc, 0x2d,
+    0x11, 0x96, 0xcc, 0x5a, 0xf9, 0x18, 0x67, 0x49, 0xa4, 0xcb, 0xa8, 0x30, 0xc9, 0x75, 0xb8, 0x58, 0xdc, 0x89, 0xfc, 0xc6,
+    0x67, 0xec, 0x49, 0x99, 0x1a, 0x1f, 0xbd, 0x73, 0xa7, 0x8a, 0xd5, 0x78, 0xa8, 0x04, 0x88, 0xe4, 0x62, 0x23, 0xe5, 0xab,
+    0x27, 0xf7, 0x8a, 0x99, 0x85, 0x84, 0x32, 0xd0, 0x5e, 0xa5, 0xef, 0x39, 0x31, 0x74, 0x02, 0x3a, 0xbd, 0x12, 0x40, 0x8c,
+    0x96, 0x03, 0xc9, 0x05, 0x61, 0xea, 0x1e, 0x15, 0xb3, 0xe1, 0x22, 0xcd, 0xf1, 0x59, 0x1e, 0xac, 0x26, 0x03, 0xc5, 0x5a,
+    0x82, 0xd8, 0x99, 0x71, 0xe7, 0x4e, 0x56, 0xa2, 0x61, 0x38, 0x61, 0xd3, 0x24, 0x65, 0xdb, 0x48, 0x31, 0xdc, 0x6f, 0x34,
+    0x8a, 0x6d, 0x0c, 0xf6, 0xac, 0x0c, 0x4d, 0xdd, 0x28, 0xca, 0xee, 0xa8, 0x82, 0x52, 0x51, 0xa4, 0x6e, 0x2a, 0x34, 0xc9,
+    0x50, 0x52, 0x43, 0x94, 0xeb, 0x46, 0xd0, 0xc4, 0x77, 0xca, 0x5e, 0x64, 0xe0, 0x3b, 0x39, 0xf9, 0x30, 0x98, 0xb3, 0xe0,
+    0x04, 0x72, 0xa0, 0xdb, 0x16, 0x3f, 0x6b, 0x98, 0x30, 0xe8, 0xdf, 0xdf, 0x7b, 0xba, 0x73, 0xcd, 0xd4, 0x82, 0x0d, 0x92,
+    0x32, 0xb8, 0x86, 0x2d, 0xc8, 0x4b, 0x50, 0x11, 0xf6, 0xdf, 0x1e, 0x6e, 0xd3, 0x2f, 0xb1, 0xae, 0x23, 0xd7, 0xc1, 0x45,
+    0xdd, 0xba, 0x5a, 0x2b, 0x88, 0x0b, 0x56, 0x2c, 0x50, 0x82, 0xde, 0x2d, 0x7a, 0x13, 0x9d, 0x69, 0x92, 0x08, 0xb9, 0x0d,
+    0xab, 0xbe, 0xc9, 0x95, 0x3b, 0xb7, 0x27, 0xa5, 0xd6, 0x66, 0x7b, 0x7b, 0x7b, 0x7b, 0x23, 0xd7, 0x53, 0x60, 0xba, 0xbb,
+    0xbd, 0xfa, 0x57, 0xd1, 0xb7, 0x54, 0x76, 0x6f, 0x89, 0xc3, 0x82, 0x4e, 0xb0, 0x40, 0x29, 0x88, 0xae, 0x71, 0xc1, 0x21,
+    0x63, 0x03, 0xb6, 0x57, 0x99, 0x52, 0xad, 0x3f, 0x6b, 0x7d, 0x88, 0x53, 0x73, 0x97, 0x16, 0xd9, 0xc9, 0x17, 0x91, 0x82,
+    0x58, 0x42, 0x34, 0x8f, 0x45, 0xc5, 0xc8, 0xdb, 0x7d, 0xa5, 0x75, 0x0e, 0x53, 0x7b, 0xa5, 0x0a, 0xc2, 0xae, 0x46, 0x80,
+    0x3b, 0x35, 0xb4, 0x76, 0xb0, 0x26, 0x39, 0x65, 0x45, 0xbb, 0xa2, 0x3e, 0xf7, 0x75, 0x48, 0x6c, 0x7f, 0x4e, 0x9a, 0x8c,
+    0x8b, 0x14, 0xa1, 0x39, 0x77, 0x34, 0xda, 0xeb, 0x3b, 0xe3, 0x05, 0x0d, 0xe5, 0x06, 0x86, 0xc6, 0x95, 0x08, 0x8a, 0x65,
+    0xab, 0x50, 0xe1, 0xa1, 0xa4, 0x10, 0x86, 0xb1, 0x65, 0xd9, 0x96, 0xf5, 0xcd, 0xca, 0xc4, 0x6a, 0x1d, 0xa5, 0xbd, 0xc8,
+    0xb2, 0x28, 0x18, 0x9c, 0xe6, 0x4b, 0x5d, 0xd4, 0x11, 0x2c, 0x62, 0x0b, 0x26, 0x90, 0x03, 0x2a, 0x1b, 0x2e, 0xed, 0xb5,
+    0xac, 0x63, 0x98, 0x6c, 0x18, 0x97, 0x72, 0xa7, 0x77, 0x3a, 0x77, 0x92, 0x55, 0xa7, 0xf2, 0xbb, 0x81, 0xcd, 0x44, 0x61,
+    0x57, 0x7d, 0x64, 0x96, 0x72, 0x28, 0x32, 0xf1, 0x67, 0x1b, 0x42, 0xc0, 0x12, 0x8d, 0x54, 0xe7, 0xf5, 0x19, 0xfa, 0xf5,
+    0x25, 0xa3, 0xc2, 0x43, 0x14, 0xed, 0x29, 0x8f, 0xa2, 0x16, 0xe6, 0xd8, 0xb0, 0x9c, 0x37, 0xc0, 0xae, 0x62, 0x8b, 0xf4,
+    0xa7, 0xa9, 0xef, 0xd7, 0xc5, 0x6b, 0xb9, 0x8e, 0x8c, 0xd7, 0x5f, 0x1e, 0x90, 0xdc, 0x60, 0xbd, 0x6b, 0x47, 0x6b, 0xab,
+    0xa1, 0x64, 0x2f, 0x31, 0x29, 0xf7, 0xc6, 0x6c, 0x10, 0x12, 0xd0, 0xf8, 0x94, 0x66, 0x45, 0xe2, 0xaa, 0x3a, 0x81, 0x86,
+    0x61, 0x2a, 0x24, 0xb9, 0x46, 0x4e, 0xf1, 0x6f, 0x45, 0xde, 0x3a, 0x5a, 0xed, 0x77, 0x75, 0xff, 0x75, 0xbf, 0xab, 0x9a,
+    0xc1, 0x18, 0xa5, 0xe1, 0x2e, 0xe4, 0xa7, 0x24, 0x88, 0x68, 0x96, 0x8d, 0x1b, 0xaa, 0x41, 0xd1, 0x50, 0x2d, 0xda, 0xd2,
+    0x80, 0x2a, 0xf5, 0x1b, 0x84, 0x87, 0xe3, 0xc6, 0x3c, 0xc9, 0x04, 0xb6, 0x88, 0x1b, 0x07, 0xfb, 0x5d, 0x80, 0xaa, 0x87,
+    0x57, 0x65, 0x2b, 0x80, 0x00, 0x9b, 0x62, 0x33, 0x50, 0x29, 0xb9, 0xed, 0x5a, 0x56, 0x21, 0x57, 0x20, 0xcf, 0x0d, 0x04,
+    0xae, 0x81, 0x18, 0x34, 0x9e, 0x02, 0xe2, 0x08, 0x3c, 0x64, 0x69, 0xd0, 0x5a, 0xdd, 0xd4, 0xbb, 0x0a, 0x27, 0x68, 0xf4,
+    0x1b, 0xf3, 0x20, 0x9f, 0xb2, 0x9d, 0x74, 0xdd, 0x9d, 0x00, 0xd0, 0xc9, 0x0a, 0xec, 0x23, 0x47, 0x8c, 0x1e, 0xcd, 0x69,
+    0x1c, 0x35, 0x48, 0x12, 0x07, 0x11, 0x0f, 0x4e, 0xc6, 0x0d, 0xc0, 0x2d, 0x40, 0x6a, 0x8f, 0x65, 0x6b, 0xdc, 0xf3, 0x1b,
+    0x07, 0x3f, 0xb3, 0x18, 0x9c, 0x7f, 0x4c, 0x1e, 0xd2, 0xbf, 0x7e, 0x07, 0xed, 0xdc, 0xef, 0x2a, 0x5c, 0x35, 0x38, 0x2d,
+    0x2c, 0xc9, 0x92, 0xc5, 0x87, 0x4c, 0x08, 0xb0, 0xea, 0x0c, 0x91, 0x3c, 0xd8, 0xd0, 0x34, 0xa2, 0x69, 0x31, 0x59, 0x11,
+    0x6d, 0x3e, 0x2c, 0xba, 0xdd, 0x62, 0xbc, 0x46, 0x86, 0x56, 0xa9, 0xac, 0x47, 0xcb, 0x10, 0x68, 0xb5, 0xd6, 0x90, 0x1c,
+    0x9e, 0x0f, 0x0e, 0xbe, 0x07, 0xa4, 0x69, 0x12, 0x45, 0x0c, 0xc8, 0x80, 0x5b, 0x77, 0x1c, 0xa7, 0x23, 0x87, 0x15, 0x7d,
+    0x99, 0x4d, 0x81, 0xc5, 0x60, 0x09, 0x6a, 0xf1, 0xbb, 0x9e, 0xf5, 0x76, 0x71, 0x0e, 0xd3, 0x4b, 0x94, 0x11, 0xd7, 0xbd,
+    0x28, 0xc1, 0xe6, 0xcf, 0x1e, 0x49, 0xda, 0x91, 0xdc, 0x23, 0xfd, 0x88, 0x4b, 0x6a, 0x73, 0x02, 0x95, 0x07, 0x31, 0x54,
+    0x95, 0x69, 0x2b, 0xaf, 0x65, 0x4a, 0x7a, 0x85, 0xf2, 0x11, 0x8d, 0xa3, 0x4f, 0x1f, 0xc8, 0x8b, 0x64, 0xe6, 0xe2, 0x04,
+    0xa8, 0xc6, 0x55, 0xa8, 0xdc, 0x3a, 0xb4, 0xcc, 0x5a, 0x95, 0x32, 0xca, 0xbe, 0x62, 0x03, 0xc3, 0x7d, 0xc3, 0xe0, 0x7c,
+    0x8e, 0x03, 0x0d, 0x02, 0xbe, 0x27, 0x60, 0x73, 0xc8, 0xcb, 0x59, 0x3a, 0x6e, 0xbc, 0x64, 0x19, 0xfd, 0x95, 0xcc, 0x2e,
+    0xff, 0x8c, 0x31, 0xa1, 0xe8, 0x74, 0x50, 0x67, 0x4e, 0xd8, 0x06, 0xb2, 0xa5, 0x78, 0xdc, 0xe0, 0x53, 0x8f, 0x9d, 0x62,
+    0xf8, 0x80, 0x27, 0x8f, 0x92, 0x90, 0x8d, 0xc7, 0xfd, 0x1d, 0x9f, 0x64, 0x2c, 0x0e, 0x61, 0x5a, 0x46, 0x67, 0x52, 0x1f,
+    0xdd, 0xc5, 0xaf, 0x52, 0xc2, 0xd2, 0xc4, 0xef, 0xd4, 0xa2, 0xb9, 0x0e, 0x6e, 0x97, 0x68, 0x8d, 0x76, 0x4a, 0x7b, 0xd5,
+    0x0a, 0xfd, 0x12, 0x8b, 0x83, 0x46, 0xae, 0xb0, 0xea, 0x2e, 0x5f, 0x35, 0xdf, 0x04, 0x98, 0xd1, 0x8c, 0x09, 0x32, 0x1e,
+    0x13, 0x31, 0xe7, 0x99, 0x4f, 0x64, 0x31, 0x63, 0x1b, 0x45, 0x45, 0x71, 0x9c, 0xf2, 0x77, 0x8b, 0x72, 0xdb, 0x95, 0x58,
+    0xa3, 0x46, 0x89, 0x1d, 0x30, 0xab, 0xf8, 0x2b, 0xc1, 0x1a, 0xa3, 0xc8, 0x0d, 0xb3, 0x6c, 0x11, 0x12, 0xc0, 0xf6, 0x46,
+    0x45, 0x41, 0xa7, 0x04, 0x3c, 0x5d, 0xff, 0x5b, 0xdf, 0x1a, 0x4f, 0xe4, 0x12, 0xe3, 0xaa, 0x53, 0x8d, 0xb0, 0xf2, 0xe2,
+    0xce, 0x62, 0x5e, 0x85, 0x47, 0xb7, 0x04, 0x5f, 0xb0, 0x6c, 0x74, 0xa5, 0xd0, 0xca, 0x7b, 0xd7, 0xd9, 0xd0, 0xb5, 0xaa,
+    0x42, 0x54, 0x96, 0x52, 0x72, 0x5b, 0x47, 0x74, 0xa2, 0x04, 0xd8, 0x22, 0xcd, 0x35, 0x9f, 0x72, 0x43, 0x4d, 0x13, 0xa8,
+    0xf9, 0x89, 0x3f, 0xe5, 0x44, 0xb3, 0xec, 0xd3, 0x87, 0x2a, 0x51, 0xd7, 0xaa, 0x64, 0x79, 0x01, 0x70, 0xe8, 0x36, 0xfe,
+    0xa7, 0x3c, 0x5d, 0xac, 0xc1, 0xc6, 0xc8, 0x77, 0x97, 0x1f, 0xe3, 0x80, 0x45, 0xe8, 0x01, 0xbe, 0x68, 0xeb, 0x45, 0xdd,
+    0xda, 0xd8, 0xe2, 0xe0, 0xec, 0x2d, 0x35, 0x6c, 0x8e, 0x99, 0xd4, 0x4e, 0x33, 0xa5, 0x46, 0x1b, 0xb0, 0x96, 0x20, 0x2a,
+    0xa6, 0x8c, 0x1b, 0xdd, 0x8c, 0x9e, 0x32, 0x44, 0xd6, 0x20, 0xe0, 0xa5, 0xe6, 0x09, 0xa0, 0x7e, 0xf3, 0xfa, 0xf0, 0xa8,
+    0x66, 0x9e, 0x9c, 0xab, 0x0e, 0xb4, 0x00, 0x03, 0x98, 0x51, 0xc6, 0x43, 0xc3, 0xca, 0x10, 0xdc, 0x91, 0x77, 0x78, 0xf8,
+    0xfc, 0xb1, 0xbf, 0xdf, 0x95, 0x20, 0x5b, 0xa6, 0xd7, 0xfb, 0x18, 0x89, 0x49, 0x1f, 0xf2, 0xaa, 0xeb, 0x94, 0xfd, 0x67,
+    0xc5, 0x53, 0x16, 0x5e, 0x4f, 0x85, 0x39, 0xf4, 0xd2, 0x94, 0xfc, 0xf5, 0xbf, 0x7c, 0x0a, 0xa1, 0x8f, 0x7f, 0x3e, 0x19,
+    0x39, 0x02, 0x49, 0x4a, 0x71, 0xa7, 0xc8, 0x29, 0xd0, 0x5f, 0x8f, 0x49, 0x9d, 0xc6, 0x34, 0x20, 0xfb, 0x8e, 0x56, 0x70,
+    0xfb, 0x3d, 0xdd, 0x84, 0xe0, 0x37, 0x20, 0x7d, 0x7e, 0x48, 0x3f, 0x41, 0xc8, 0x8d, 0xeb, 0x64, 0xd1, 0x45, 0x61, 0x5c,
+    0x6f, 0x71, 0x46, 0xea, 0x96, 0x9e, 0xd5, 0x09, 0xbd, 0x6e, 0x05, 0x6b, 0xea, 0x83, 0x34, 0x5c, 0xf1, 0x38, 0xc9, 0x67,
+    0x5a, 0x89, 0x35, 0x18, 0xff, 0xf2, 0x40, 0x8f, 0x93, 0xd7, 0x47, 0x0f, 0xf6, 0xbb, 0x4b, 0x2b, 0xc3, 0xa1, 0x6a, 0xe0,
+    0x35, 0xac, 0x6e, 0xb2, 0xa8, 0x4a, 0xd2, 0xb2, 0x6d, 0xd1, 0x9f, 0xd8, 0xa4, 0x7e, 0xc1, 0x7a, 0x86, 0x2e, 0x0f, 0x60,
+    0x02, 0x52, 0x40, 0xbc, 0xc7, 0x49, 0xb6, 0xa1, 0xe4, 0xe7, 0xcb, 0x8f, 0x27, 0x11, 0xf3, 0x91, 0xa0, 0xfa, 0x19, 0x52,
+    0x9d, 0x1d, 0xdd, 0x2d, 0x94, 0x7b, 0xb5, 0x0c, 0x21, 0x11, 0x6f, 0x10, 0x16, 0x07, 0x4a, 0x46, 0x8b, 0x55, 0x24, 0x38,
+    0x14, 0x6e, 0x42, 0x32, 0xbe, 0x0d, 0xa3, 0x74, 0x0b, 0x25, 0x15, 0xf1, 0x42, 0xe2, 0xce, 0x8c, 0x5a, 0x18, 0xbc, 0x34,
+    0x08, 0xd8, 0x52, 0x8c, 0x1b, 0x9d, 0x09, 0x8f, 0x5b, 0x9d, 0xd9, 0xfb, 0x06, 0x91, 0x49, 0x2d, 0xa6, 0x3f, 0x95, 0x23,
+    0xc2, 0xcf, 0x5d, 0xa7, 0xa4, 0x46, 0x6a, 0xff, 0xa8, 0x46, 0xb9, 0x33, 0xd9, 0xc6, 0xbb, 0x1a, 0x65, 0xda, 0xa2, 0x50,
+    0x65, 0x21, 0xfd, 0x98, 0x46, 0x87, 0x5a, 0x2e, 0x5f, 0x24, 0xab, 0x1f, 0x7f, 0x78, 0x61, 0xb4, 0xe5, 0x6f, 0x08, 0x27,
+    0x8d, 0x34, 0x1f, 0xaf, 0xe0, 0x8c, 0x65, 0xea, 0x40, 0xd1, 0x2f, 0x30, 0xc7, 0x72, 0xaf, 0xb8, 0xbc, 0xf7, 0x1a, 0x38,
+    0x4c, 0x05, 0x3f, 0xb1, 0x9d, 0x2d, 0xe1, 0x97, 0x7f, 0xf0, 0xf8, 0x6a, 0x67, 0x54, 0x61, 0x3c, 0xe2, 0x36, 0x0c, 0x91,
+    0x0b, 0x19, 0x61, 0xe3, 0xa5, 0x93, 0xfd, 0xcc, 0x85, 0x58, 0x0e, 0xbb, 0x5d, 0x76, 0x46, 0xa1, 0xd2, 0x63, 0x9d, 0x20,
+    0x59, 0x74, 0xa7, 0x9a, 0x26, 0xd4, 0x84, 0xeb, 0xfc, 0xd7, 0xe7, 0x7b, 0x0e, 0x6b, 0x4b, 0x1b, 0x4e, 0x74, 0xe6, 0x4b,
+    0x9e, 0x88, 0x7f, 0xae, 0x01, 0xd7, 0x66, 0xc3, 0xe6, 0x43, 0xb7, 0x80, 0x4c, 0xf6, 0x20, 0xef, 0x4c, 0xce, 0xb3, 0x3c,
+    0xb8, 0x15, 0x24, 0xcb, 0xcd, 0x88, 0x0c, 0x7a, 0x83, 0x5d, 0x02, 0x99, 0x2e, 0x9f, 0x92, 0x67, 0xf4, 0xe4, 0x04, 0xa2,
+    0x41, 0xff, 0x90, 0x81, 0x21, 0xe0, 0xd1, 0xe2, 0x42, 0x6a, 0x07, 0x92, 0x86, 0x53, 0xf1, 0xbd, 0x9b, 0x20, 0xe5, 0x4b,
+    0xa1, 0x50, 0x4c, 0x57, 0xb1, 0x2a, 0xec, 0xdd, 0x4a, 0x03, 0xab, 0xdd, 0x24, 0x58, 0x2d, 0x30, 0xff, 0x82, 0xe4, 0xeb,
+    0x09, 0x32, 0x20, 0x16, 0x0f, 0x37, 0xcf, 0x43, 0xaf, 0xe9, 0xa4, 0x6f, 0x4d, 0xbf, 0x23, 0x2d, 0xae, 0xa3, 0x8b, 0x63,
+    0x32, 0x26, 0x4d, 0x2c, 0x8f, 0x9b, 0xa6, 0x78, 0xcd, 0x17, 0x28, 0xa5, 0x24, 0xff, 0x68, 0x05, 0xec, 0x1f, 0x54, 0x57,
+    0x28, 0x95, 0x5c, 0xb0, 0x02, 0xe4, 0x90, 0xe0, 0x99, 0x51, 0x35, 0xbc, 0xe6, 0x23, 0x3e, 0xa7, 0xef, 0xc9, 0x46, 0x57,
+    0x61, 0x13, 0x55, 0x85, 0x7d, 0xfa, 0x10, 0x65, 0x9f, 0x3e, 0xc4, 0x64, 0xf1, 0xe9, 0xc3, 0xb7, 0x4d, 0x1f, 0xa7, 0x4c,
+    0xf1, 0xbc, 0xd1, 0x6b, 0x76, 0x35, 0x32, 0x58, 0x5d, 0xcc, 0x59, 0xec, 0xa5, 0x64, 0x7c, 0x40, 0x28, 0x30, 0x54, 0x6c,
+    0xc7, 0xf4, 0xe9, 0xc3, 0x26, 0xc1, 0x5c, 0xbc, 0x89, 0xbd, 0x84, 0x8b, 0x32, 0x75, 0x98, 0x45, 0x3f, 0x94, 0x19, 0xc8,
+    0x1b, 0xac, 0x3b, 0x3d, 0x79, 0x64, 0xd4, 0x22, 0x58, 0xbc, 0x32, 0x5c, 0x78, 0xcd, 0x26, 0x59, 0x12, 0x9c, 0x30, 0xd1,
+    0x41, 0x48, 0x2f, 0x66, 0x6b, 0xf2, 0x23, 0x8f, 0xc5, 0xbd, 0x07, 0x69, 0x4a, 0x37, 0xde, 0xdb, 0x3e, 0xbe, 0x58, 0x55,
+    0xcc, 0x20, 0xdf, 0x92, 0x3e, 0x19, 0x92, 0xde, 0xb1, 0xef, 0x8f, 0xea, 0x56, 0xca, 0xf3, 0x75, 0x72, 0x9e, 0xeb, 0x18,
+    0xb0, 0x22, 0x13, 0xba, 0x33, 0x3d, 0xde, 0xce, 0x7d, 0x53, 0x71, 0x34, 0xfd, 0x51, 0x3e, 0x15, 0xf4, 0xca, 0x93, 0x13,
+    0x3b, 0xd2, 0x44, 0x3a, 0x50, 0x4e, 0x2d, 0x3c, 0xbf, 0x86, 0xec, 0x77, 0x2f, 0x0f, 0xbf, 0x1b, 0xde, 0x3c, 0xaf, 0xc2,
+    0x5e, 0xbc, 0x03, 0x42, 0xad, 0xc7, 0x28, 0xc6, 0x5c, 0x84, 0x17, 0x55, 0x5d, 0x54, 0xd9, 0x1d, 0xe4, 0x76, 0x10, 0x5e,
+    0x5f, 0x81, 0x1b, 0xb0, 0x37, 0x12, 0x81, 0x71, 0x72, 0x39, 0xa2, 0xe3, 0xae, 0xbc, 0xc6, 0x97, 0xb4, 0xb2, 0x82, 0xe4,
+    0x62, 0xb4, 0x7e, 0xb3, 0xd9, 0xc3, 0xcd, 0x23, 0xb4, 0x29, 0x44, 0xee, 0x39, 0x41, 0xdc, 0xda, 0x37, 0x98, 0x33, 0x6c,
+    0x1c, 0x10, 0xf4, 0x80, 0x78, 0xb2, 0x6f, 0x21, 0xed, 0x44, 0x2c, 0x9e, 0x89, 0x39, 0x3c, 0xbe, 0x7d, 0x1b, 0xf9, 0x50,
+    0x8c, 0xbc, 0xe5, 0xc7, 0x1d, 0x69, 0xad, 0x2f, 0x78, 0x26, 0x3a, 0x29, 0x5b, 0x24, 0xa7, 0xb0, 0x80, 0x4e, 0x07, 0x73,
+    0x69, 0x69, 0x12, 0x25, 0xd1, 0x36, 0x81, 0xff, 0x59, 0xb1, 0x74, 0x73, 0x08, 0x35, 0x6b, 0x20, 0x92, 0xf4, 0x41, 0x14,
+    0x79, 0x0d, 0xa7, 0x2b, 0x79, 0x0d, 0x71, 0x12, 0x5d, 0x0d, 0x69, 0xf2, 0xf9, 0xe7, 0x13, 0xb6, 0x4d, 0x37, 0x8c, 0x2c,
+    0x2c, 0x34, 0x34, 0x0c, 0x2d, 0x1c, 0x39, 0x06, 0x10, 0x5d, 0x27, 0x58, 0xa5, 0xd8, 0xa0, 0x3d, 0x92, 0xf5, 0xdb, 0xd5,
+    0x53, 0x2e, 0xbe, 0x92, 0x1f, 0xdd, 0x2e, 0x39, 0xa4, 0x9b, 0x29, 0x25, 0x19, 0x9d, 0x70, 0xf0, 0x01, 0xe9, 0x88, 0x04,
+    0x68, 0x6c, 0x94, 0x5c, 0xfe, 0xf9, 0x1e, 0xc2, 0x50, 0xc8, 0x3e, 0xfd, 0xce, 0x52, 0xb0, 0x42, 0xd2, 0xa5, 0x4b, 0xde,
+    0x55, 0x96, 0x70, 0xf9, 0xf1, 0x3d, 0x4b, 0xd1, 0x36, 0x62, 0xa0, 0x3b, 0x0a, 0x57, 0xe9, 0x2a, 0x5a, 0xa5, 0x2d, 0x83,
+    0x2f, 0x4b, 0xe2, 0x94, 0x9e, 0x70, 0x39, 0x95, 0xff, 0xf5, 0x3b, 0x3f, 0x89, 0xe0, 0x1f, 0x20, 0x80, 0x2c, 0xe7, 0x50,
+    0xea, 0xad, 0x3d, 0x3f, 0xbb, 0xfc, 0x98, 0x5e, 0x7e, 0x5c, 0x90, 0x78, 0x05, 0xf9, 0x03, 0xc5, 0x1a, 0x7f, 0x4a, 0xd3,
+    0x13, 0x28, 0x52, 0x48, 0x02, 0x3f, 0xe8, 0x09, 0x99, 0x81, 0x8b, 0x4d, 0x25, 0xea, 0x53, 0x78, 0xa8, 0xd6, 0x1f, 0x03,
+    0x38, 0xb6, 0x14, 0x41, 0x69, 0xb1, 0xfb, 0xfa, 0x98, 0x45, 0x82, 0xa2, 0x48, 0xdf, 0x1e, 0x8f, 0xca, 0xfe, 0x09, 0xeb,
+    0x66, 0x95, 0xc1, 0x39, 0x86, 0xb9, 0xdd, 0x11, 0xba, 0xbd, 0xaf, 0xa6, 0x66, 0x3c, 0xca, 0x00, 0xed, 0xa7, 0xd2, 0x3d,
+    0x6b, 0x92, 0xdb, 0xc4, 0x93, 0x54, 0xe1, 0x5b, 0x22, 0xe0, 0x23, 0x9a, 0x79, 0x33, 0xad, 0x09, 0xde, 0xa2, 0x69, 0x77,
+    0xd7, 0x6c, 0xf3, 0xbe, 0x86, 0x00, 0x6c, 0xad, 0xa1, 0x23, 0x84, 0x8f, 0x47, 0xb9, 0x49, 0xb9, 0xeb, 0xc8, 0x14, 0xfb,
+    0xd3, 0x07, 0x58, 0x03, 0xd7, 0x79, 0xf0, 0x86, 0x80, 0xef, 0x5e, 0xc1, 0x95, 0x0f, 0x14, 0x29, 0x40, 0xbe, 0xfc, 0x8c,
+    0xf5, 0xca, 0x89, 0x6e, 0x65, 0x55, 0x7b, 0xd1, 0x77, 0x0f, 0x4e, 0x04, 0x9f, 0x76, 0xc8, 0x9b, 0x24, 0x15, 0xb0, 0xd4,
+    0xcd, 0x73, 0x35, 0x88, 0xdd, 0xc8, 0x8b, 0xe6, 0x3b, 0xa4, 0xe3, 0x0d, 0xcd, 0x10, 0x40, 0x39, 0xec, 0x09, 0x07, 0xa9,
+    0x63, 0x8d, 0x42, 0x21, 0x33, 0xa4, 0xe0, 0xb7, 0x67, 0x11, 0xaa, 0xc5, 0x8c, 0x47, 0x9d, 0xe6, 0xa8, 0xce, 0x0d, 0x15,
+    0xf2, 0x62, 0x9f, 0x27, 0x2e, 0xd3, 0x07, 0xdd, 0x42, 0x35, 0x0e, 0x7f, 0x06, 0x0f, 0xf2, 0x86, 0x40, 0x05, 0x4d, 0xf3,
+    0xb4, 0x99, 0xb3, 0x73, 0xba, 0x2e, 0x50, 0x81, 0x9a, 0x43, 0xca, 0x34, 0x84, 0xcd, 0x80, 0x6d, 0xc4, 0x0b, 0x50, 0x73,
+    0x99, 0xc0, 0x6f, 0x2e, 0xff, 0x84, 0x99, 0x0b, 0xd0, 0x76, 0x4e, 0xbc, 0x3e, 0xd1, 0xd5, 0x45, 0x8b, 0x0c, 0x50, 0xf9,
+    0x5b, 0xe4, 0x0e, 0xa6, 0x6f, 0x78, 0x0e, 0x1f, 0x2d, 0xe8, 0x86, 0xc6, 0xb2, 0x14, 0x87, 0x70, 0x76, 0xf9, 0x67, 0x04,
+    0x26, 0x70, 0xf9, 0x91, 0xcc, 0xf8, 0x7b, 0xc0, 0xa6, 0xd5, 0x1d, 0xff, 0xbc, 0x6d, 0x16, 0x35, 0x4c, 0x53, 0x15, 0xdd,
+    0x80, 0x48, 0x5f, 0x15, 0x19, 0x6c, 0xf3, 0xb8, 0x03, 0x9e, 0xe9, 0x09, 0x85, 0x30, 0xea, 0xf1, 0x10, 0xc2, 0x96, 0x8f,
+    0xb1, 0x73, 0x7b, 0xb8, 0xe7, 0x61, 0x35, 0xc2, 0xab, 0x3d, 0x02, 0x5a, 0x72, 0x0b, 0x49, 0xdf, 0xdf, 0x47, 0x2c, 0xa0,
+    0x66, 0x52, 0xbb, 0x4c, 0xf4, 0xff, 0x1c, 0x05, 0xd6, 0xa9, 0x24, 0xb0, 0xd2, 0x44, 0x9d, 0x1c, 0x35, 0x50, 0x4c, 0x7e,
+    0xfb, 0x0d, 0xa3, 0x50, 0x8e, 0xc6, 0xb5, 0xd0, 0x51, 0x29, 0x72, 0x16, 0x87, 0xd3, 0x57, 0x44, 0xcf, 0x4a, 0xe3, 0xb3,
+    0xe9, 0xe2, 0x51, 0x0f, 0xcb, 0x82, 0xb5, 0x68, 0x50, 0xf4, 0x69, 0x34, 0x05, 0x27, 0x27, 0x39, 0x23, 0x9d, 0x34, 0x52,
+    0xc7, 0xf4, 0x10, 0x90, 0xbc, 0x83, 0xf0, 0xf0, 0x0b, 0x84, 0xde, 0x8b, 0x77, 0x23, 0x07, 0x04, 0x63, 0xf7, 0xa4, 0x83,
+    0x89, 0x2e, 0xf6, 0xd0, 0xfa, 0x7e, 0x09, 0x43, 0x81, 0x25, 0x4d, 0xd6, 0xf6, 0xce, 0x82, 0x94, 0x01, 0x25, 0x7a, 0x73,
+    0x1e, 0xf8, 0x8e, 0x53, 0xd8, 0x0a, 0x02, 0x95, 0x9c, 0x50, 0xe9, 0xe4, 0xbe, 0x39, 0xda, 0x82, 0x3e, 0x56, 0x13, 0xb6,
+    0xe1, 0xc7, 0x7a, 0x16, 0x17, 0x40, 0xb0, 0x12, 0x7b, 0x26, 0x1d, 0x7c, 0xb8, 0x0d, 0xaf, 0xaa, 0x50, 0xb6, 0x23, 0x96,
+    0xe3, 0x88, 0x59, 0x5e, 0xd4, 0x11, 0xbf, 0x95, 0xe4, 0x4a, 0xae, 0x54, 0x42, 0xcd, 0x75, 0x9e, 0xa4, 0x13, 0x1b, 0xc5,
+    0x63, 0x70, 0xba, 0x78, 0x98, 0x3c, 0x49, 0x30, 0x09, 0x56, 0x03, 0x52, 0x3e, 0x78, 0x3e, 0xa5, 0x6e, 0xcd, 0x61, 0x33,
+    0xee, 0x4c, 0x8a, 0xbb, 0xba, 0xbe, 0x02, 0x4c, 0xe2, 0x60, 0x4e, 0xe3, 0x19, 0x22, 0xf5, 0xa4, 0xf0, 0x2b, 0x49, 0x64,
+    0xcb, 0x45, 0xe9, 0x6f, 0xdb, 0x89, 0x3e, 0x0f, 0xbf, 0x9e, 0xfd, 0xfa, 0x88, 0xda, 0xe5, 0x92, 0x9a, 0x2c, 0xcf, 0x95,
+    0x6a, 0x78, 0xa5, 0xf8, 0x4a, 0x97, 0x18, 0x00, 0x55, 0x96, 0xd8, 0xd2, 0x68, 0xb4, 0xbe, 0xe8, 0x21, 0x14, 0x62, 0x4b,
+    0x41, 0xfb, 0x23, 0xcb, 0x16, 0xf4, 0x30, 0x40, 0x96, 0xc8, 0xbf, 0x20, 0x2c, 0xca, 0xd8, 0x56, 0x7d, 0xc5, 0xd6, 0xe3,
+    0xf6, 0x0d, 0x29, 0x0b, 0xc2, 0x2d, 0xe1, 0x61, 0xae, 0xb3, 0x1f, 0x78, 0xd0, 0x54, 0x8f, 0x3f, 0x4f, 0xcf, 0x10, 0x52,
+    0xb7, 0x1e, 0xaf, 0x92, 0x44, 0xbf, 0x9e, 0xfb, 0xee, 0x2e, 0x01, 0x57, 0x79, 0x97, 0xf9, 0xdd, 0x85, 0x5f, 0x1b, 0x87,
+    0xa2, 0x84, 0x86, 0xd5, 0x28, 0x64, 0x27, 0x1f, 0x56, 0x4e, 0xa8, 0xcb, 0x97, 0x3c, 0x3d, 0x72, 0x0a, 0x98, 0xb4, 0xf3,
+    0x2b, 0xe4, 0x43, 0x90, 0xb8, 0xab, 0x67, 0x59, 0xd5, 0x9f, 0x18, 0xac, 0xd9, 0xc8, 0x0d, 0x7f, 0xe6, 0xf6, 0x91, 0x3c,
+    0x36, 0xf1, 0xfc, 0xaa, 0x8b, 0xf9, 0x3a, 0xaf, 0x04, 0x7c, 0xf9, 0x15, 0x90, 0x3c, 0xc1, 0x2a, 0x03, 0x2b, 0xe1, 0x41,
+    0x9e, 0xbb, 0x92, 0x26, 0xe0, 0xa4, 0x4d, 0xa3, 0xba, 0x2c, 0x4a, 0xc3, 0xe6, 0xbe, 0x10, 0xbf, 0x9c, 0xb1, 0x91, 0x00,
+    0x16, 0xe6, 0x2d, 0xbc, 0x2b, 0x60, 0xbd, 0xd0, 0xe6, 0x9e, 0xa4, 0x38, 0xaf, 0xbd, 0x9c, 0x45, 0x3b, 0xcb, 0x55, 0x36,
+    0x07, 0x68, 0xdc, 0xb2, 0x58, 0xa5, 0xb1, 0x9d, 0x18, 0xe3, 0xb4, 0xb0, 0x73, 0x4a, 0xf6, 0x4d, 0x1c, 0x39, 0xf5, 0x0d,
+    0x54, 0x05, 0xe6, 0xeb, 0x1c, 0x06, 0x82, 0x36, 0xba, 0x5d, 0x5b, 0x90, 0x75, 0xc8, 0x0d, 0x34, 0xe8, 0x74, 0xe7, 0xb4,
+    0x8c, 0x4f, 0x07, 0x04, 0x9f, 0x84, 0xd5, 0xd8, 0xf0, 0x16, 0x94, 0x2f, 0x89, 0x8f, 0xfd, 0x2d, 0xe2, 0x34, 0x13, 0x30,
+    0xff, 0x37, 0xf2, 0xfd, 0xfa, 0xeb, 0x24, 0xae, 0x13, 0x8b, 0xeb, 0x49, 0x4b, 0xc1, 0xad, 0x88, 0x30, 0xe8, 0xf2, 0x80,
+    0x2c, 0x30, 0x64, 0x82, 0x2e, 0x35, 0xf7, 0x67, 0x2e, 0xda, 0x8b, 0x52, 0x05, 0x89, 0xe9, 0x64, 0x13, 0x94, 0x83, 0xa0,
+    0x28, 0xac, 0x54, 0x0e, 0x37, 0x0c, 0x9f, 0xa3, 0x3c, 0x53, 0x94, 0x4f, 0x20, 0x61, 0x2c, 0x07, 0xe4, 0x92, 0x24, 0x74,
+    0xde, 0x51, 0x46, 0xa9, 0x63, 0x3b, 0xe2, 0x50, 0x97, 0xa3, 0x2f, 0xc9, 0x0f, 0x8a, 0x49, 0xb5, 0xb5, 0x69, 0x36, 0x4f,
+    0xd6, 0xe6, 0xec, 0xd8, 0x9b, 0x6c, 0x04, 0xcb, 0xaa, 0x25, 0x36, 0x7e, 0x51, 0x0a, 0x2d, 0x13, 0x7e, 0x3e, 0xa6, 0x82,
+    0xfe, 0x1b, 0x6e, 0x15, 0x28, 0x48, 0x62, 0x3a, 0xc5, 0x6f, 0x0a, 0xe8, 0x3b, 0xf8, 0xf9, 0x7a, 0x3a, 0xcd, 0x98, 0xb0,
+    0x9f, 0xbc, 0x90, 0xd5, 0x5b, 0x25, 0xfb, 0x38, 0x81, 0x34, 0x1f, 0x7d, 0x14, 0xc2, 0xbd, 0xed, 0x1f, 0x63, 0x2c, 0xef,
+    0x61, 0x4a, 0xa4, 0x5b, 0x80, 0x32, 0x33, 0xd2, 0xad, 0xdb, 0xa6, 0x6a, 0x12, 0xac, 0xb2, 0x1c, 0x7e, 0x70, 0x5c, 0x46,
+    0x17, 0x42, 0x12, 0x05, 0xc3, 0x48, 0x2a, 0x32, 0x05, 0x5b, 0x0d, 0x3b, 0x03, 0x6f, 0x07, 0x2a, 0xe9, 0x74, 0xc5, 0x7c,
+    0xf8, 0x00, 0x2e, 0x44, 0x55, 0x80, 0xbb, 0x1a, 0xa0, 0x8c, 0x2e, 0x55, 0x6a, 0xa5, 0x76, 0xa1, 0xea, 0x4f, 0x72, 0x00,
+    0xd9, 0xc6, 0x2e, 0x90, 0x58, 0x42, 0xd1, 0xef, 0x6b, 0x1c, 0xd8, 0xbf, 0x28, 0xe3, 0xc9, 0x96, 0x4c, 0x2a, 0x52, 0xaa,
+    0x7a, 0x1c, 0xef, 0x5a, 0xe4, 0xe6, 0xf9, 0x4b, 0x2a, 0xe6, 0xea, 0x9d, 0x29, 0x4f, 0x3e, 0xee, 0x92, 0x7e, 0x6f, 0x70,
+    0xc7, 0xbf, 0x20, 0xdf, 0x3f, 0xec, 0x66, 0xb1, 0x4c, 0xf4, 0x9b, 0x65, 0x3c, 0x57, 0xea, 0x71, 0xd3, 0x3a, 0xff, 0x2f,
+    0x77, 0x39, 0x0c, 0xe3, 0xc6, 0x64, 0x80, 0x1a, 0x05, 0xda, 0xed, 0xc6, 0x88, 0x77, 0x37, 0xcf, 0x51, 0x12, 0x17, 0x43,
+    0x32, 0x07, 0xd1, 0xbe, 0xb3, 0x55, 0x52, 0x06, 0x2b, 0x17, 0x47, 0xff, 0x1a, 0x1c, 0x82, 0x2e, 0xe8, 0x22, 0xa2, 0xb1,
+    0x3c, 0xbf, 0x71, 0x76, 0x2a, 0xe5, 0x63, 0xed, 0x14, 0xaa, 0x1b, 0x64, 0xcd, 0x85, 0x5f, 0x5d, 0xf2, 0xca, 0x15, 0xfe,
+    0x75, 0xf3, 0x5c, 0x89, 0xf2, 0x5b, 0x22, 0xb1, 0x2f, 0x78, 0xec, 0xf5, 0x7b, 0xbd, 0x96, 0xba, 0x9b, 0x46, 0x49, 0x92,
+    0xaa, 0xb5, 0xbe, 0xc1, 0x17, 0x4a, 0x60, 0x45, 0x09, 0xed, 0x4b, 0xe1, 0x5c, 0x7c, 0x31, 0x4d, 0x17, 0xa6, 0xec, 0xce,
+    0x4f, 0xdd, 0x87, 0xe4, 0xf2, 0x0f, 0x96, 0xc2, 0xff, 0x53, 0x16, 0x32, 0x5d, 0x87, 0xab, 0x12, 0x9e, 0xc6, 0x74, 0x2e,
+    0xa0, 0x8a, 0xb6, 0xc6, 0xc9, 0x62, 0x25, 0x22, 0x7a, 0xd2, 0x22, 0x21, 0xd7, 0x50, 0x58, 0x97, 0xcb, 0xca, 0x0d, 0x6a,
+    0x99, 0x00, 0xe6, 0x03, 0x01, 0xb3, 0xcb, 0x3f, 0x53, 0x26, 0x0b, 0x73, 0xf1, 0xe9, 0x43, 0x6a, 0x16, 0xf4, 0xde, 0xf3,
+    0xd9, 0x7b, 0x3a, 0xc3, 0xba, 0x9c, 0x63, 0x43, 0xa8, 0xdf, 0xfb, 0x9f, 0x90, 0x05, 0x04, 0xab, 0x99, 0x3f, 0x18, 0x14,
+    0xfd, 0x7e, 0x87, 0x3c, 0x83, 0x45, 0xf1, 0x4b, 0x78, 0xaa, 0x39, 0x8d, 0x9d, 0x01, 0xf2, 0xe8, 0xd9, 0x83, 0x1f, 0x8e,
+    0x7e, 0x39, 0x7c, 0xf2, 0xe8, 0xf5, 0xab, 0xc7, 0x87, 0xf8, 0x35, 0x3d, 0xbe, 0x61, 0x40, 0x10, 0x7f, 0xcf, 0xa1, 0xce,
+    0xef, 0x7c, 0x55, 0xe8, 0x93, 0x0b, 0x38, 0x26, 0x3b, 0x5a, 0x73, 0xb1, 0x0d, 0x90, 0xbf, 0x74, 0xf0, 0x90, 0x66, 0x4c,
+    0x86, 0xac, 0x56, 0xf1, 0xec, 0x7b, 0xb6, 0x91, 0x0a, 0x3d, 0xa5, 0x20, 0xaa, 0x16, 0xd1, 0x2f, 0x2e, 0x29, 0x20, 0x75,
+    0xf3, 0x98, 0xa7, 0x62, 0x63, 0x20, 0x6a, 0x5b, 0x06, 0x26, 0xe8, 0x56, 0x1c, 0xcd, 0x67, 0x55, 0x24, 0x6a, 0x95, 0x66,
+    0xc5, 0x64, 0x91, 0x15, 0x2c, 0xcb, 0x2b, 0xa2, 0x9c, 0x62, 0xd0, 0x94, 0xd2, 0x93, 0x8e, 0x06, 0x1d, 0xe6, 0x3d, 0x8d,
+    0x2b, 0x6b, 0x2e, 0xe7, 0x25, 0x8c, 0x9a, 0xf6, 0xad, 0xc2, 0x66, 0xbc, 0x04, 0xb8, 0x30, 0xf9, 0x4e, 0x9b, 0x55, 0xda,
+    0x7d, 0x51, 0xbd, 0x94, 0x73, 0x54, 0xa3, 0x5d, 0xd0, 0xa5, 0xe7, 0x65, 0x57, 0x55, 0x4b, 0x90, 0x99, 0x5f, 0x5f, 0xe7,
+    0x00, 0x90, 0x9b, 0x34, 0xca, 0x75, 0x9a, 0x75, 0x31, 0x53, 0xbe, 0xbb, 0x75, 0x2d, 0x42, 0x84, 0xaa, 0xc1, 0x28, 0x5f,
+    0x41, 0xa8, 0x45, 0xfb, 0xf7, 0xeb, 0xa5, 0xac, 0x26, 0x8f, 0xd5, 0x91, 0xc9, 0x04, 0xb9, 0x6d, 0x49, 0x73, 0xb3, 0x36,
+    0x59, 0xd3, 0xaf, 0x9e, 0x6d, 0x9f, 0xa7, 0x00, 0xca, 0x93, 0xe5, 0x96, 0x9d, 0xe4, 0x5f, 0xae, 0xaf, 0xb9, 0xab, 0x07,
+    0x10, 0xa8, 0xa5, 0x57, 0xa8, 0x2b, 0x0b, 0x00, 0xb4, 0x96, 0xa6, 0x24, 0x42, 0xa6, 0x2b, 0xe9, 0x43, 0x66, 0xe3, 0x82,
+    0xa8, 0xe4, 0x0a, 0xdf, 0x55, 0x64, 0xd8, 0x18, 0xc9, 0xf4, 0xca, 0x66, 0x9d, 0x96, 0x7a, 0x95, 0x3a, 0x1b, 0x4a, 0x2c,
+    0xb7, 0x6e, 0xe1, 0x47, 0x07, 0x41, 0x3b, 0x8a, 0xe9, 0x86, 0x85, 0xa0, 0x9c, 0x38, 0xa2, 0x80, 0xa5, 0xfa, 0x93, 0x8b,
+    0xed, 0xe9, 0xcd, 0xd7, 0x96, 0x3d, 0xa3, 0xdf, 0x77, 0xcd, 0x1b, 0x43, 0xde, 0x48, 0x1e, 0x4c, 0xb1, 0x4c, 0x3c, 0x88,
+    0xf9, 0x42, 0x7e, 0x0d, 0xf2, 0x69, 0x8a, 0xed, 0xe7, 0x30, 0xa5, 0x6b, 0x65, 0xe4, 0xfe, 0x96, 0xb4, 0x03, 0xca, 0xc0,
+    0x30, 0x62, 0xc6, 0xab, 0x6e, 0xb6, 0x65, 0x1e, 0x27, 0x6c, 0x63, 0xe7, 0x08, 0xb7, 0x48, 0xbf, 0x6c, 0xf5, 0xb2, 0x75,
+    0x67, 0x92, 0x02, 0xf2, 0x9b, 0x86, 0xdd, 0x39, 0xc6, 0x1e, 0xcb, 0xbd, 0xfc, 0xfe, 0x8e, 0xbc, 0xef, 0xef, 0xe5, 0x0f,
+    0x76, 0xe5, 0x03, 0xf0, 0xfb, 0xe4, 0xe0, 0xe0, 0xc0, 0x0e, 0xdb, 0xb8, 0x71, 0x58, 0xd5, 0xaf, 0x7a, 0x3c, 0xb9, 0x61,
+    0x97, 0x41, 0x2e, 0x4c, 0x35, 0x75, 0x96, 0x1d, 0x6d, 0xec, 0xee, 0x63, 0x06, 0xb8, 0x07, 0xc5, 0x00, 0xd9, 0x77, 0x52,
+    0x8a, 0x91, 0xbf, 0xbd, 0xfd, 0xa1, 0xe8, 0x5c, 0xde, 0xbe, 0x5d, 0x52, 0x05, 0x44, 0x87, 0x39, 0x35, 0x84, 0xbc, 0x6c,
+    0xce, 0xa7, 0x42, 0x5d, 0x4e, 0x5c, 0xa0, 0x30, 0xc1, 0x57, 0x93, 0x5d, 0x2c, 0x30, 0xeb, 0x36, 0xf2, 0x0a, 0xb8, 0xd8,
+    0x3b, 0xbb, 0x3b, 0xf5, 0x21, 0x42, 0x0e, 0xc8, 0x37, 0xdf, 0x28, 0x2c, 0x23, 0x8d, 0x0c, 0x20, 0xee, 0xe2, 0x61, 0xcf,
+    0x7a, 0xce, 0x23, 0x66, 0x80, 0xef, 0xf5, 0x4a, 0x1a, 0x8b, 0xeb, 0x7b, 0xa7, 0xe4, 0x5f, 0x80, 0xe0, 0x5b, 0xd2, 0xf6,
+    0x74, 0x41, 0xd0, 0x85, 0xdb, 0x21, 0x8c, 0x75, 0x31, 0xd5, 0xf8, 0xcd, 0x66, 0xaa, 0x3c, 0x1c, 0xb0, 0xa3, 0xca, 0x5b,
+    0x1e, 0x42, 0xc6, 0x27, 0xc5, 0x0b, 0xf9, 0x14, 0xcc, 0xf2, 0xbc, 0xea, 0xf8, 0x6f, 0x80, 0x03, 0xfb, 0xad, 0xa7, 0x35,
+    0xd8, 0xb4, 0x1d, 0xcb, 0x17, 0x49, 0x0b, 0xab, 0x09, 0x8f, 0x6b, 0xea, 0x38, 0x39, 0xe8, 0x4b, 0x43, 0xe4, 0xf1, 0xaa,
+    0xec, 0x46, 0x70, 0x50, 0x1b, 0x84, 0x2a, 0x94, 0xde, 0x8a, 0x56, 0x0d, 0xad, 0x98, 0x25, 0x20, 0xb3, 0x14, 0xbc, 0x34,
+    0x2d, 0x08, 0xc7, 0xc7, 0x25, 0xbe, 0x68, 0xae, 0x39, 0x48, 0x75, 0x58, 0x00, 0xa3, 0x14, 0xa4, 0xed, 0xac, 0xf7, 0xb6,
+    0x77, 0x0c, 0xff, 0xc8, 0x41, 0x29, 0x18, 0xcb, 0xc4, 0x05, 0x36, 0xee, 0x60, 0x91, 0xd2, 0xb1, 0x2b, 0xcf, 0x8b, 0xff,
+    0x37, 0x53, 0x2d, 0x20, 0xdc, 0x88, 0xbd, 0x2d, 0xd8, 0x17, 0x83, 0x79, 0x45, 0x17, 0x6c, 0x0b, 0x5d, 0x01, 0x6a, 0x52,
+    0xd0, 0x31, 0x5e, 0x0c, 0xab, 0x8c, 0xe0, 0x14, 0xa2, 0x0a, 0x07, 0x2f, 0xfc, 0x93, 0xfa, 0xf5, 0x0b, 0x73, 0xfb, 0xd9,
+    0x33, 0xf9, 0x76, 0x70, 0x55, 0xc8, 0x00, 0x20, 0xdf, 0x22, 0xc6, 0x22, 0x75, 0x8d, 0x8a, 0x03, 0x0f, 0xd4, 0x9b, 0xc4,
+    0xf8, 0x64, 0x2e, 0x59, 0x62, 0x40, 0x00, 0x62, 0x64, 0x8d, 0xc3, 0xb0, 0x9d, 0x81, 0x5a, 0xb4, 0x89, 0x33, 0xb5, 0x34,
+    0xe4, 0x03, 0x32, 0x16, 0x9d, 0x41, 0x60, 0x18, 0x40, 0x02, 0x00, 0xde, 0x56, 0x06, 0xe8, 0x40, 0x0b, 0xa7, 0xa4, 0x51,
+    0x02, 0x03, 0x2d, 0xa3, 0xe9, 0x0f, 0x2c, 0x10, 0x1e, 0x98, 0x26, 0xfc, 0x5b, 0xc3, 0x36, 0xea, 0x5a, 0x0c, 0xcb, 0x5c,
+    0x3f, 0xaa, 0xbe, 0xc3, 0x6e, 0x08, 0x66, 0x48, 0x26, 0x00, 0xbf, 0x2d, 0x26, 0x80, 0x2e, 0xf5, 0x4b, 0xda, 0x1e, 0x98,
+    0x03, 0xca, 0x72, 0xea, 0x8c, 0x08, 0xc0, 0x7d, 0x76, 0x44, 0xf2, 0x14, 0xbf, 0xdf, 0xe7, 0x05, 0xb9, 0x02, 0x43, 0xda,
+    0x7b, 0xf3, 0x5c, 0xdf, 0xae, 0x62, 0x2e, 0xca, 0xbd, 0x56, 0x74, 0x36, 0x90, 0x61, 0x03, 0x9a, 0xe7, 0xf1, 0x14, 0xbb,
+    0x20, 0x9b, 0x16, 0xbe, 0xd6, 0x0e, 0xf7, 0x6d, 0xf3, 0xc0, 0x9d, 0xb0, 0xb4, 0xa4, 0xbe, 0x54, 0x7d, 0x72, 0xdc, 0xe9,
+    0x12, 0xbd, 0xf7, 0x3e, 0xa2, 0xf2, 0x35, 0x3e, 0x7c, 0x32, 0x2a, 0xc6, 0x0e, 0x10, 0xad, 0xaf, 0x71, 0xab, 0xb1, 0x8b,
+    0x1a, 0x8e, 0xc9, 0xf1, 0xb1, 0xc2, 0x73, 0x2e, 0xa1, 0xc1, 0x61, 0xf5, 0xe5, 0x57, 0x4c, 0x49, 0x5b, 0x5e, 0xd5, 0x49,
+    0x52, 0xf4, 0x00, 0xa9, 0x64, 0x02, 0x98, 0x5b, 0xbb, 0xd6, 0xdc, 0xaa, 0x32, 0xcc, 0x44, 0x9a, 0x9c, 0xb0, 0x43, 0xcc,
+    0xf5, 0x30, 0xb9, 0xd1, 0xbf, 0x97, 0xa3, 0x39, 0x92, 0x83, 0xf8, 0x1d, 0xaa, 0x9f, 0xb4, 0x36, 0xf5, 0x3b, 0xbb, 0xea,
+    0xe1, 0x84, 0xcd, 0x78, 0xfc, 0x06, 0xca, 0x8b, 0x72, 0x87, 0xc8, 0x66, 0x8a, 0xb7, 0xac, 0x4f, 0xe5, 0x0a, 0x6a, 0x91,
+    0x03, 0xc0, 0x14, 0x49, 0xaa, 0xe8, 0xa1, 0x5b, 0xf5, 0xea, 0x1d, 0xc4, 0x37, 0xa8, 0x57, 0x68, 0x7c, 0xa8, 0x0c, 0x3b,
+    0xf0, 0x5f, 0xb1, 0xb2, 0xad, 0xd8, 0xd3, 0x55, 0xdc, 0xd2, 0x77, 0xdf, 0x10, 0x0f, 0xa1, 0xf6, 0x6a, 0x5a, 0x7a, 0xf2,
+    0x2c, 0xdc, 0xcf, 0xb7, 0x75, 0x94, 0x78, 0x67, 0x80, 0x16, 0xbc, 0x81, 0x2c, 0xc6, 0xf0, 0x31, 0x1e, 0xac, 0xe6, 0x8f,
+    0xdd, 0x5e, 0x9f, 0xbf, 0x8d, 0x71, 0xde, 0xf5, 0xbd, 0x2c, 0x95, 0x03, 0x28, 0x37, 0x54, 0x89, 0xff, 0xb2, 0xcb, 0x2f,
+    0x83, 0x57, 0xef, 0x58, 0x57, 0x9e, 0x56, 0xef, 0xeb, 0xbf, 0x0e, 0x5f, 0xbf, 0xea, 0x2c, 0xf1, 0x17, 0xb0, 0xc8, 0x17,
+    0x0b, 0xf0, 0x40, 0xef, 0x31, 0x0b, 0x12, 0xa8, 0x2d, 0x3c, 0x1f, 0xf5, 0x1a, 0xae, 0x74, 0x87, 0x22, 0x5b, 0x4d, 0xa8,
+    0x7c, 0xe3, 0xa0, 0xef, 0xc3, 0x9f, 0x51, 0xb5, 0xb8, 0xb5, 0x17, 0x81, 0xb8, 0x55, 0xd3, 0x0f, 0xb9, 0x66, 0xd2, 0x8e,
+    0xbf, 0x25, 0x9b, 0xb9, 0x66, 0x1e, 0xe4, 0x1e, 0x4e, 0x03, 0x0d, 0x8a, 0x3e, 0x7d, 0xb0, 0xb7, 0x22, 0x4b, 0xfc, 0xa5,
+    0x35, 0x8c, 0x64, 0x9f, 0x3e, 0x7c, 0xfa, 0x5d, 0x9e, 0x66, 0x95, 0xcf, 0x7b, 0x39, 0xa1, 0x02, 0xca, 0x45, 0xfb, 0xb0,
+    0x19, 0x4b, 0xb7, 0x19, 0xe0, 0x5a, 0xd3, 0xcd, 0x48, 0xde, 0xe4, 0x0d, 0x4c, 0x7d, 0x9b, 0xbd, 0x86, 0x04, 0x94, 0x85,
+    0x0f, 0xd5, 0xf7, 0xb4, 0x1c, 0x9f, 0xbd, 0x86, 0xba, 0x14, 0x1b, 0xdb, 0x61, 0xf8, 0x04, 0xdf, 0x40, 0xc5, 0x63, 0x6d,
+    0x00, 0x4d, 0xf1, 0xe5, 0x09, 0xc8, 0xe6, 0x5b, 0xc4, 0xf3, 0xc7, 0x07, 0xe7, 0x36, 0xb5, 0x46, 0xa4, 0x78, 0x22, 0x2d,
+    0x8b, 0xab, 0x35, 0x24, 0x9f, 0x8d, 0xe1, 0xbd, 0x7e, 0xb7, 0x41, 0xe8, 0x26, 0x85, 0xf2, 0x1f, 0x7f, 0xb3, 0x4e, 0x8b,
+    0x34, 0xba, 0xeb, 0xac, 0x01, 0x85, 0xe8, 0x66, 0x4a, 0x63, 0x3c, 0x8e, 0xc3, 0xa7, 0x50, 0x7a, 0x53, 0xb2, 0x49, 0x22,
+    0xe2, 0x3d, 0x7b, 0xf2, 0xe2, 0xcd, 0x93, 0x1f, 0x7e, 0x79, 0x76, 0x74, 0xf4, 0xe6, 0x97, 0x27, 0xaf, 0xbe, 0x7b, 0xfe,
+    0xea, 0x89, 0xef, 0xaa, 0x48, 0xa9, 0xf1, 0x5a, 0x6e, 0x78, 0xea, 0xed, 0xfa, 0x66, 0xdf, 0x79, 0xf1, 0xb7, 0x36, 0x4c,
+    0x6e, 0x0e, 0x9b, 0xd8, 0x76, 0x01, 0xea, 0xba, 0xdd, 0x9b, 0xe7, 0x7a, 0x9b, 0x50, 0x9e, 0xc9, 0x08, 0xd8, 0x31, 0x07,
+    0x9c, 0x17, 0xe6, 0xac, 0x75, 0x9d, 0x5d, 0x60, 0xff, 0xe5, 0x2a, 0x78, 0x07, 0xb6, 0x10, 0x71, 0xce, 0x6c, 0xdd, 0x28,
+    0x2b, 0xa8, 0x36, 0x44, 0xd6, 0xc0, 0xe2, 0xcb, 0x5d, 0x34, 0xdd, 0x1c, 0xe9, 0x73, 0x16, 0xa9, 0xa8, 0xaa, 0xa5, 0xd6,
+    0xac, 0x83, 0x4e, 0x62, 0x7c, 0x93, 0x04, 0xdd, 0x03, 0x43, 0x79, 0x6c, 0x29, 0xca, 0x95, 0x57, 0x75, 0xa5, 0x5d, 0xe9,
+    0xd6, 0x5e, 0x54, 0xd5, 0x41, 0x65, 0x09, 0x17, 0xf5, 0x0b, 0xcb, 0xb7, 0x9d, 0xf2, 0x95, 0x33, 0x26, 0x8e, 0xf8, 0x82,
+    0x25, 0x2b, 0xe1, 0x39, 0x12, 0x6a, 0x11, 0xfc, 0xca, 0x38, 0x68, 0x47, 0x3d, 0x92, 0x85, 0x7a, 0x89, 0xa7, 0xd8, 0x40,
+    0xc5, 0xbf, 0xe3, 0x89, 0x53, 0x32, 0x25, 0x50, 0x5d, 0x53, 0x41, 0x21, 0x74, 0xcb, 0x97, 0x02, 0x52, 0x1e, 0xcf, 0x9a,
+    0xb8, 0x03, 0xdb, 0x61, 0x94, 0xde, 0x27, 0x52, 0x33, 0xfc, 0xda, 0x3e, 0xb4, 0x31, 0x0e, 0xfc, 0x8d, 0x03, 0x57, 0xbf,
+    0x27, 0x84, 0xf5, 0x67, 0x65, 0x1a, 0xcf, 0x0e, 0x03, 0xf9, 0xfd, 0x90, 0xf0, 0x28, 0x79, 0x28, 0xdf, 0xbf, 0xc4, 0x68,
+    0x92, 0xcc, 0x3a, 0x99, 0x7c, 0xac, 0x52, 0x12, 0xf0, 0xad, 0xf8, 0xc8, 0xce, 0x52, 0xb0, 0xa9, 0x5e, 0x80, 0x1d, 0x25,
+    0x4b, 0xcc, 0x92, 0x4b, 0xe1, 0x15, 0x86, 0x79, 0x0c, 0x86, 0xf6, 0xec, 0xe8, 0xe5, 0x0b, 0x0c, 0x65, 0x6a, 0x1b, 0xa3,
+    0x32, 0x63, 0xbc, 0x2a, 0x0d, 0x4a, 0xa2, 0x36, 0xf6, 0x2a, 0x51, 0x36, 0x13, 0x2e, 0x8c, 0x0b, 0xde, 0xef, 0x9a, 0xf7,
+    0xe5, 0xf6, 0xbb, 0xf2, 0x2b, 0x52, 0xfb, 0x5d, 0xf9, 0x2b, 0xb5, 0xbe, 0xfa, 0x3f, 0x2e, 0x89, 0xbf, 0xc4, 0x63, 0x4b,
+    0x00, 0x00,
+};
+
+// html/setup.html: 3386 bayt -> gzip 1517 bayt
+static const char SETUP_HTML_ETAG[] = "\"9e8d108fb3496d8d\"";
+static const uint8_t SETUP_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57, 0xdb, 0x6e, 0xdb, 0x46, 0x10, 0x7d, 0xcf, 0x57,
+    0x4c, 0x98, 0x14, 0xa2, 0x50, 0x89, 0x94, 0xe4, 0xb8, 0x35, 0x74, 0x2b, 0x92, 0x38, 0x46, 0x83, 0x24, 0x88, 0x11, 0x3b,
+    0x28, 0x0a, 0xf4, 0x65, 0x45, 0x0e, 0xc5, 0x8d, 0x96, 0xbb, 0xec, 0xee, 0x52, 0xb2, 0x6a, 0xf8, 0x57, 0xea, 0x6f, 0xf0,
+    0x7b, 0xdf, 0xea, 0xfc, 0x57, 0x67, 0x49, 0x4a, 0xd6, 0xcd, 0x69, 0x2b, 0xc3, 0x32, 0x77, 0xb9, 0x33, 0x73, 0xe6, 0xcc,
+    0x6d, 0x3d, 0x7c, 0x7a, 0xfa, 0xf1, 0xf5, 0xe5, 0xaf, 0xe7, 0x6f, 0x20, 0xb5, 0x99, 0x18, 0x0f, 0xdd, 0x37, 0x08, 0x26,
+    0xa7, 0x23, 0xcf, 0x6a, 0x8f, 0xd6, 0xc8, 0xe2, 0xf1, 0xd0, 0x72, 0x2b, 0x70, 0xfc, 0x0b, 0x3f, 0xe3, 0xf0, 0xae, 0xd0,
+    0x85, 0x28, 0xb2, 0x62, 0x18, 0x56, 0x9b, 0xc3, 0x0c, 0x2d, 0x03, 0xc9, 0x32, 0x1c, 0x79, 0x73, 0x8e, 0x8b, 0x5c, 0x69,
+    0xeb, 0x41, 0xa4, 0xa4, 0x45, 0x69, 0x47, 0xde, 0x82, 0xc7, 0x36, 0x1d, 0xc5, 0x38, 0xe7, 0x11, 0xb6, 0xcb, 0x45, 0x0b,
+    0xb8, 0xe4, 0x96, 0x33, 0xd1, 0x36, 0x11, 0x13, 0x38, 0xea, 0x7a, 0xb5, 0x8e, 0x28, 0x65, 0xda, 0x20, 0xc9, 0x7c, 0xbe,
+    0x3c, 0x6b, 0x9f, 0x78, 0xe3, 0x27, 0x43, 0x63, 0x97, 0x64, 0xe1, 0x09, 0xd0, 0x67, 0xa2, 0xe2, 0x25, 0x5c, 0x43, 0x42,
+    0x7a, 0xdb, 0x09, 0xcb, 0xb8, 0x58, 0xf6, 0xa1, 0xcd, 0xf2, 0x5c, 0x60, 0xdb, 0x2c, 0x8d, 0xc5, 0xac, 0x05, 0xde, 0x05,
+    0x4e, 0x15, 0xc2, 0xe7, 0xb7, 0x5e, 0x0b, 0x3e, 0xa9, 0x89, 0xb2, 0xaa, 0x05, 0x2f, 0x35, 0x19, 0x6a, 0x81, 0x61, 0xd2,
+    0xb4, 0x0d, 0x6a, 0x9e, 0x0c, 0x60, 0xc2, 0xa2, 0xd9, 0x54, 0xab, 0x42, 0xc6, 0x7d, 0x78, 0x96, 0x74, 0x92, 0x5e, 0x72,
+    0x3c, 0x80, 0x8c, 0xe9, 0x29, 0x97, 0x7d, 0xe8, 0x0c, 0x20, 0x67, 0x71, 0xcc, 0xe5, 0xb4, 0x0f, 0xdd, 0x1f, 0xf2, 0xab,
+    0x01, 0x79, 0x22, 0x94, 0xa6, 0x93, 0x47, 0x47, 0x47, 0x03, 0xb8, 0x29, 0xb1, 0x04, 0x11, 0xd3, 0x31, 0x81, 0xd9, 0xd6,
+    0x94, 0x38, 0xdd, 0x4a, 0xc7, 0xa8, 0xdb, 0x9a, 0xc5, 0xbc, 0x30, 0x7d, 0x38, 0x71, 0x0a, 0x76, 0xf4, 0x65, 0xec, 0xaa,
+    0xe2, 0xa1, 0x0f, 0x2f, 0x7a, 0x9d, 0x6a, 0xa7, 0xb6, 0x0d, 0xac, 0xb0, 0xca, 0x29, 0xb9, 0x6a, 0x9b, 0x94, 0xc5, 0x6a,
+    0xe1, 0xf6, 0x7a, 0xf9, 0x15, 0x1c, 0xd3, 0xaf, 0x9e, 0x4e, 0x98, 0xdf, 0x69, 0x95, 0x3f, 0x41, 0xe7, 0xa4, 0xb9, 0x02,
+    0x93, 0xf6, 0x08, 0xc9, 0x83, 0x8a, 0x0e, 0x74, 0x7b, 0x4e, 0x69, 0x49, 0x94, 0xe1, 0x7f, 0x20, 0xd9, 0x0d, 0x7a, 0x98,
+    0xad, 0x8e, 0x3f, 0x93, 0x68, 0x0d, 0xc4, 0x7c, 0x4e, 0x52, 0x0f, 0xc8, 0x4a, 0x1c, 0x35, 0x78, 0x22, 0xce, 0xaa, 0x8c,
+    0x36, 0xc9, 0xa8, 0x51, 0x82, 0xc7, 0xf0, 0x0c, 0x11, 0x89, 0x88, 0x42, 0x1b, 0xc7, 0x44, 0xae, 0x38, 0xc5, 0x56, 0x0f,
+    0x48, 0x89, 0xc9, 0x05, 0xa3, 0x38, 0x24, 0x02, 0x49, 0xfc, 0x4b, 0x61, 0x2c, 0x4f, 0x96, 0xed, 0x3a, 0xf4, 0x7d, 0x30,
+    0x39, 0xa3, 0x98, 0x4f, 0xd0, 0x2e, 0x10, 0xe5, 0x9e, 0xfd, 0x7e, 0xaa, 0xe6, 0xa8, 0xf7, 0x58, 0x3c, 0x4e, 0x4e, 0x1c,
+    0x91, 0xd5, 0x61, 0x2e, 0xf3, 0xc2, 0xb6, 0x60, 0x52, 0x10, 0x22, 0x49, 0x47, 0x6b, 0xde, 0xba, 0x9d, 0xce, 0x77, 0x83,
+    0x5d, 0xf4, 0x15, 0x05, 0x6d, 0xab, 0xf2, 0x6d, 0x7f, 0xb6, 0x1c, 0x89, 0xa2, 0x68, 0x2f, 0x48, 0x2f, 0xaa, 0xb3, 0x57,
+    0x8e, 0xad, 0x52, 0xdf, 0x9a, 0x87, 0x1d, 0x1a, 0xcb, 0xf0, 0x55, 0xc0, 0xd6, 0x88, 0xb6, 0xc0, 0x77, 0x3a, 0x3f, 0x4e,
+    0x1c, 0xf8, 0x55, 0xca, 0x6c, 0xa4, 0x44, 0x1f, 0xa4, 0x92, 0xb8, 0x26, 0x21, 0x33, 0xd3, 0x75, 0xd4, 0x6a, 0xc8, 0x65,
+    0xd4, 0x32, 0x5a, 0xa6, 0xc8, 0xa7, 0xa9, 0xdd, 0x08, 0xdb, 0x30, 0xac, 0xea, 0x60, 0x18, 0x56, 0xc5, 0xe8, 0x4a, 0x61,
+    0x3c, 0x74, 0x21, 0x8c, 0x04, 0x33, 0x66, 0xe4, 0xb9, 0x74, 0xf4, 0xaa, 0x32, 0x19, 0xa6, 0xbd, 0xdd, 0x32, 0xa5, 0x9d,
+    0xea, 0x95, 0x93, 0xe0, 0xf1, 0xc8, 0x73, 0x11, 0xf0, 0xc6, 0x2f, 0xa7, 0x82, 0x69, 0xb0, 0x4c, 0x33, 0xc9, 0x97, 0x4a,
+    0x07, 0x41, 0x30, 0x0c, 0xe9, 0x44, 0x7d, 0x36, 0x51, 0x3a, 0x2b, 0x0f, 0xbb, 0x07, 0x0f, 0xa8, 0x3e, 0x53, 0x45, 0xab,
+    0xf3, 0x8f, 0x17, 0x97, 0x1e, 0xb0, 0xc8, 0x72, 0x25, 0x47, 0x5e, 0x68, 0xd8, 0x1c, 0x17, 0x3c, 0xe1, 0xb5, 0xf1, 0x52,
+    0xb2, 0x8c, 0x59, 0x29, 0x6a, 0x0c, 0x8f, 0xbd, 0xba, 0x33, 0x54, 0xcf, 0x94, 0x2e, 0x11, 0xa6, 0x4a, 0x10, 0x21, 0x23,
+    0xaf, 0x84, 0xf9, 0x32, 0xbe, 0xbf, 0x03, 0xff, 0xe2, 0xe2, 0xed, 0x69, 0xd3, 0x03, 0x8d, 0xbf, 0x17, 0x5c, 0x63, 0x7c,
+    0x50, 0x5b, 0x4e, 0xae, 0x2e, 0x88, 0xcb, 0x95, 0xc6, 0x87, 0xb5, 0x5d, 0xe6, 0x5b, 0xeb, 0x7d, 0x2b, 0x5f, 0xff, 0xe4,
+    0x89, 0x46, 0xb3, 0x85, 0xb3, 0x0a, 0xe1, 0xf8, 0x1d, 0x5b, 0xc6, 0x68, 0x61, 0x8e, 0xf0, 0x8a, 0xdd, 0xdf, 0x52, 0xe3,
+    0x1b, 0x86, 0xf5, 0x9b, 0x8a, 0x88, 0xd0, 0x11, 0xb0, 0x43, 0x20, 0x45, 0x8f, 0x7a, 0x56, 0xc5, 0xd6, 0xea, 0x8f, 0x89,
+    0x34, 0xcf, 0x6d, 0x75, 0x90, 0x2a, 0xc0, 0x58, 0x78, 0x0e, 0x23, 0x3a, 0x0d, 0xa3, 0x31, 0xc4, 0x2a, 0x2a, 0x32, 0x2a,
+    0x89, 0x60, 0x8a, 0xf6, 0x8d, 0x40, 0xf7, 0xf8, 0x6a, 0xf9, 0x36, 0xf6, 0x79, 0xdc, 0x1c, 0x94, 0x02, 0x49, 0x21, 0x4b,
+    0x4a, 0x81, 0x3a, 0xa2, 0xf4, 0x9b, 0x70, 0xbd, 0x86, 0x99, 0xa0, 0x8d, 0x52, 0xbf, 0x11, 0xb2, 0x9c, 0x87, 0xee, 0x65,
+    0xa3, 0x19, 0xd8, 0x14, 0xa5, 0xaf, 0x9d, 0x5e, 0x1d, 0x7c, 0x31, 0x8a, 0xce, 0xd7, 0x7b, 0xc6, 0xed, 0x3d, 0x88, 0x3e,
+    0x20, 0x29, 0x4b, 0x6e, 0x04, 0xcf, 0xfd, 0x86, 0x7b, 0x6a, 0xd4, 0x46, 0x57, 0x1f, 0xb7, 0x17, 0x58, 0xbc, 0xb2, 0xaf,
+    0xab, 0xc2, 0xa5, 0x93, 0x26, 0xa0, 0x4d, 0x22, 0x73, 0x66, 0x02, 0x81, 0x72, 0x6a, 0x53, 0xf8, 0x09, 0x1a, 0x0d, 0xe8,
+    0x83, 0x6f, 0x02, 0x87, 0x42, 0x52, 0x9d, 0xb8, 0xad, 0xfd, 0x1c, 0x72, 0x87, 0x68, 0x9b, 0x0a, 0x44, 0x14, 0x14, 0x27,
+    0x2a, 0xb1, 0x5d, 0x73, 0x1b, 0xba, 0x89, 0xda, 0x37, 0x8c, 0xdc, 0x93, 0xfb, 0xc0, 0x1f, 0xc0, 0x6b, 0xb5, 0x20, 0x44,
+    0x6b, 0x0a, 0x23, 0x8d, 0xcc, 0x62, 0xcd, 0xa2, 0xdf, 0x20, 0xf2, 0x77, 0x0d, 0xb8, 0x0f, 0x09, 0xed, 0xb8, 0x24, 0x03,
+    0x97, 0x82, 0xf0, 0x3d, 0xf8, 0x32, 0x50, 0x39, 0xca, 0x95, 0x47, 0x0d, 0xf8, 0xad, 0xb8, 0xee, 0x9e, 0x1d, 0x77, 0x7b,
+    0x37, 0x87, 0x14, 0x55, 0x18, 0x26, 0x34, 0x98, 0xbe, 0x01, 0x82, 0x1a, 0x9d, 0x3c, 0x24, 0xec, 0xc4, 0xf6, 0x60, 0x68,
+    0xc2, 0x41, 0x30, 0x1a, 0x10, 0xbf, 0xca, 0x1a, 0x87, 0x91, 0xd3, 0x58, 0x43, 0x19, 0xbf, 0x4e, 0xb9, 0x88, 0x7d, 0xa7,
+    0xe3, 0x11, 0x07, 0x95, 0x8c, 0x04, 0x8f, 0x66, 0xa4, 0x95, 0x52, 0xc6, 0x31, 0xe8, 0x22, 0xec, 0xbc, 0xa4, 0x24, 0x99,
+    0x33, 0x51, 0xe0, 0xda, 0xed, 0x81, 0x7b, 0xb3, 0x2a, 0x10, 0x7a, 0x9b, 0x90, 0x23, 0xc6, 0x77, 0x23, 0x64, 0x5f, 0x73,
+    0x99, 0x0e, 0x9b, 0x08, 0xc8, 0xd4, 0x0e, 0x80, 0x9b, 0x9d, 0x35, 0x4f, 0x36, 0x13, 0x83, 0xd2, 0x17, 0x68, 0x8c, 0x5f,
+    0xf2, 0x0c, 0x55, 0x61, 0x7d, 0xb7, 0xdd, 0x82, 0xee, 0x71, 0xa7, 0xb3, 0x1e, 0x59, 0x95, 0x0e, 0x9a, 0xa2, 0x2e, 0xb7,
+    0x2b, 0xec, 0x7b, 0x02, 0x47, 0x1d, 0x12, 0xa8, 0xed, 0xdc, 0x6c, 0x17, 0x49, 0xae, 0x84, 0xf0, 0x0d, 0x65, 0x9d, 0x7d,
+    0xac, 0x52, 0x5c, 0x4f, 0xfa, 0x56, 0xa5, 0x2c, 0xf6, 0x13, 0xce, 0xf9, 0xb0, 0x08, 0x48, 0xab, 0x25, 0xda, 0x46, 0xd0,
+    0x50, 0x52, 0x70, 0x89, 0x8d, 0xe6, 0xa3, 0x79, 0x59, 0x68, 0x41, 0xfc, 0x36, 0x52, 0x6b, 0xf3, 0x7e, 0x18, 0x36, 0x28,
+    0xa4, 0x8b, 0x80, 0xe7, 0x2e, 0xb2, 0xe1, 0x81, 0xb0, 0x12, 0xff, 0xd4, 0x35, 0x08, 0x13, 0x97, 0x12, 0xf5, 0xcf, 0x97,
+    0x1f, 0xde, 0x3b, 0xe1, 0xba, 0xe5, 0x94, 0x3d, 0xd0, 0x69, 0x20, 0x04, 0xb9, 0x56, 0x73, 0x6e, 0xc8, 0xcd, 0x0f, 0x06,
+    0x42, 0x37, 0xe9, 0x3a, 0x84, 0x59, 0x9d, 0xf1, 0x2b, 0x8c, 0xfd, 0x6e, 0xb3, 0x4c, 0x1c, 0x23, 0x9b, 0x7d, 0x18, 0x32,
+    0x48, 0x35, 0x26, 0x23, 0xcf, 0xc9, 0x39, 0x2c, 0xf4, 0xc6, 0x1b, 0x6f, 0x2c, 0x86, 0x21, 0x1b, 0xef, 0x00, 0xb9, 0x01,
+    0x14, 0x06, 0x6b, 0x57, 0x13, 0xc6, 0x45, 0x41, 0x4d, 0x11, 0xc6, 0xd0, 0x39, 0xe4, 0xe5, 0x1a, 0xf1, 0x76, 0x02, 0xaf,
+    0x30, 0xbb, 0xda, 0xbe, 0xbf, 0x6b, 0x01, 0xad, 0xc0, 0x3d, 0x49, 0xf2, 0x81, 0x9a, 0xe8, 0xd7, 0x5b, 0xd7, 0x69, 0x97,
+    0x1c, 0x66, 0x24, 0xa1, 0x95, 0x00, 0xa4, 0x19, 0x1d, 0x1c, 0xc6, 0xf1, 0xbf, 0x6d, 0xde, 0xdf, 0x89, 0xfb, 0xbb, 0xaa,
+    0xcf, 0x80, 0xf3, 0xf4, 0x03, 0xb3, 0x69, 0x50, 0x0e, 0x5f, 0xdf, 0x3f, 0xa5, 0xc0, 0x05, 0x52, 0x2d, 0x28, 0x9d, 0xda,
+    0x50, 0x27, 0x47, 0xcd, 0x5f, 0x4d, 0xda, 0x81, 0xa8, 0x6c, 0x64, 0x5d, 0x95, 0x86, 0x1b, 0xa9, 0xd5, 0xaa, 0x84, 0x77,
+    0x90, 0xff, 0x87, 0xfc, 0x7d, 0x4c, 0x13, 0xa5, 0x7f, 0x18, 0xc2, 0xcb, 0x73, 0x98, 0x11, 0x7b, 0x02, 0x62, 0xbc, 0xbf,
+    0xe5, 0x5f, 0x6f, 0x2d, 0xd7, 0x5c, 0xcf, 0xa8, 0x1f, 0x4d, 0x2a, 0x1f, 0x2d, 0xf1, 0x38, 0xbb, 0xbf, 0x33, 0x0c, 0xcc,
+    0xdf, 0x7f, 0x69, 0x24, 0x1e, 0x73, 0x36, 0xe1, 0x82, 0xeb, 0x8d, 0x4a, 0x20, 0x9a, 0xdc, 0x54, 0x22, 0x9e, 0x28, 0x13,
+    0x8b, 0x49, 0xc6, 0x1d, 0x49, 0xb8, 0x9d, 0xd3, 0x48, 0x99, 0x84, 0x73, 0xe2, 0xef, 0x14, 0x13, 0x56, 0x08, 0xeb, 0x6f,
+    0x78, 0xf2, 0x18, 0xcd, 0xe5, 0x2c, 0x8c, 0xc9, 0x58, 0xdd, 0xcb, 0x07, 0x7b, 0xc5, 0xb5, 0x1a, 0xf8, 0x8d, 0x96, 0xbb,
+    0xbe, 0x94, 0x97, 0x02, 0x6a, 0xa1, 0xee, 0x56, 0x40, 0x3b, 0xee, 0x5e, 0x42, 0xf7, 0x1c, 0x5c, 0xc0, 0xe7, 0x4f, 0xef,
+    0x2f, 0x90, 0xe9, 0x28, 0x3d, 0xa7, 0xd1, 0x90, 0x19, 0xdf, 0xed, 0x9d, 0x11, 0x62, 0x0a, 0x12, 0xf3, 0xd7, 0xe8, 0x9b,
+    0x4d, 0x62, 0x71, 0x8b, 0xde, 0x8d, 0x8a, 0xbd, 0x2e, 0xd3, 0xf4, 0xa9, 0x0e, 0xd4, 0xcc, 0x35, 0x14, 0x9b, 0xba, 0x39,
+    0x40, 0xb7, 0xf3, 0x9b, 0x8a, 0xd9, 0x87, 0x70, 0xbb, 0xae, 0xb2, 0xa3, 0x65, 0x33, 0x30, 0xd7, 0xff, 0xea, 0x2d, 0x35,
+    0xf1, 0x98, 0x93, 0xb3, 0xeb, 0xb6, 0x56, 0x37, 0xc5, 0x6a, 0x16, 0x0f, 0xdc, 0xf5, 0xab, 0x9a, 0xed, 0x74, 0x33, 0x28,
+    0x6f, 0x5e, 0x61, 0xf9, 0x9f, 0xd2, 0x93, 0x7f, 0x00, 0x4a, 0xb9, 0xd7, 0x3c, 0x3a, 0x0d, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,108 @@
+// lib/ESP32Helper/PanelOutbox.h
+
+#ifndef PANELOUTBOX_H
+#define PANELOUTBOX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// İstemci başına bekletilen durum çerçevelerinin toplam boyutu (bayt, uzunluk önekleri dahil).
+// Çerçeveler soket yazılabilir olduğunda tek seferde gittiğinden bu değer HELPER_SOCKET_WRITE_SIZE'ı geçmemelidir.
+#ifndef PANEL_OUTBOX_SIZE
+#define PANEL_OUTBOX_SIZE 512
+#endif
+
+// Bir panel istemcisine gidecek ikili çerçevelerin sınırlı kuyruğu; tamamı ağ görevinden kullanılır.
+// - Durum değişiklikleri sırayla [uzunluk u16 LE, çerçeve] kayıtları halinde tutulur. Sığmayan çerçevede
+//   bekleyenlerin hepsi atılır ve yerine tek bir yeniden yükleme isteği bekler (panel /api/state'i çeker).
+// - İlerleme ve telemetri anlık görüntüdür: çerçeve paylaşılan tamponda durur, burada yalnızca "bekliyor"
+//   biti vardır ve yeni çerçeve gönderilmemiş eskisinin yerini alır. Telemetri farkları birbirine bağlı
+//   olduğundan atlanan bir farktan sonra istemci anahtar çerçeveye kadar fark almaz.
+class PanelOutbox {
+public:
+    enum Pending : uint8_t {
+        PENDING_RESYNC = 0x01,
+        PENDING_PROGRESS = 0x02, // Ardışık bitler ProgressKind sırasıyla
+        PENDING_TELEMETRY = 0x08
+    };
+
+    // Bağlanan istemci için sıfırlanır; ilk telemetri çerçevesi anahtar çerçeve olmalıdır
+    void open() { _open = true; _length = 0; _pending = 0; _waitKeyframe = true; }
+    void close() { _open = false; _length = 0; _pending = 0; }
+    bool isOpen() const { return _open; }
+
+    // Sığmazsa kuyruk boşaltılır, yeniden yükleme istenir ve false döner
+    bool push(const uint8_t* frame, size_t length) {
+        if (!_open) { return true; }
+        if (_pending & PENDING_RESYNC) { _dropped++; return false; } // Panel zaten tüm durumu çekecek
+        if (length > 0xffff || _length + 2 + length > sizeof(_data)) {
+            _dropped += countFrames() + 1;
+            _length = 0;
+            _pending |= PENDING_RESYNC;
+            return false;
+        }
+        _data[_length] = (uint8_t)length;
+        _data[_length + 1] = (uint8_t)(length >> 8);
+        memcpy(_data + _length + 2, frame, length);
+        _length += 2 + length;
+        return true;
+    }
+    // Sıradaki durum çerçevesinin uzunluğu; yoksa 0
+    size_t front(const uint8_t** frame) const {
+        if (_length == 0) { return 0; }
+        *frame = _data + 2;
+        return (size_t)(_data[0] | _data[1] << 8);
+    }
+    void pop() {
+        size_t record = 2 + (size_t)(_data[0] | _data[1] << 8);
+        _length -= record;
+        memmove(_data, _data + record, _length);
+    }
+
+    // Paylaşılan ilerleme tamponu güncellendi
+    void offerProgress(uint8_t kind) {
+        if (!_open) { return; }
+        uint8_t bit = (uint8_t)(PENDING_PROGRESS << kind);
+        if (_pending & bit) { _dropped++; }
+        _pending |= bit;
+    }
+    // Paylaşılan telemetri tamponuna yeni çerçeve yazıldı; istemci için anahtar çerçeve gerekiyorsa true döner
+    bool offerTelemetry(bool keyframe) {
+        if (!_open) { return false; }
+        if (keyframe) { _waitKeyframe = false; _pending |= PENDING_TELEMETRY; return false; }
+        if (_waitKeyframe) { return true; }
+        if (_pending & PENDING_TELEMETRY) {
+            // Gönderilmemiş fark kayboldu; sonraki farklar ona göre hesaplandığından anahtar çerçeve beklenir
+            _pending &= (uint8_t)~PENDING_TELEMETRY;
+            _waitKeyframe = true;
+            _dropped++;
+            return true;
+        }
+        _pending |= PENDING_TELEMETRY;
+        return false;
+    }
+
+    bool isPending(uint8_t bits) const { return (_pending & bits) != 0; }
+    void clearPending(uint8_t bits) { _pending &= (uint8_t)~bits; }
+    bool empty() const { return _length == 0 && _pending == 0; }
+    size_t depth() const { return _length; }
+    // Atılan ya da yenisiyle değiştirilen çerçeveler
+    uint32_t dropped() const { return _dropped; }
+
+private:
+    size_t countFrames() const {
+        size_t count = 0;
+        for (size_t offset = 0; offset < _length; count++) { offset += 2 + (size_t)(_data[offset] | _data[offset + 1] << 8); }
+        return count;
+    }
+
+    uint8_t _data[PANEL_OUTBOX_SIZE];
+    size_t _length = 0;
+    uint32_t _dropped = 0;
+    uint8_t _pending = 0;
+    bool _waitKeyframe = true;
+    bool _open = false;
+};
+
+#endif
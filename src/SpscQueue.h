@@ -0,0 +1,48 @@
+// lib/ESP32Helper/SpscQueue.h
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Tek üretici / tek tüketici için kilitsiz, sabit kapasiteli halka kuyruk.
+// push() yalnızca üretici görevden, pop() yalnızca tüketici görevden çağrılmalıdır.
+// Arduino'ya bağımlı değildir; std::thread ile masaüstünde de derlenip denenebilir.
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue kapasitesi ikinin kuvveti olmali");
+
+public:
+    // Kuyruk doluysa false döner ve öğe kopyalanmaz
+    bool push(const T& item) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= N) { _dropped.fetch_add(1, std::memory_order_relaxed); return false; }
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) { return false; }
+        item = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return N; }
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    T _items[N];
+    // Sayaçlar sürekli artar; indeks için N ile maskelenir (taşma zararsızdır)
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+    std::atomic<uint32_t> _dropped{0};
+};
+
+#endif
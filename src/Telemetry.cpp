@@ -0,0 +1,72 @@
+// lib/ESP32Helper/Telemetry.cpp
+
+#include <math.h>
+#include "Telemetry.h"
+
+static size_t putVarint(uint8_t* out, uint32_t value) {
+    size_t len = 0;
+    while (value >= 0x80) { out[len++] = (uint8_t)(value | 0x80); value >>= 7; }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+// Küçük mutlak değerli (negatif dahil) sayılar kısa varint'e iner: 0, -1, 1, -2 -> 0, 1, 2, 3
+static uint32_t zigzag(int32_t value) { return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31); }
+
+static int32_t quantize(float value) {
+    if (!(value > -2147483520.0f)) { return value != value ? 0 : -2147483520; } // NaN -> 0
+    if (value > 2147483520.0f) { return 2147483520; }
+    return (int32_t)lroundf(value);
+}
+
+int Telemetry::add(const char* name, const char* unit, uint8_t decimals) {
+    if (_count >= TELEMETRY_MAX_SERIES) { return -1; }
+    if (decimals > 6) { decimals = 6; }
+    Series& series = _series[_count];
+    series.name = name ? name : "";
+    series.unit = unit ? unit : "";
+    series.scale = 1.0f;
+    for (uint8_t i = 0; i < decimals; i++) { series.scale *= 10.0f; }
+    series.sum = 0;
+    series.count = 0;
+    series.sent = 0;
+    series.decimals = decimals;
+    series.hasValue = false;
+    return (int)_count++;
+}
+
+size_t Telemetry::poll(uint32_t nowMs, uint8_t* out) {
+    Sample sample;
+    while (_samples.pop(sample)) {
+        Series& series = _series[sample.id];
+        series.sum += sample.value;
+        series.count++;
+    }
+    if (nowMs - _lastFrameMs < _periodMs) { return 0; }
+
+    bool key = _keyframe || _framesSinceKey >= TELEMETRY_KEYFRAME_INTERVAL;
+    size_t len = 5;
+    for (size_t i = 0; i < _count; i++) {
+        Series& series = _series[i];
+        if (series.count == 0 && !(key && series.hasValue)) { continue; }
+        int32_t value = series.sent;
+        if (series.count > 0) {
+            value = quantize(series.sum / series.count * series.scale);
+            series.sum = 0;
+            series.count = 0;
+        }
+        // Fark taşarsa işaretsiz aritmetikte sarar; panel de toplamı 32 bite sarar
+        int32_t encoded = key ? value : (int32_t)((uint32_t)value - (uint32_t)series.sent);
+        out[len++] = (uint8_t)i;
+        len += putVarint(out + len, zigzag(encoded));
+        series.sent = value;
+        series.hasValue = true;
+    }
+    if (len == 5) { return 0; }
+
+    out[0] = key ? FLAG_KEYFRAME : 0;
+    for (int i = 0; i < 4; i++) { out[1 + i] = (uint8_t)(nowMs >> (8 * i)); }
+    _lastFrameMs = nowMs;
+    if (key) { _keyframe = false; _framesSinceKey = 0; } else { _framesSinceKey++; }
+    return len;
+}
@@ -0,0 +1,88 @@
+// lib/ESP32Helper/Telemetry.h
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "SpscQueue.h"
+
+// Kaydedilebilecek en fazla seri (kimlik tek bayttır)
+#ifndef TELEMETRY_MAX_SERIES
+#define TELEMETRY_MAX_SERIES 32
+#endif
+// publish() ile ağ tarafı arasındaki örnek kuyruğu; ikinin kuvveti olmalı
+#ifndef TELEMETRY_QUEUE_SIZE
+#define TELEMETRY_QUEUE_SIZE 256
+#endif
+// Varsayılan gönderim hızı (çerçeve/sn); setTelemetryRate() ile değiştirilebilir
+#ifndef TELEMETRY_RATE_HZ
+#define TELEMETRY_RATE_HZ 10
+#endif
+// Bu kadar çerçevede bir tüm serilerin mutlak değerleri gönderilir
+#ifndef TELEMETRY_KEYFRAME_INTERVAL
+#define TELEMETRY_KEYFRAME_INTERVAL 50
+#endif
+
+// Sayısal serilerin örneklerini toplayan ve ikili çerçevelere paketleyen kanal.
+// publish() tek bir görevden (uygulama), poll() ağ tarafından çağrılır; aradaki SpscQueue kilitsizdir.
+//
+// Çerçeve: [bayraklar, zaman u32 ms (küçük uçlu), {seri kimliği, zigzag varint}...]
+// Değerler 10^decimals ile çarpılıp tamsayıya yuvarlanır. Anahtar çerçevede (bayrak 0x01) değerler
+// mutlaktır ve değeri olan tüm seriler bulunur; diğerlerinde yalnızca yeni örneği olan serilerin
+// son gönderilen değere göre farkı yer alır. Bir periyottaki örnekler ortalanarak tek değere iner.
+class Telemetry {
+public:
+    enum FrameFlags : uint8_t { FLAG_KEYFRAME = 0x01 };
+    static constexpr size_t maxFrameSize() { return 5 + TELEMETRY_MAX_SERIES * 6; }
+
+    // Kimliği, liste doluysa -1 döner; name ve unit kopyalanmaz
+    int add(const char* name, const char* unit, uint8_t decimals);
+    // Kuyruk doluysa örnek düşürülür ve false döner
+    bool publish(int id, float value) {
+        if (id < 0 || (size_t)id >= _count) { return false; }
+        Sample sample = {(uint8_t)id, value};
+        return _samples.push(sample);
+    }
+
+    size_t size() const { return _count; }
+    const char* name(size_t id) const { return _series[id].name; }
+    const char* unit(size_t id) const { return _series[id].unit; }
+    uint8_t decimals(size_t id) const { return _series[id].decimals; }
+    uint32_t dropped() const { return _samples.dropped(); }
+
+    void setRate(uint8_t hz) { _periodMs = 1000 / (hz ? hz : 1); }
+    uint8_t rate() const { return (uint8_t)(1000 / _periodMs); }
+    // Sonraki çerçeve anahtar çerçeve olur (ör. yeni panel bağlandığında)
+    void requestKeyframe() { _keyframe = true; }
+
+    // Kuyruğu boşaltır; periyot dolmuş ve gönderilecek değer varsa çerçeveyi out'a yazıp uzunluğunu,
+    // yoksa 0 döner. out en az maxFrameSize() bayt olmalıdır.
+    size_t poll(uint32_t nowMs, uint8_t* out);
+
+private:
+    struct Sample {
+        uint8_t id;
+        float value;
+    };
+    struct Series {
+        const char* name;
+        const char* unit;
+        float scale;
+        float sum;
+        uint32_t count;
+        int32_t sent; // Panellerin bildiği son değer
+        uint8_t decimals;
+        bool hasValue;
+    };
+
+    SpscQueue<Sample, TELEMETRY_QUEUE_SIZE> _samples;
+    Series _series[TELEMETRY_MAX_SERIES];
+    size_t _count = 0;
+    uint32_t _periodMs = 1000 / TELEMETRY_RATE_HZ;
+    uint32_t _lastFrameMs = 0;
+    uint32_t _framesSinceKey = 0;
+    bool _keyframe = true;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""html/ altindaki sayfalari gzip ile sikistirip src/PanelHtml.h icine gomer.
+
+Kullanim: python3 tools/embed_html.py
+Her html/<ad>.html icin <AD>_HTML_GZ dizisi ve guclu bir <AD>_HTML_ETAG uretilir.
+Sayfa degistiginde betik yeniden calistirilmali ve uretilen baslik dosyasi commit edilmelidir.
+"""
+import glob
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "src", "PanelHtml.h")
+
+
+def embed(path):
+    raw = open(path, "rb").read()
+    gz = gzip.compress(raw, compresslevel=9, mtime=0)
+    name = os.path.splitext(os.path.basename(path))[0].upper()
+    etag = hashlib.sha1(gz).hexdigest()[:16]
+    lines = [
+        "// %s: %d bayt -> gzip %d bayt" % (os.path.relpath(path, ROOT), len(raw), len(gz)),
+        'static const char %s_HTML_ETAG[] = "\\"%s\\"";' % (name, etag),
+        "static const uint8_t %s_HTML_GZ[] PROGMEM = {" % name,
+    ]
+    for i in range(0, len(gz), 20):
+        lines.append("    " + ", ".join("0x%02x" % b for b in gz[i:i + 20]) + ",")
+    lines.append("};")
+    return "\n".join(lines), name, len(raw), len(gz)
+
+
+def main():
+    pages = sorted(glob.glob(os.path.join(ROOT, "html", "*.html")))
+    blocks = []
+    print("%-12s %10s %10s %8s" % ("sayfa", "ham", "gzip", "oran"))
+    for path in pages:
+        block, name, raw_len, gz_len = embed(path)
+        blocks.append(block)
+        print("%-12s %10d %10d %7.1f%%" % (name.lower(), raw_len, gz_len, 100.0 * gz_len / raw_len))
+    with open(OUTPUT, "w") as out:
+        out.write("// lib/ESP32Helper/PanelHtml.h\n")
+        out.write("// Bu dosya tools/embed_html.py tarafindan uretilmistir, elle duzenlemeyin.\n\n")
+        out.write("#ifndef PANELHTML_H\n#define PANELHTML_H\n\n#include <Arduino.h>\n\n")
+        out.write("\n\n".join(blocks))
+        out.write("\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Iki firmware imaji arasinda FirmwareWriter'in uyguladigi delta yamasini (EDP1) uretir.
+
+Kullanim:
+    python3 tools/make_delta.py eski.bin yeni.bin -o yama.edp
+    python3 tools/make_delta.py --bench eski1.bin yeni1.bin [eski2.bin yeni2.bin ...]
+
+Yama bicimi (kucuk uclu):
+    "EDP1" | hedef boyut (u32) | hedef SHA-256 (32 bayt) | islemler...
+    0x01 COPY kaynak_ofseti(u32) uzunluk(u32)   -> cihazda calisan bolumden kopyalanir
+    0x02 DATA uzunluk(u32) veri                 -> oldugu gibi yazilir
+    0x00 END
+
+Eski imaj, cihazda su an calisan firmware'in .bin dosyasi olmalidir; yama cihazda
+calisan bolume karsi uygulanir ve sonuc hedef SHA-256 ozeti ile dogrulanir.
+"""
+import argparse
+import gzip
+import hashlib
+import struct
+import sys
+
+MAGIC = b"EDP1"
+OP_END, OP_COPY, OP_DATA = 0, 1, 2
+BLOCK = 32      # Eslesme aramasinda kullanilan blok boyu
+STRIDE = 4      # Kaynak imajda indekslenen ofset araligi (kod 4 bayt hizalidir)
+MIN_COPY = 24   # Bundan kisa eslesmeler DATA olarak yazilir (COPY islemi 9 bayttir)
+
+# Cihazda x-firmware-base olarak gonderilen ELF SHA-256 ozetinin .bin icindeki yeri:
+# imaj basligi (24) + ilk bolum basligi (8) + esp_app_desc_t icinde 144. bayt
+APP_ELF_SHA_OFFSET = 24 + 8 + 144
+
+
+def elf_sha256(image):
+    return image[APP_ELF_SHA_OFFSET:APP_ELF_SHA_OFFSET + 32].hex()
+
+
+def make_patch(base, target):
+    index = {}
+    for i in range(0, len(base) - BLOCK + 1, STRIDE):
+        index.setdefault(base[i:i + BLOCK], i)
+
+    ops = []
+    literal = bytearray()
+
+    def flush_literal():
+        if literal:
+            ops.append(struct.pack("<BI", OP_DATA, len(literal)) + bytes(literal))
+            literal.clear()
+
+    t = 0
+    n = len(target)
+    while t < n:
+        src = index.get(target[t:t + BLOCK]) if t + BLOCK <= n else None
+        if src is None:
+            literal.append(target[t])
+            t += 1
+            continue
+        length = BLOCK
+        while src + length < len(base) and t + length < n:
+            step = min(256, len(base) - src - length, n - t - length)
+            if base[src + length:src + length + step] == target[t + length:t + length + step]:
+                length += step
+                continue
+            while base[src + length] == target[t + length]:
+                length += 1
+            break
+        # Eslesmeyi geriye, bekleyen literal baytlara dogru genislet
+        while literal and src > 0 and base[src - 1] == literal[-1]:
+            literal.pop()
+            src -= 1
+            t -= 1
+            length += 1
+        if length < MIN_COPY:
+            literal.extend(target[t:t + length])
+        else:
+            flush_literal()
+            ops.append(struct.pack("<BII", OP_COPY, src, length))
+        t += length
+    flush_literal()
+    ops.append(bytes([OP_END]))
+    header = MAGIC + struct.pack("<I", len(target)) + hashlib.sha256(target).digest()
+    return header + b"".join(ops)
+
+
+def apply_patch(base, patch):
+    if patch[:4] != MAGIC:
+        raise ValueError("EDP1 yamasi degil")
+    size, = struct.unpack_from("<I", patch, 4)
+    digest = patch[8:40]
+    out = bytearray()
+    pos = 40
+    while True:
+        op = patch[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            src, length = struct.unpack_from("<II", patch, pos)
+            pos += 8
+            out += base[src:src + length]
+        elif op == OP_DATA:
+            length, = struct.unpack_from("<I", patch, pos)
+            pos += 4
+            out += patch[pos:pos + length]
+            pos += length
+        else:
+            raise ValueError("gecersiz islem %d" % op)
+    if len(out) != size or hashlib.sha256(out).digest() != digest:
+        raise ValueError("yama dogrulanamadi")
+    return bytes(out)
+
+
+def bench(paths):
+    if len(paths) % 2:
+        sys.exit("--bench icin eski/yeni dosya ciftleri gerekir")
+    print("%-28s %10s %10s %10s %10s %8s" % ("cift", "tam", "tam.gz", "delta", "delta.gz", "tasarruf"))
+    total_full = total_delta = 0
+    for base_path, target_path in zip(paths[0::2], paths[1::2]):
+        base = open(base_path, "rb").read()
+        target = open(target_path, "rb").read()
+        patch = make_patch(base, target)
+        apply_patch(base, patch)
+        full_gz = len(gzip.compress(target, 9))
+        patch_gz = len(gzip.compress(patch, 9))
+        total_full += len(target)
+        total_delta += len(patch)
+        name = "%s -> %s" % (base_path.split("/")[-1], target_path.split("/")[-1])
+        print("%-28s %10d %10d %10d %10d %7.1f%%" % (name[-28:], len(target), full_gz, len(patch), patch_gz,
+                                                   100.0 * (1 - len(patch) / len(target))))
+    print("toplam: %d bayt yerine %d bayt (%.1f%% tasarruf)" % (total_full, total_delta, 100.0 * (1 - total_delta / total_full)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("-o", "--output")
+    parser.add_argument("--bench", action="store_true", help="dosya ciftleri icin boyut karsilastirmasi yap")
+    args = parser.parse_args()
+    if args.bench:
+        bench(args.files)
+        return
+    if len(args.files) != 2 or not args.output:
+        parser.error("eski.bin yeni.bin -o yama.edp bekleniyor")
+    base = open(args.files[0], "rb").read()
+    target = open(args.files[1], "rb").read()
+    patch = make_patch(base, target)
+    apply_patch(base, patch)
+    open(args.output, "wb").write(patch)
+    print("%s: %d bayt (tam imaj %d bayt, %.1f%% tasarruf), taban ELF SHA-256 %s" % (
+        args.output, len(patch), len(target), 100.0 * (1 - len(patch) / len(target)), elf_sha256(base)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""URL OTA icin yerel test sunucusu.
+
+Kullanim:
+    python3 tools/ota_server.py firmware.bin --version 1.0.1 [--port 8000] [--drop-after 65536] [--rate 50]
+                                [--delta-from eski.bin]
+
+Cihazdaki OTA URL'si http://<bilgisayar_ip>:8000/firmware.bin olarak ayarlanir. Sunucu:
+  * HEAD ve GET isteklerine x-firmware-version, ETag ve Content-Length ile cevap verir,
+  * If-None-Match eslesirse 304 Not Modified doner,
+  * Range / If-Range ile kismi indirmeyi (206) destekler,
+  * --drop-after verilirse her GET'te o kadar bayt gonderdikten sonra baglantiyi koparir
+    (kaldigi yerden devam etmeyi denemek icin),
+  * --rate ile gonderim hizini KB/s cinsinden sinirlar,
+  * her cevapta tam imajin SHA-256 ozetini x-firmware-sha256 ile gonderir,
+  * --delta-from verilirse, x-firmware-base basligi o imajin ELF ozetiyle eslesen
+    cihazlara tam imaj yerine tools/make_delta.py ile uretilen yamayi gonderir.
+"""
+import argparse
+import hashlib
+import http.server
+import re
+import time
+
+from make_delta import elf_sha256, make_patch
+
+
+def make_handler(args, full, delta_base, delta):
+    digest = hashlib.sha256(full).hexdigest()
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def select(self):
+            # Cihazin calistirdigi imaj icin yama varsa onu, yoksa tam imaji sec
+            if delta is not None and self.headers.get("x-firmware-base") == delta_base:
+                self.body = delta
+            else:
+                self.body = full
+            self.etag = '"%s"' % hashlib.sha1(self.body).hexdigest()[:16]
+
+        def log_message(self, fmt, *a):
+            print("%s %s" % (self.address_string(), fmt % a))
+
+        def send_common(self, code, length):
+            self.send_response(code)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(length))
+            self.send_header("ETag", self.etag)
+            self.send_header("Accept-Ranges", "bytes")
+            self.send_header("x-firmware-version", args.version)
+            self.send_header("x-firmware-sha256", digest)
+
+        def resolve(self):
+            self.select()
+            data, etag = self.body, self.etag
+            if self.headers.get("If-None-Match") == etag:
+                self.send_response(304)
+                self.send_header("ETag", etag)
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return None
+            start = 0
+            match = re.match(r"bytes=(\d+)-$", self.headers.get("Range", ""))
+            if_range = self.headers.get("If-Range")
+            if match and (if_range is None or if_range == etag):
+                start = int(match.group(1))
+            if start >= len(data) and start > 0:
+                self.send_response(416)
+                self.send_header("Content-Range", "bytes */%d" % len(data))
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return None
+            if start > 0:
+                self.send_common(206, len(data) - start)
+                self.send_header("Content-Range", "bytes %d-%d/%d" % (start, len(data) - 1, len(data)))
+            else:
+                self.send_common(200, len(data))
+            self.end_headers()
+            return start
+
+        def do_HEAD(self):
+            self.resolve()
+
+        def do_GET(self):
+            start = self.resolve()
+            if start is None:
+                return
+            data = self.body
+            sent = 0
+            chunk = 1024
+            for offset in range(start, len(data), chunk):
+                if args.drop_after and sent >= args.drop_after:
+                    print("  baglanti %d bayttan sonra bilerek koparildi" % (start + sent))
+                    self.close_connection = True
+                    return
+                part = data[offset:offset + chunk]
+                self.wfile.write(part)
+                sent += len(part)
+                if args.rate:
+                    time.sleep(len(part) / (args.rate * 1024.0))
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("firmware")
+    parser.add_argument("--version", required=True)
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--drop-after", type=int, default=0)
+    parser.add_argument("--rate", type=float, default=0)
+    parser.add_argument("--delta-from")
+    args = parser.parse_args()
+    data = open(args.firmware, "rb").read()
+    print("%s: %d bayt, versiyon %s" % (args.firmware, len(data), args.version))
+    delta_base = delta = None
+    if args.delta_from:
+        base = open(args.delta_from, "rb").read()
+        delta_base = elf_sha256(base)
+        delta = make_patch(base, data)
+        print("delta: %s tabanli cihazlara %d bayt" % (delta_base, len(delta)))
+    server = http.server.ThreadingHTTPServer(("", args.port), make_handler(args, data, delta_base, delta))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()